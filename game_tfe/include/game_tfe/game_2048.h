@@ -110,6 +110,9 @@ private:
     // vertices and indicies to be rendered
     Geometry<9> mGeometry;
 
+    /// mGeometry's vertices packed for upload
+    std::vector<PackedVertex> mPackedVertices;
+
     /// game board
     GameBoard mBoard;
 
@@ -32,7 +32,13 @@ public:
      * data type
      */
     enum class GLDataType {
-        FLOAT
+        FLOAT,
+        /** IEEE half float */
+        HALF_FLOAT,
+        /** unsigned byte read as a float in [0, 1] */
+        UNORM8,
+        /** unsigned short read as a float in [0, 1] */
+        UNORM16
     };
 
     /**
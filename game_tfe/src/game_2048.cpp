@@ -10,6 +10,7 @@
 #include <memory>
 #include <vector>
 #include <fstream>
+#include <cstddef>
 
 #include "glad/glad.h"
 #include "GLFW/glfw3.h"
@@ -302,9 +303,9 @@ int Game2048::Run()
 
         mBuffer.Init();
 
-        size_t s = mGeometry.GetVertexSize();
+        mGeometry.PackVertices(mPackedVertices);
 
-        mBuffer.LoadData(reinterpret_cast<unsigned char*>(mGeometry.GetVerticesPointer()), mGeometry.GetVerticesByteSize(), mGeometry.GetIndicesPointer(), mGeometry.GetIndicesCount() * sizeof(unsigned int), GLBuffer::GLUsage::DYNAMIC);
+        mBuffer.LoadData(reinterpret_cast<unsigned char*>(mPackedVertices.data()), mPackedVertices.size() * sizeof(PackedVertex), mGeometry.GetIndicesPointer(), mGeometry.GetIndicesCount() * sizeof(unsigned int), GLBuffer::GLUsage::DYNAMIC);
 
         /*
         unsigned char* atlas = mGeometry.GetAtlas()->GetData();
@@ -320,9 +321,9 @@ int Game2048::Run()
 
         mBuffer.LoadTextureRed(mGeometry.GetAtlas()->GetData(), mGeometry.GetAtlas()->GetWidth(), mGeometry.GetAtlas()->GetHeight());
 
-        mBuffer.SetAttributePointer(0, 3, GLBuffer::GLDataType::FLOAT, 9 * sizeof(float), 0);
-        mBuffer.SetAttributePointer(1, 4, GLBuffer::GLDataType::FLOAT, 9 * sizeof(float), reinterpret_cast<void*>(sizeof(float)*3));
-        mBuffer.SetAttributePointer(2, 2, GLBuffer::GLDataType::FLOAT, 9 * sizeof(float), reinterpret_cast<void*>(sizeof(float)*7));
+        mBuffer.SetAttributePointer(0, 3, GLBuffer::GLDataType::FLOAT, sizeof(PackedVertex), reinterpret_cast<void*>(offsetof(PackedVertex, position)));
+        mBuffer.SetAttributePointer(1, 4, GLBuffer::GLDataType::UNORM8, sizeof(PackedVertex), reinterpret_cast<void*>(offsetof(PackedVertex, color)));
+        mBuffer.SetAttributePointer(2, 2, GLBuffer::GLDataType::UNORM16, sizeof(PackedVertex), reinterpret_cast<void*>(offsetof(PackedVertex, texCoords)));
 
         CMatrix<4,4> proj = OrthographicProjection(0, mWindowProperties.width, mWindowProperties.height, 0, 1.0f, 0.0f);
 
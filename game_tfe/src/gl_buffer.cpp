@@ -55,7 +55,20 @@ bool GLBuffer::LoadData(unsigned char* v_data, size_t v_data_size, unsigned int*
 bool GLBuffer::SetAttributePointer(unsigned int index, int size, GLDataType type, size_t stride, const void* offset)
 {
     glBindVertexArray(mVertexArrayObjectId);
-    glVertexAttribPointer(index, size, GL_FLOAT, GL_FALSE, stride, offset);
+    switch(type) {
+        case GLDataType::FLOAT:
+            glVertexAttribPointer(index, size, GL_FLOAT, GL_FALSE, stride, offset);
+            break;
+        case GLDataType::HALF_FLOAT:
+            glVertexAttribPointer(index, size, GL_HALF_FLOAT, GL_FALSE, stride, offset);
+            break;
+        case GLDataType::UNORM8:
+            glVertexAttribPointer(index, size, GL_UNSIGNED_BYTE, GL_TRUE, stride, offset);
+            break;
+        case GLDataType::UNORM16:
+            glVertexAttribPointer(index, size, GL_UNSIGNED_SHORT, GL_TRUE, stride, offset);
+            break;
+    }
     glEnableVertexAttribArray(index);
     return true;
 }
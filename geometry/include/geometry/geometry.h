@@ -5,10 +5,28 @@
 #ifndef DRAWING_GEOMETRY_H
 #define DRAWING_GEOMETRY_H
 
+#include <algorithm>
 #include <vector>
 #include <memory>
 #include <cstring>
+#include "linalg/map.h"
+#include "linalg/packed.h"
 #include "linalg/rvector.h"
+#include "linalg/transform.h"
+
+/**
+ * A Geometry<9> vertex, position, RGBA color and texture coordinates, packed for upload in 20
+ * bytes instead of 36. The color is stored as normalized 8 bit and the texture coordinates as
+ * normalized 16 bit values. The position stays a full float since it is in pixels, where a half
+ * float would be off by up to half a pixel past 1024.
+ */
+struct PackedVertex {
+    float position[3];
+    QS::LinAlg::UNorm8 color[4];
+    QS::LinAlg::UNorm16 texCoords[2];
+};
+
+static_assert(sizeof(PackedVertex) == 20, "packed vertices must be tightly packed");
 
 template<int length> 
 class Geometry {
@@ -208,6 +226,60 @@ public:
         return mVertices.data()->GetData();
     }
 
+    /**
+     * The positions, the first three floats of every vertex, viewed in place
+     */
+    QS::LinAlg::MapArray<QS::LinAlg::RVector<3>> GetPositions()
+    {
+        static_assert(length >= 3, "vertices must start with a position");
+        return { mVertices.empty() ? nullptr : GetVerticesPointer(), length, mVertices.size() };
+    }
+
+    /**
+     * Transforms the position, the first three floats, of every vertex by m
+     * @param m affine transform
+     */
+    void TransformVertices(const QS::LinAlg::CMatrix<4, 4>& m)
+    {
+        static_assert(length >= 3, "vertices must start with a position");
+        if (mVertices.empty()) {
+            return;
+        }
+        QS::LinAlg::TransformPositions(m, GetVerticesPointer(), length, mVertices.size());
+    }
+
+    /**
+     * Packs the vertices, each a position, RGBA color and texture coordinates, for upload
+     * @param out resized to hold GetVerticesCount() packed vertices
+     */
+    void PackVertices(std::vector<PackedVertex>& out) const
+    {
+        static_assert(length == 9, "packed vertices hold a position, a color and texture coordinates");
+        out.resize(mVertices.size());
+
+        // gather the attributes of a chunk so each converts with one vectorized call
+        constexpr size_t chunk = 256;
+        float colors[chunk * 4];
+        float texCoords[chunk * 2];
+        QS::LinAlg::UNorm8 packedColors[chunk * 4];
+        QS::LinAlg::UNorm16 packedTexCoords[chunk * 2];
+        for (size_t begin = 0; begin < mVertices.size(); begin += chunk) {
+            const size_t count = std::min(chunk, mVertices.size() - begin);
+            for (size_t i = 0; i < count; ++i) {
+                const QS::LinAlg::RVector<length>& vertex = mVertices[begin + i];
+                std::copy(vertex.GetData(), vertex.GetData() + 3, out[begin + i].position);
+                std::copy(vertex.GetData() + 3, vertex.GetData() + 7, colors + i * 4);
+                std::copy(vertex.GetData() + 7, vertex.GetData() + 9, texCoords + i * 2);
+            }
+            QS::LinAlg::Pack(colors, packedColors, count * 4);
+            QS::LinAlg::Pack(texCoords, packedTexCoords, count * 2);
+            for (size_t i = 0; i < count; ++i) {
+                std::copy(packedColors + i * 4, packedColors + i * 4 + 4, out[begin + i].color);
+                std::copy(packedTexCoords + i * 2, packedTexCoords + i * 2 + 2, out[begin + i].texCoords);
+            }
+        }
+    }
+
     unsigned int* GetIndicesPointer()
     {
         return &(mIndices.data()[0]);
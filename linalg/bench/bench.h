@@ -0,0 +1,40 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_BENCH_H
+#define DRAWING_BENCH_H
+
+#include <cstddef>
+#include <random>
+
+#include "benchmark/benchmark.h"
+
+namespace QS::LinAlg::Bench {
+
+    /**
+     * Attaches the per operation cost to a benchmark: "FLOP/s" counts floating point operations per
+     * second, "bytes" the bytes read and written by one operation, and bytes_per_second the
+     * resulting memory throughput. The reported time is already per operation.
+     */
+    inline void Report(benchmark::State &state, const double flops, const double bytes) {
+        state.counters["FLOP/s"] = benchmark::Counter(flops, benchmark::Counter::kIsIterationInvariantRate,
+                                                      benchmark::Counter::OneK::kIs1000);
+        state.counters["bytes"] = bytes;
+        state.SetBytesProcessed(static_cast<int64_t>(bytes * static_cast<double>(state.iterations())));
+    }
+
+    /**
+     * Values in [-1, 1] from a fixed seed, so every run and every release sees the same inputs
+     */
+    template<typename T>
+    void Fill(T *data, const size_t n, const unsigned seed = 1) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<T> value(-1, 1);
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = value(rng);
+        }
+    }
+}
+
+#endif //DRAWING_BENCH_H
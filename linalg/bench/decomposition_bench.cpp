@@ -0,0 +1,311 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <cmath>
+#include <vector>
+
+#include "bench.h"
+
+#include "linalg/cholesky.h"
+#include "linalg/eigen.h"
+#include "linalg/iterative.h"
+#include "linalg/lu.h"
+#include "linalg/qr.h"
+
+using namespace QS::LinAlg;
+using namespace QS::LinAlg::Bench;
+
+// Factorizations and solvers. The dense factorizations are O(n^3) and stop at 2048, where one
+// factorization already takes seconds; the flop counts are the leading terms of the classic
+// algorithms so rates compare across implementations.
+
+namespace {
+    template<typename T = double, Layout layout = Layout::RowMajor>
+    DMatrix<T, layout> RandomDMatrix(const size_t rows, const size_t cols, const unsigned seed) {
+        DMatrix<T, layout> out(rows, cols);
+        Fill(out.GetData(), out.GetSize(), seed);
+        return out;
+    }
+
+    /**
+     * A A^T + n I, symmetric positive definite and well conditioned
+     */
+    DMatrix<double> RandomSpd(const size_t n, const unsigned seed) {
+        const DMatrix<double> a = RandomDMatrix(n, n, seed);
+        DMatrix<double> out(n, n);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j <= i; ++j) {
+                double sum = i == j ? static_cast<double>(n) : 0.0;
+                for (size_t k = 0; k < n; ++k) {
+                    sum += a(i, k) * a(j, k);
+                }
+                out(i, j) = sum;
+                out(j, i) = sum;
+            }
+        }
+        return out;
+    }
+
+    /**
+     * ||A^T (A x - b)|| / ||b|| for the rows x cols matrix A, zero at the least squares solution
+     * \param a a(i, j) is A(i, j)
+     */
+    template<typename A, class V>
+    double NormalResidual(const A &a, const V &x, const V &b, const size_t rows, const size_t cols) {
+        std::vector<double> r(rows);
+        double bNorm = 0.0;
+        for (size_t i = 0; i < rows; ++i) {
+            double sum = -static_cast<double>(b[i]);
+            for (size_t j = 0; j < cols; ++j) {
+                sum += static_cast<double>(a(i, j)) * static_cast<double>(x[j]);
+            }
+            r[i] = sum;
+            bNorm += static_cast<double>(b[i]) * static_cast<double>(b[i]);
+        }
+        double norm = 0.0;
+        for (size_t j = 0; j < cols; ++j) {
+            double sum = 0.0;
+            for (size_t i = 0; i < rows; ++i) {
+                sum += static_cast<double>(a(i, j)) * r[i];
+            }
+            norm += sum * sum;
+        }
+        return std::sqrt(norm / bNorm);
+    }
+
+    template<int n, typename T>
+    CMatrix<n, n, T> FixedSpd(const unsigned seed) {
+        CMatrix<n, n, T> a, out;
+        Fill(a.GetData(), n * n, seed);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < n; ++j) {
+                T sum = i == j ? T(n) : T();
+                for (size_t k = 0; k < n; ++k) {
+                    sum += a[k][i] * a[k][j];
+                }
+                out[j][i] = sum;
+            }
+        }
+        return out;
+    }
+
+    void FactorSizes(benchmark::internal::Benchmark *b) {
+        b->RangeMultiplier(2)->Range(64, 2048)->Unit(benchmark::kMillisecond)->UseRealTime();
+    }
+}
+
+template<Layout layout>
+void LUFactor(benchmark::State &state) {
+    const size_t n = state.range(0);
+    const DMatrix<double, layout> a = RandomDMatrix<double, layout>(n, n, 1);
+    for (auto _: state) {
+        const LU<DMatrix<double, layout>> lu(a);
+        benchmark::DoNotOptimize(&lu);
+    }
+    Report(state, 2.0 / 3.0 * n * n * n, 2.0 * n * n * sizeof(double));
+}
+
+BENCHMARK_TEMPLATE(LUFactor, Layout::RowMajor)->Apply(FactorSizes);
+BENCHMARK_TEMPLATE(LUFactor, Layout::ColumnMajor)->Apply(FactorSizes);
+
+void LUInverse(benchmark::State &state) {
+    const size_t n = state.range(0);
+    const DMatrix<double> a = RandomDMatrix(n, n, 1);
+    for (auto _: state) {
+        DMatrix<double> out = Inverse(a);
+        benchmark::DoNotOptimize(out.GetData());
+    }
+    // factor, then n forward and back substitutions
+    Report(state, 2.0 / 3.0 * n * n * n + 2.0 * n * n * n, 3.0 * n * n * sizeof(double));
+}
+
+BENCHMARK(LUInverse)->Apply(FactorSizes);
+
+template<Layout layout>
+void QRFactor(benchmark::State &state) {
+    const size_t n = state.range(0);
+    const DMatrix<double, layout> a = RandomDMatrix<double, layout>(2 * n, n, 1);
+    for (auto _: state) {
+        const QR<DMatrix<double, layout>> qr(a);
+        benchmark::DoNotOptimize(&qr);
+    }
+    // 2 m n^2 - 2 n^3 / 3 for an m x n matrix
+    const double m = 2.0 * n;
+    Report(state, 2.0 * m * n * n - 2.0 / 3.0 * n * n * n, 2.0 * m * n * sizeof(double));
+}
+
+BENCHMARK_TEMPLATE(QRFactor, Layout::RowMajor)->Apply(FactorSizes);
+BENCHMARK_TEMPLATE(QRFactor, Layout::ColumnMajor)->Apply(FactorSizes);
+
+void QRLeastSquares(benchmark::State &state) {
+    const size_t n = state.range(0);
+    const DMatrix<double> a = RandomDMatrix(2 * n, n, 1);
+    DVector<double> b(2 * n);
+    Fill(b.GetData(), 2 * n, 2);
+    for (auto _: state) {
+        DVector<double> x = LeastSquares(a, b);
+        benchmark::DoNotOptimize(x.GetData());
+    }
+    const double m = 2.0 * n;
+    Report(state, 2.0 * m * n * n - 2.0 / 3.0 * n * n * n + 4.0 * m * n, 2.0 * m * n * sizeof(double));
+    state.counters["residual"] = NormalResidual(a, LeastSquares(a, b), b, 2 * n, n);
+}
+
+BENCHMARK(QRLeastSquares)->Apply(FactorSizes);
+
+template<template<class> class F>
+void SymmetricFactor(benchmark::State &state) {
+    const size_t n = state.range(0);
+    const DMatrix<double> a = RandomSpd(n, 1);
+    for (auto _: state) {
+        const F<DMatrix<double>> factors(a);
+        benchmark::DoNotOptimize(&factors);
+    }
+    Report(state, 1.0 / 3.0 * n * n * n, 2.0 * n * n * sizeof(double));
+}
+
+BENCHMARK_TEMPLATE(SymmetricFactor, Cholesky)->Apply(FactorSizes);
+BENCHMARK_TEMPLATE(SymmetricFactor, LDLT)->Apply(FactorSizes);
+
+void ConjugateGradientPoisson(benchmark::State &state) {
+    // the five point Laplacian of an n x n grid, with and without an IC(0) preconditioner
+    const size_t n = state.range(0);
+    const size_t size = n * n;
+    std::vector<Triplet<double>> triplets;
+    for (size_t i = 0; i < size; ++i) {
+        triplets.push_back({ i, i, 4.0 });
+        if (i % n > 0) triplets.push_back({ i, i - 1, -1.0 });
+        if (i % n + 1 < n) triplets.push_back({ i, i + 1, -1.0 });
+        if (i >= n) triplets.push_back({ i, i - n, -1.0 });
+        if (i + n < size) triplets.push_back({ i, i + n, -1.0 });
+    }
+    const CsrMatrix<double> a = CsrMatrix<double>::FromTriplets(size, size, triplets);
+    const IncompleteCholesky<double> ic(a);
+    DVector<double> b(size);
+    Fill(b.GetData(), size, 1);
+    SolverOptions options;
+    options.tolerance = 1e-8;
+    options.maxIterations = 10 * size;
+    size_t iterations = 0;
+    for (auto _: state) {
+        DVector<double> x(size);
+        const SolverResult result = state.range(1) ? ConjugateGradient(a, b, x, ic, options)
+                                                   : ConjugateGradient(a, b, x, options);
+        iterations = result.iterations;
+        benchmark::DoNotOptimize(x.GetData());
+    }
+    state.counters["iterations"] = static_cast<double>(iterations);
+}
+
+BENCHMARK(ConjugateGradientPoisson)->ArgsProduct({ { 32, 128, 512 }, { 0, 1 } })->ArgNames({ "n", "ic" })
+        ->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// small fixed size factorizations, one system per iteration
+
+template<int n, typename T>
+void FixedLUSolve(benchmark::State &state) {
+    CMatrix<n, n, T> a = FixedSpd<n, T>(1);
+    CVector<n, T> b, x;
+    Fill(b.GetData(), n, 2);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(b);
+        x = Solve(a, b);
+        benchmark::DoNotOptimize(x);
+    }
+    Report(state, 2.0 / 3.0 * n * n * n + 2.0 * n * n, (n * n + 2.0 * n) * sizeof(T));
+}
+
+template<int n, typename T>
+void FixedCholeskySolve(benchmark::State &state) {
+    CMatrix<n, n, T> a = FixedSpd<n, T>(1);
+    CVector<n, T> b, x;
+    Fill(b.GetData(), n, 2);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(b);
+        x = Cholesky<CMatrix<n, n, T>>(a).Solve(b);
+        benchmark::DoNotOptimize(x);
+    }
+    Report(state, 1.0 / 3.0 * n * n * n + 2.0 * n * n, (n * n + 2.0 * n) * sizeof(T));
+}
+
+template<int n, typename T>
+void FixedQRSolve(benchmark::State &state) {
+    CMatrix<n, n, T> a = FixedSpd<n, T>(1);
+    CVector<n, T> b, x;
+    Fill(b.GetData(), n, 2);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(b);
+        x = QR<CMatrix<n, n, T>>(a).Solve(b);
+        benchmark::DoNotOptimize(x);
+    }
+    Report(state, 4.0 / 3.0 * n * n * n + 3.0 * n * n, (n * n + 2.0 * n) * sizeof(T));
+    const auto at = [&a](size_t i, size_t j) { return Detail::Element(a, i, j); };
+    state.counters["residual"] = NormalResidual(at, x, b, n, n);
+}
+
+#define QS_BENCH_SOLVE_SIZES(f) \
+    BENCHMARK_TEMPLATE(f, 2, float); BENCHMARK_TEMPLATE(f, 3, float); BENCHMARK_TEMPLATE(f, 4, float); \
+    BENCHMARK_TEMPLATE(f, 8, double); BENCHMARK_TEMPLATE(f, 16, double)
+
+QS_BENCH_SOLVE_SIZES(FixedLUSolve);
+QS_BENCH_SOLVE_SIZES(FixedCholeskySolve);
+QS_BENCH_SOLVE_SIZES(FixedQRSolve);
+
+// batched 3x3 kernels, reported per matrix through items_per_second
+
+void BatchEigen3(benchmark::State &state) {
+    const size_t count = state.range(0);
+    VectorArray<6> matrices(count);
+    for (size_t c = 0; c < 6; ++c) {
+        Fill(matrices.GetLane(c), count, 1 + c);
+    }
+    VectorArray<3> values;
+    VectorArray<9> vectors;
+    for (auto _: state) {
+        BatchSymmetricEigen(matrices, values, vectors);
+        benchmark::DoNotOptimize(values.GetLane(0));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(count * state.iterations()));
+    Report(state, 0.0, count * (6.0 + 3.0 + 9.0) * sizeof(float));
+}
+
+BENCHMARK(BatchEigen3)->RangeMultiplier(16)->Range(64, 1 << 20)->UseRealTime();
+
+void BatchSvd3(benchmark::State &state) {
+    const size_t count = state.range(0);
+    VectorArray<9> matrices(count);
+    for (size_t c = 0; c < 9; ++c) {
+        Fill(matrices.GetLane(c), count, 1 + c);
+    }
+    VectorArray<9> u, v;
+    VectorArray<3> sigma;
+    for (auto _: state) {
+        BatchSvd(matrices, u, sigma, v);
+        benchmark::DoNotOptimize(sigma.GetLane(0));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(count * state.iterations()));
+    Report(state, 0.0, count * (9.0 + 9.0 + 3.0 + 9.0) * sizeof(float));
+}
+
+BENCHMARK(BatchSvd3)->RangeMultiplier(16)->Range(64, 1 << 20)->UseRealTime();
+
+void BatchCholesky3(benchmark::State &state) {
+    const size_t count = state.range(0);
+    std::vector<CMatrix<3, 3>> a(count);
+    std::vector<CVector<3>> b(count), x(count);
+    for (size_t i = 0; i < count; ++i) {
+        a[i] = FixedSpd<3, float>(static_cast<unsigned>(i));
+        Fill(b[i].GetData(), 3, static_cast<unsigned>(i));
+    }
+    for (auto _: state) {
+        benchmark::DoNotOptimize(BatchCholeskySolve(a.data(), b.data(), x.data(), count));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(count * state.iterations()));
+    Report(state, count * (9.0 + 18.0), count * (9.0 + 3.0 + 3.0) * sizeof(float));
+}
+
+BENCHMARK(BatchCholesky3)->RangeMultiplier(16)->Range(64, 1 << 16)->UseRealTime();
@@ -0,0 +1,263 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <cmath>
+
+#include "bench.h"
+
+#include "linalg/cmatrix.h"
+#include "linalg/inverse.h"
+#include "linalg/lu.h"
+#include "linalg/quaternion.h"
+#include "linalg/rmatrix.h"
+
+using namespace QS::LinAlg;
+using namespace QS::LinAlg::Bench;
+
+// Every fixed size operator at the sizes graphics and small solvers use. Operands are passed
+// through DoNotOptimize each iteration so the compiler can neither hoist nor fold the work.
+
+#define QS_BENCH_FIXED_SIZES(f, T) \
+    BENCHMARK_TEMPLATE(f, 2, T); BENCHMARK_TEMPLATE(f, 3, T); BENCHMARK_TEMPLATE(f, 4, T); \
+    BENCHMARK_TEMPLATE(f, 8, T); BENCHMARK_TEMPLATE(f, 16, T)
+
+namespace {
+    template<int n, typename T>
+    RVector<n, T> RandomRVector(const unsigned seed) {
+        RVector<n, T> out;
+        Fill(out.GetData(), n, seed);
+        return out;
+    }
+
+    template<int n, typename T>
+    CVector<n, T> RandomCVector(const unsigned seed) {
+        CVector<n, T> out;
+        Fill(out.GetData(), n, seed);
+        return out;
+    }
+
+    template<int n, typename T>
+    CMatrix<n, n, T> RandomCMatrix(const unsigned seed) {
+        CMatrix<n, n, T> out;
+        Fill(out.GetData(), n * n, seed);
+        return out;
+    }
+
+    template<int n, typename T>
+    RMatrix<n, n, T> RandomRMatrix(const unsigned seed) {
+        RMatrix<n, n, T> out;
+        Fill(out.GetData(), n * n, seed);
+        return out;
+    }
+
+    /**
+     * A rotation about a tilted axis followed by a translation, invertible by every 4x4 inverse
+     */
+    CMatrix<4, 4> RigidTransform() {
+        // FromAxisAngle takes a unit axis: (1, 2, 3) / sqrt(14)
+        const float s = 1.0f / std::sqrt(14.0f);
+        const Quaternion<float> q = Quaternion<float>::FromAxisAngle(RVector<3>{ s, 2.0f * s, 3.0f * s }, 0.7f);
+        const RVector<3> x = q.Rotate(RVector<3>{ 1.0f, 0.0f, 0.0f });
+        const RVector<3> y = q.Rotate(RVector<3>{ 0.0f, 1.0f, 0.0f });
+        const RVector<3> z = q.Rotate(RVector<3>{ 0.0f, 0.0f, 1.0f });
+        return { x[0], x[1], x[2], 0.0f,
+                 y[0], y[1], y[2], 0.0f,
+                 z[0], z[1], z[2], 0.0f,
+                 4.0f, -2.0f, 7.0f, 1.0f };
+    }
+}
+
+template<int n, typename T>
+void RVectorAdd(benchmark::State &state) {
+    RVector<n, T> a = RandomRVector<n, T>(1), b = RandomRVector<n, T>(2), out;
+    for (auto _: state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(b);
+        out = a + b;
+        benchmark::DoNotOptimize(out);
+    }
+    Report(state, n, 3.0 * n * sizeof(T));
+}
+
+QS_BENCH_FIXED_SIZES(RVectorAdd, float);
+
+template<int n, typename T>
+void RVectorSub(benchmark::State &state) {
+    RVector<n, T> a = RandomRVector<n, T>(1), b = RandomRVector<n, T>(2), out;
+    for (auto _: state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(b);
+        out = a - b;
+        benchmark::DoNotOptimize(out);
+    }
+    Report(state, n, 3.0 * n * sizeof(T));
+}
+
+QS_BENCH_FIXED_SIZES(RVectorSub, float);
+
+template<int n, typename T>
+void RVectorScale(benchmark::State &state) {
+    RVector<n, T> a = RandomRVector<n, T>(1), out;
+    T scalar = T(1.5);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(scalar);
+        out = a * scalar;
+        benchmark::DoNotOptimize(out);
+    }
+    Report(state, n, 2.0 * n * sizeof(T));
+}
+
+QS_BENCH_FIXED_SIZES(RVectorScale, float);
+
+template<int n, typename T>
+void RVectorAddAssign(benchmark::State &state) {
+    RVector<n, T> a = RandomRVector<n, T>(1), b = RandomRVector<n, T>(2);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(b);
+        a += b;
+        benchmark::DoNotOptimize(a);
+    }
+    Report(state, n, 3.0 * n * sizeof(T));
+}
+
+QS_BENCH_FIXED_SIZES(RVectorAddAssign, float);
+
+template<int n, typename T>
+void RVectorDot(benchmark::State &state) {
+    RVector<n, T> a = RandomRVector<n, T>(1), b = RandomRVector<n, T>(2);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(b);
+        benchmark::DoNotOptimize(a * b);
+    }
+    Report(state, 2.0 * n, 2.0 * n * sizeof(T));
+}
+
+QS_BENCH_FIXED_SIZES(RVectorDot, float);
+QS_BENCH_FIXED_SIZES(RVectorDot, double);
+
+template<int n, typename T>
+void CVectorFused(benchmark::State &state) {
+    // a + b * s - c, one pass through the expression templates
+    CVector<n, T> a = RandomCVector<n, T>(1), b = RandomCVector<n, T>(2), c = RandomCVector<n, T>(3), out;
+    T scalar = T(0.5);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(b);
+        benchmark::DoNotOptimize(c);
+        benchmark::DoNotOptimize(scalar);
+        out = a + b * scalar - c;
+        benchmark::DoNotOptimize(out);
+    }
+    Report(state, 3.0 * n, 4.0 * n * sizeof(T));
+}
+
+QS_BENCH_FIXED_SIZES(CVectorFused, float);
+
+template<int n, typename T>
+void CMatrixAdd(benchmark::State &state) {
+    CMatrix<n, n, T> a = RandomCMatrix<n, T>(1), b = RandomCMatrix<n, T>(2), out;
+    for (auto _: state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(b);
+        out = a + b;
+        benchmark::DoNotOptimize(out);
+    }
+    Report(state, n * n, 3.0 * n * n * sizeof(T));
+}
+
+QS_BENCH_FIXED_SIZES(CMatrixAdd, float);
+
+template<int n, typename T>
+void CMatrixMultiply(benchmark::State &state) {
+    CMatrix<n, n, T> a = RandomCMatrix<n, T>(1), b = RandomCMatrix<n, T>(2), out;
+    for (auto _: state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(b);
+        out = a * b;
+        benchmark::DoNotOptimize(out);
+    }
+    Report(state, 2.0 * n * n * n, 3.0 * n * n * sizeof(T));
+}
+
+QS_BENCH_FIXED_SIZES(CMatrixMultiply, float);
+QS_BENCH_FIXED_SIZES(CMatrixMultiply, double);
+
+template<int n, typename T>
+void CMatrixVector(benchmark::State &state) {
+    CMatrix<n, n, T> a = RandomCMatrix<n, T>(1);
+    CVector<n, T> x = RandomCVector<n, T>(2), out;
+    for (auto _: state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(x);
+        out = a * x;
+        benchmark::DoNotOptimize(out);
+    }
+    Report(state, 2.0 * n * n, (n * n + 2.0 * n) * sizeof(T));
+}
+
+QS_BENCH_FIXED_SIZES(CMatrixVector, float);
+
+template<int n, typename T>
+void RMatrixMultiply(benchmark::State &state) {
+    RMatrix<n, n, T> a = RandomRMatrix<n, T>(1), b = RandomRMatrix<n, T>(2), out;
+    for (auto _: state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(b);
+        out = a * b;
+        benchmark::DoNotOptimize(out);
+    }
+    Report(state, 2.0 * n * n * n, 3.0 * n * n * sizeof(T));
+}
+
+QS_BENCH_FIXED_SIZES(RMatrixMultiply, float);
+
+template<int n, typename T>
+void RMatrixSub(benchmark::State &state) {
+    RMatrix<n, n, T> a = RandomRMatrix<n, T>(1), b = RandomRMatrix<n, T>(2), out;
+    for (auto _: state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(b);
+        out = a - b;
+        benchmark::DoNotOptimize(out);
+    }
+    Report(state, n * n, 3.0 * n * n * sizeof(T));
+}
+
+QS_BENCH_FIXED_SIZES(RMatrixSub, float);
+
+// the 4x4 inverses, from the general LU path down to the rigid transform shortcut
+
+template<class F>
+void InverseBenchmark(benchmark::State &state, F inverse, const double flops) {
+    CMatrix<4, 4> m = RigidTransform(), out;
+    for (auto _: state) {
+        benchmark::DoNotOptimize(m);
+        out = inverse(m);
+        benchmark::DoNotOptimize(out);
+    }
+    Report(state, flops, 2.0 * 16 * sizeof(float));
+}
+
+// flop counts are those of the scalar algorithms, so the rates compare like for like
+BENCHMARK_CAPTURE(InverseBenchmark, LU, [](const CMatrix<4, 4> &m) { return Inverse(m); }, 2.0 * 64 / 3 + 2.0 * 4 * 16);
+BENCHMARK_CAPTURE(InverseBenchmark, Cofactor, [](const CMatrix<4, 4> &m) { return Inverse4x4(m); }, 176.0);
+BENCHMARK_CAPTURE(InverseBenchmark, Affine, [](const CMatrix<4, 4> &m) { return AffineInverse(m); }, 78.0);
+BENCHMARK_CAPTURE(InverseBenchmark, Rigid, [](const CMatrix<4, 4> &m) { return RigidInverse(m); }, 15.0);
+
+void QuaternionRotate(benchmark::State &state) {
+    Quaternion<float> q = Quaternion<float>::FromAxisAngle(RVector<3>{ 0.0f, 1.0f, 0.0f }, 0.3f);
+    RVector<3> v = { 1.0f, 2.0f, 3.0f }, out;
+    for (auto _: state) {
+        benchmark::DoNotOptimize(q);
+        benchmark::DoNotOptimize(v);
+        out = q.Rotate(v);
+        benchmark::DoNotOptimize(out);
+    }
+    // v + 2 w (q x v) + 2 q x (q x v)
+    Report(state, 30.0, 10.0 * sizeof(float));
+}
+
+BENCHMARK(QuaternionRotate);
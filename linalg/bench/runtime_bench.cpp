@@ -0,0 +1,266 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <vector>
+
+#include "bench.h"
+
+#include "linalg/blas.h"
+#include "linalg/dispatch.h"
+#include "linalg/dmatrix.h"
+#include "linalg/dvector.h"
+#include "linalg/packed.h"
+#include "linalg/quaternion.h"
+#include "linalg/reduce.h"
+#include "linalg/sparse.h"
+#include "linalg/transform.h"
+#include "linalg/vector_array.h"
+
+using namespace QS::LinAlg;
+using namespace QS::LinAlg::Bench;
+
+// Runtime sized operators. Vector lengths run to 4096^2 elements so the largest sizes stream from
+// memory; matrix dimensions run to 4096. Streams of several floats per element stop at 2^21
+// elements, which is already well past the last level cache.
+
+namespace {
+    // the report names the instruction set the dispatched kernels ran on
+    [[maybe_unused]] const bool kTierContext =
+            (benchmark::AddCustomContext("linalg_tier", Dispatch::GetTierName(Dispatch::GetTier())), true);
+
+    DVector<float> RandomDVector(const size_t n, const unsigned seed) {
+        DVector<float> out(n);
+        Fill(out.GetData(), n, seed);
+        return out;
+    }
+
+    template<Layout layout = Layout::RowMajor>
+    DMatrix<float, layout> RandomDMatrix(const size_t rows, const size_t cols, const unsigned seed) {
+        DMatrix<float, layout> out(rows, cols);
+        Fill(out.GetData(), out.GetSize(), seed);
+        return out;
+    }
+
+    void VectorSizes(benchmark::internal::Benchmark *b) {
+        b->RangeMultiplier(8)->Range(64, 4096 * 4096);
+    }
+
+    void MatrixSizes(benchmark::internal::Benchmark *b) {
+        b->RangeMultiplier(4)->Range(64, 4096);
+    }
+}
+
+void DVectorAdd(benchmark::State &state) {
+    const size_t n = state.range(0);
+    const DVector<float> a = RandomDVector(n, 1), b = RandomDVector(n, 2);
+    for (auto _: state) {
+        DVector<float> out = a + b;
+        benchmark::DoNotOptimize(out.GetData());
+    }
+    Report(state, n, 3.0 * n * sizeof(float));
+}
+
+BENCHMARK(DVectorAdd)->Apply(VectorSizes);
+
+void DVectorAddAssign(benchmark::State &state) {
+    const size_t n = state.range(0);
+    DVector<float> a = RandomDVector(n, 1);
+    const DVector<float> b = RandomDVector(n, 2);
+    for (auto _: state) {
+        a += b;
+        benchmark::DoNotOptimize(a.GetData());
+    }
+    Report(state, n, 3.0 * n * sizeof(float));
+}
+
+BENCHMARK(DVectorAddAssign)->Apply(VectorSizes);
+
+void DVectorScale(benchmark::State &state) {
+    const size_t n = state.range(0);
+    const DVector<float> a = RandomDVector(n, 1);
+    for (auto _: state) {
+        DVector<float> out = a * 1.5f;
+        benchmark::DoNotOptimize(out.GetData());
+    }
+    Report(state, n, 2.0 * n * sizeof(float));
+}
+
+BENCHMARK(DVectorScale)->Apply(VectorSizes);
+
+void DVectorDot(benchmark::State &state) {
+    const size_t n = state.range(0);
+    const DVector<float> a = RandomDVector(n, 1), b = RandomDVector(n, 2);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(a * b);
+    }
+    Report(state, 2.0 * n, 2.0 * n * sizeof(float));
+}
+
+BENCHMARK(DVectorDot)->Apply(VectorSizes);
+
+// mode is 0 for Summation::Fast, 1 for Pairwise and 2 for Kahan
+void DVectorDotSummation(benchmark::State &state) {
+    const size_t n = state.range(0);
+    const auto mode = static_cast<Summation>(state.range(1));
+    const DVector<float> a = RandomDVector(n, 1), b = RandomDVector(n, 2);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(Dot(a, b, mode));
+    }
+    Report(state, 2.0 * n, 2.0 * n * sizeof(float));
+}
+
+BENCHMARK(DVectorDotSummation)->ArgsProduct({ { 1 << 10, 1 << 16, 1 << 22 }, { 0, 1, 2 } })->ArgNames({ "n", "mode" });
+
+void DMatrixAdd(benchmark::State &state) {
+    const size_t n = state.range(0);
+    const DMatrix<float> a = RandomDMatrix(n, n, 1), b = RandomDMatrix(n, n, 2);
+    for (auto _: state) {
+        DMatrix<float> out = a + b;
+        benchmark::DoNotOptimize(out.GetData());
+    }
+    Report(state, static_cast<double>(n) * n, 3.0 * n * n * sizeof(float));
+}
+
+BENCHMARK(DMatrixAdd)->Apply(MatrixSizes);
+
+template<Layout layout>
+void DMatrixVector(benchmark::State &state) {
+    const size_t n = state.range(0);
+    const DMatrix<float, layout> a = RandomDMatrix<layout>(n, n, 1);
+    const DVector<float> x = RandomDVector(n, 2);
+    for (auto _: state) {
+        DVector<float> out = a * x;
+        benchmark::DoNotOptimize(out.GetData());
+    }
+    Report(state, 2.0 * n * n, (static_cast<double>(n) * n + 2.0 * n) * sizeof(float));
+}
+
+BENCHMARK_TEMPLATE(DMatrixVector, Layout::RowMajor)->Apply(MatrixSizes);
+BENCHMARK_TEMPLATE(DMatrixVector, Layout::ColumnMajor)->Apply(MatrixSizes);
+
+void DMatrixMultiply(benchmark::State &state) {
+    const size_t n = state.range(0);
+    const DMatrix<float> a = RandomDMatrix(n, n, 1), b = RandomDMatrix(n, n, 2);
+    for (auto _: state) {
+        DMatrix<float> out = a * b;
+        benchmark::DoNotOptimize(out.GetData());
+    }
+    Report(state, 2.0 * n * n * n, 3.0 * n * n * sizeof(float));
+}
+
+BENCHMARK(DMatrixMultiply)->Apply(MatrixSizes)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+void BlasGemm(benchmark::State &state) {
+    // c = a b + c in place, against DMatrixMultiply which also allocates c
+    const size_t n = state.range(0);
+    const DMatrix<float> a = RandomDMatrix(n, n, 1), b = RandomDMatrix(n, n, 2);
+    DMatrix<float> c = RandomDMatrix(n, n, 3);
+    for (auto _: state) {
+        Blas::Gemm(1.0f, a, b, 1.0f, c);
+        benchmark::DoNotOptimize(c.GetData());
+    }
+    Report(state, 2.0 * n * n * n, 4.0 * n * n * sizeof(float));
+}
+
+BENCHMARK(BlasGemm)->Apply(MatrixSizes)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+void SparseMultiply(benchmark::State &state) {
+    // the five point Laplacian of an n x n grid
+    const size_t n = state.range(0);
+    const size_t size = n * n;
+    std::vector<Triplet<float>> triplets;
+    triplets.reserve(5 * size);
+    for (size_t i = 0; i < size; ++i) {
+        triplets.push_back({ i, i, 4.0f });
+        if (i % n > 0) triplets.push_back({ i, i - 1, -1.0f });
+        if (i % n + 1 < n) triplets.push_back({ i, i + 1, -1.0f });
+        if (i >= n) triplets.push_back({ i, i - n, -1.0f });
+        if (i + n < size) triplets.push_back({ i, i + n, -1.0f });
+    }
+    const CsrMatrix<float> a = CsrMatrix<float>::FromTriplets(size, size, triplets);
+    const DVector<float> x = RandomDVector(size, 1);
+    for (auto _: state) {
+        DVector<float> out = a * x;
+        benchmark::DoNotOptimize(out.GetData());
+    }
+    const double nonZeros = static_cast<double>(a.GetNonZeroCount());
+    // values and indices once, x gathered once per non zero, y written once
+    Report(state, 2.0 * nonZeros, nonZeros * (2 * sizeof(float) + sizeof(uint32_t)) + size * sizeof(float));
+}
+
+BENCHMARK(SparseMultiply)->RangeMultiplier(4)->Range(64, 1024)->UseRealTime();
+
+void VectorArrayAdd(benchmark::State &state) {
+    const size_t n = state.range(0);
+    VectorArray<4> a(n), b(n);
+    for (size_t c = 0; c < 4; ++c) {
+        Fill(a.GetLane(c), n, 1 + c);
+        Fill(b.GetLane(c), n, 5 + c);
+    }
+    for (auto _: state) {
+        VectorArray<4> out = a + b;
+        benchmark::DoNotOptimize(out.GetLane(0));
+    }
+    Report(state, 4.0 * n, 3.0 * 4 * n * sizeof(float));
+}
+
+BENCHMARK(VectorArrayAdd)->RangeMultiplier(8)->Range(64, 1 << 21);
+
+void TransformStream(benchmark::State &state) {
+    // interleaved position, normal, uv vertices as Geometry<8> lays them out
+    constexpr size_t stride = 8;
+    const size_t n = state.range(0);
+    std::vector<float> in(n * stride), out(n * stride);
+    Fill(in.data(), in.size(), 1);
+    CMatrix<4, 4> m = { 1.0f, 0.0f, 0.0f, 0.0f,
+                        0.0f, 0.0f, 1.0f, 0.0f,
+                        0.0f, -1.0f, 0.0f, 0.0f,
+                        3.0f, 2.0f, 1.0f, 1.0f };
+    for (auto _: state) {
+        TransformPositions(m, in.data(), stride, out.data(), stride, n);
+        benchmark::DoNotOptimize(out.data());
+    }
+    Report(state, 18.0 * n, 2.0 * 3 * n * sizeof(float));
+    state.SetItemsProcessed(static_cast<int64_t>(n * state.iterations()));
+}
+
+BENCHMARK(TransformStream)->RangeMultiplier(8)->Range(64, 1 << 21);
+
+template<class P>
+void PackUnpack(benchmark::State &state) {
+    const size_t n = state.range(0);
+    std::vector<float> in(n), out(n);
+    std::vector<P> packed(n);
+    Fill(in.data(), n, 1);
+    for (auto _: state) {
+        Pack(in.data(), packed.data(), n);
+        Unpack(packed.data(), out.data(), n);
+        benchmark::DoNotOptimize(out.data());
+    }
+    Report(state, 0.0, 2.0 * n * (sizeof(float) + sizeof(P)));
+}
+
+BENCHMARK_TEMPLATE(PackUnpack, Half)->Apply(VectorSizes);
+BENCHMARK_TEMPLATE(PackUnpack, UNorm8)->Apply(VectorSizes);
+BENCHMARK_TEMPLATE(PackUnpack, UNorm16)->Apply(VectorSizes);
+
+void QuaternionSlerp(benchmark::State &state) {
+    const size_t n = state.range(0);
+    std::vector<Quaternion<float>> from(n), to(n), out(n);
+    std::vector<float> t(n);
+    Fill(t.data(), n, 1);
+    for (size_t i = 0; i < n; ++i) {
+        from[i] = Quaternion<float>::FromAxisAngle(RVector<3>{ 0.0f, 1.0f, 0.0f }, t[i]);
+        to[i] = Quaternion<float>::FromAxisAngle(RVector<3>{ 1.0f, 0.0f, 0.0f }, 2.0f * t[i]);
+        t[i] = 0.5f + 0.5f * t[i];
+    }
+    for (auto _: state) {
+        Slerp(from.data(), to.data(), t.data(), out.data(), n);
+        benchmark::DoNotOptimize(out.data());
+    }
+    Report(state, 0.0, n * (13.0 * sizeof(float)));
+    state.SetItemsProcessed(static_cast<int64_t>(n * state.iterations()));
+}
+
+BENCHMARK(QuaternionSlerp)->RangeMultiplier(8)->Range(64, 1 << 21);
@@ -0,0 +1,154 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_ALIGNED_BUFFER_H
+#define DRAWING_ALIGNED_BUFFER_H
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace QS::LinAlg {
+
+    /// alignment of heap storage, one cache line
+    constexpr size_t kCacheLineSize = 64;
+
+    /**
+     * The smallest power of two at least the size of count T, capped at one cache line, e.g. 16 for
+     * 3 or 4 floats and 64 for 9 to 16. Objects aligned to it are padded to a multiple of it, so in
+     * an array none of them straddles a cache line and each starts on a SIMD register boundary.
+     */
+    template<typename T, size_t count>
+    constexpr size_t PaddedAlignment() noexcept {
+        size_t out = alignof(T);
+        while (out < count * sizeof(T) && out < kCacheLineSize) {
+            out *= 2;
+        }
+        return out;
+    }
+
+    /**
+     * Owning, move-only, zero initialized heap array whose first element is aligned to alignment
+     * bytes.
+     */
+    template<typename T, size_t alignment = kCacheLineSize>
+    class AlignedBuffer {
+    public:
+        static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                      "AlignedBuffer holds trivial element types only");
+        static_assert(alignment >= alignof(T) && (alignment & (alignment - 1)) == 0,
+                      "alignment must be a power of two no smaller than the element alignment");
+
+        AlignedBuffer() noexcept = default;
+
+        /**
+         * allocates size zeroed elements
+         * \param size number of elements
+         */
+        explicit AlignedBuffer(const size_t size) : mSize{size} {
+            if (size != 0) {
+                mData = static_cast<T *>(::operator new(size * sizeof(T), std::align_val_t{alignment}));
+                for (size_t i = 0; i < size; ++i) {
+                    new(mData + i) T();
+                }
+            }
+        }
+
+        ~AlignedBuffer() {
+            Release();
+        }
+
+        AlignedBuffer(const AlignedBuffer &) = delete;
+
+        AlignedBuffer &operator=(const AlignedBuffer &) = delete;
+
+        AlignedBuffer(AlignedBuffer &&other) noexcept
+                : mData{std::exchange(other.mData, nullptr)}, mSize{std::exchange(other.mSize, 0)} {}
+
+        AlignedBuffer &operator=(AlignedBuffer &&other) noexcept {
+            if (this != &other) {
+                Release();
+                mData = std::exchange(other.mData, nullptr);
+                mSize = std::exchange(other.mSize, 0);
+            }
+            return *this;
+        }
+
+        [[nodiscard]] size_t GetSize() const noexcept { return mSize; }
+
+        [[nodiscard]] T *GetData() noexcept { return mData; }
+
+        [[nodiscard]] const T *GetData() const noexcept { return mData; }
+
+        [[nodiscard]] T &operator[](const size_t idx) noexcept { return mData[idx]; }
+
+        [[nodiscard]] const T &operator[](const size_t idx) const noexcept { return mData[idx]; }
+
+    private:
+        void Release() noexcept {
+            if (mData != nullptr) {
+                ::operator delete(mData, std::align_val_t{alignment});
+                mData = nullptr;
+            }
+            mSize = 0;
+        }
+
+        /// first element
+        T *mData = nullptr;
+
+        /// number of elements
+        size_t mSize = 0;
+    };
+
+    /**
+     * Standard allocator whose storage starts on an alignment byte boundary, by default a cache
+     * line, or on the alignment of T if that is larger. With it, e.g. AlignedVector<PaddedRVector<4>>,
+     * element i of a container sits at a fixed offset within its cache line.
+     */
+    template<typename T, size_t alignment = kCacheLineSize>
+    class AlignedAllocator {
+    public:
+        static_assert((alignment & (alignment - 1)) == 0, "alignment must be a power of two");
+
+        using value_type = T;
+
+        /// alignment of every allocation
+        static constexpr size_t kAlignment = alignment > alignof(T) ? alignment : alignof(T);
+
+        template<typename U>
+        struct rebind {
+            using other = AlignedAllocator<U, alignment>;
+        };
+
+        constexpr AlignedAllocator() noexcept = default;
+
+        template<typename U>
+        constexpr AlignedAllocator(const AlignedAllocator<U, alignment> &) noexcept {}
+
+        [[nodiscard]] T *allocate(const size_t n) {
+            if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+                throw std::bad_array_new_length();
+            }
+            return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t{kAlignment}));
+        }
+
+        void deallocate(T *p, size_t) noexcept {
+            ::operator delete(p, std::align_val_t{kAlignment});
+        }
+
+        template<typename U>
+        constexpr bool operator==(const AlignedAllocator<U, alignment> &) const noexcept { return true; }
+    };
+
+    /**
+     * std::vector over AlignedAllocator
+     */
+    template<typename T, size_t alignment = kCacheLineSize>
+    using AlignedVector = std::vector<T, AlignedAllocator<T, alignment>>;
+}
+
+#endif //DRAWING_ALIGNED_BUFFER_H
@@ -0,0 +1,418 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_BLAS_H
+#define DRAWING_BLAS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "dmatrix.h"
+#include "dvector.h"
+#include "expression.h"
+#include "gemm.h"
+#include "parallel.h"
+#include "simd.h"
+#include "view.h"
+
+/**
+ * BLAS shaped kernels that update their output in place, for code ported from BLAS or written
+ * against it. Every kernel reads each operand once and writes the output once; none allocate.
+ *
+ *  Level 1  Axpy   y = alpha * x + y
+ *           Axpby  y = alpha * x + beta * y
+ *           Scal   x = alpha * x
+ *           Copy   y = x
+ *           Swap   x <-> y
+ *           Dot    x . y
+ *  Level 2  Gemv   y = alpha * A x + beta * y
+ *           Ger    A = alpha * x y^T + A
+ *  Level 3  Gemm   C = alpha * A B + beta * C
+ *
+ * The fixed size overloads take RVector, CVector, RMatrix, CMatrix, their views and maps as output
+ * and any expression of the right shape as input. Level 1 kernels also work on matrices. There are
+ * no transpose flags: pass Transpose(a) (see view.h), which reads a in place. The runtime sized
+ * overloads take DVector and DMatrix of either layout, throw std::invalid_argument on mismatched
+ * dimensions and split large work across the thread pool like the operators do.
+ *
+ * As in BLAS a beta of zero does not read the output, so it may be uninitialized. The output of
+ * Gemv, Ger and Gemm must not overlap their inputs.
+ */
+namespace QS::LinAlg::Blas {
+
+    namespace Detail {
+        /// element type of a writable vector or matrix, or of a view of one
+        template<class E>
+        using ElementOf = Expr::ValueOf<E>;
+
+        /**
+         * Calls f(element, i) on every element of a vector, or f(element, outer, inner) on every
+         * element of a matrix, where element is a writable reference
+         */
+        template<class Y, typename F>
+        constexpr void ForEach(Y &&y, F f) {
+            using Shape = Expr::ShapeOf<Y>;
+            if constexpr (Expr::VectorExpression<Y>) {
+                for (size_t i = 0; i < Shape::length; ++i) {
+                    f(y[i], i);
+                }
+            } else {
+                for (size_t i = 0; i < Shape::outer; ++i) {
+                    for (size_t j = 0; j < Shape::inner; ++j) {
+                        f(y[i][j], i, j);
+                    }
+                }
+            }
+        }
+
+        /// writable element at row r and column c of a fixed size matrix or view
+        template<class M>
+        constexpr decltype(auto) Ref(M &m, const size_t r, const size_t c) {
+            if constexpr (Expr::IsRowMajor<Expr::ShapeOf<M>>::value) {
+                return m[r][c];
+            } else {
+                return m[c][r];
+            }
+        }
+
+        /**
+         * out = alpha * value, or alpha * value + beta * out when beta is not zero
+         */
+        template<typename T, typename R>
+        constexpr void Scaled(R &out, const T value, const T alpha, const T beta) {
+            if (beta == T()) {
+                out = alpha * value;
+            } else {
+                out = alpha * value + beta * out;
+            }
+        }
+
+        template<typename T, Layout layout>
+        [[nodiscard]] constexpr LinAlg::Gemm::Strided<const T> Reader(const DMatrix<T, layout> &m) {
+            return {m.GetData(), m.GetRowStride(), m.GetColStride()};
+        }
+
+        template<typename T, Layout layout>
+        [[nodiscard]] constexpr LinAlg::Gemm::Strided<T> Writer(DMatrix<T, layout> &m) {
+            return {m.GetData(), m.GetRowStride(), m.GetColStride()};
+        }
+    }
+
+    // fixed size
+
+    /**
+     * y = alpha * x + y for vectors or matrices of the same shape
+     */
+    template<class X, class Y> requires Expr::Expression<X> && Expr::Expression<Y>
+    constexpr void Axpy(const Detail::ElementOf<Y> alpha, const X &x, Y &&y) {
+        static_assert(std::is_same_v<Expr::ShapeOf<X>, Expr::ShapeOf<Y>>, "x and y have differing dimensions");
+        if constexpr (Expr::VectorExpression<Y>) {
+            Detail::ForEach(y, [&](auto &e, size_t i) { e += alpha * x.Eval(i); });
+        } else {
+            Detail::ForEach(y, [&](auto &e, size_t i, size_t j) { e += alpha * x.Eval(i, j); });
+        }
+    }
+
+    /**
+     * y = alpha * x + beta * y for vectors or matrices of the same shape
+     */
+    template<class X, class Y> requires Expr::Expression<X> && Expr::Expression<Y>
+    constexpr void Axpby(const Detail::ElementOf<Y> alpha, const X &x, const Detail::ElementOf<Y> beta, Y &&y) {
+        static_assert(std::is_same_v<Expr::ShapeOf<X>, Expr::ShapeOf<Y>>, "x and y have differing dimensions");
+        using T = Detail::ElementOf<Y>;
+        if constexpr (Expr::VectorExpression<Y>) {
+            Detail::ForEach(y, [&](auto &e, size_t i) { Detail::Scaled<T>(e, x.Eval(i), alpha, beta); });
+        } else {
+            Detail::ForEach(y, [&](auto &e, size_t i, size_t j) { Detail::Scaled<T>(e, x.Eval(i, j), alpha, beta); });
+        }
+    }
+
+    /**
+     * x = alpha * x
+     */
+    template<class X> requires Expr::Expression<X>
+    constexpr void Scal(const Detail::ElementOf<X> alpha, X &&x) {
+        Detail::ForEach(x, [alpha](auto &e, auto...) { e *= alpha; });
+    }
+
+    /**
+     * y = x for vectors or matrices of the same shape. Unlike assignment, x may be a vector of the
+     * other orientation.
+     */
+    template<class X, class Y> requires Expr::Expression<X> && Expr::Expression<Y>
+    constexpr void Copy(const X &x, Y &&y) {
+        if constexpr (Expr::VectorExpression<Y>) {
+            static_assert(Expr::ShapeOf<X>::length == Expr::ShapeOf<Y>::length, "x and y have differing lengths");
+            Detail::ForEach(y, [&](auto &e, size_t i) { e = x.Eval(i); });
+        } else {
+            static_assert(std::is_same_v<Expr::ShapeOf<X>, Expr::ShapeOf<Y>>, "x and y have differing dimensions");
+            Detail::ForEach(y, [&](auto &e, size_t i, size_t j) { e = x.Eval(i, j); });
+        }
+    }
+
+    /**
+     * Exchanges the elements of two vectors or matrices of the same shape
+     */
+    template<class X, class Y> requires Expr::Expression<X> && Expr::Expression<Y>
+    constexpr void Swap(X &&x, Y &&y) {
+        static_assert(std::is_same_v<Expr::ShapeOf<X>, Expr::ShapeOf<Y>>, "x and y have differing dimensions");
+        if constexpr (Expr::VectorExpression<Y>) {
+            Detail::ForEach(y, [&](auto &e, size_t i) { std::swap(e, x[i]); });
+        } else {
+            Detail::ForEach(y, [&](auto &e, size_t i, size_t j) { std::swap(e, x[i][j]); });
+        }
+    }
+
+    /**
+     * x . y, which may be a row and a column vector
+     */
+    template<class X, class Y> requires Expr::VectorExpression<X> && Expr::VectorExpression<Y>
+    [[nodiscard]] constexpr auto Dot(const X &x, const Y &y) {
+        static_assert(Expr::ShapeOf<X>::length == Expr::ShapeOf<Y>::length, "x and y have differing lengths");
+        if constexpr (std::is_same_v<Expr::ShapeOf<X>, Expr::ShapeOf<Y>>) {
+            return Expr::Dot(x, y);
+        } else {
+            using T = decltype(x.Eval(0) * y.Eval(0));
+            return static_cast<T>(Expr::AccumulateDot<Expr::AccumulatorOf<T>>(x, y));
+        }
+    }
+
+    /**
+     * y = alpha * a x + beta * y. Each element of y is summed once, in the accumulator type, and
+     * written once.
+     */
+    template<class A, class X, class Y>
+    requires Expr::MatrixExpression<A> && Expr::VectorExpression<X> && Expr::VectorExpression<Y>
+    constexpr void Gemv(const Detail::ElementOf<Y> alpha, const A &a, const X &x, const Detail::ElementOf<Y> beta,
+                        Y &&y) {
+        constexpr size_t rows = Expr::ShapeOf<A>::rows;
+        constexpr size_t cols = Expr::ShapeOf<A>::cols;
+        static_assert(cols == Expr::ShapeOf<X>::length, "a matrix columns != x vector length");
+        static_assert(rows == Expr::ShapeOf<Y>::length, "a matrix rows != y vector length");
+        using T = Detail::ElementOf<Y>;
+        using Acc = Expr::AccumulatorOf<T>;
+
+        if constexpr (!Expr::Addressable<A>) {
+            Gemv(alpha, CMatrix<cols, rows, Expr::ValueOf<A>>(a), x, beta, y);
+        } else {
+            Detail::ForEach(y, [&](auto &e, size_t r) {
+                Acc sum{};
+                for (size_t c = 0; c < cols; ++c) {
+                    sum += static_cast<Acc>(Expr::At(a, r, c)) * static_cast<Acc>(x.Eval(c));
+                }
+                Detail::Scaled<T>(e, static_cast<T>(sum), alpha, beta);
+            });
+        }
+    }
+
+    /**
+     * a = alpha * x y^T + a, the rank one update
+     */
+    template<class X, class Y, class A>
+    requires Expr::VectorExpression<X> && Expr::VectorExpression<Y> && Expr::MatrixExpression<A>
+    constexpr void Ger(const Detail::ElementOf<A> alpha, const X &x, const Y &y, A &&a) {
+        static_assert(Expr::ShapeOf<A>::rows == Expr::ShapeOf<X>::length, "a matrix rows != x vector length");
+        static_assert(Expr::ShapeOf<A>::cols == Expr::ShapeOf<Y>::length, "a matrix columns != y vector length");
+        for (size_t r = 0; r < Expr::ShapeOf<A>::rows; ++r) {
+            const auto ax = alpha * x.Eval(r);
+            for (size_t c = 0; c < Expr::ShapeOf<A>::cols; ++c) {
+                Detail::Ref(a, r, c) += ax * y.Eval(c);
+            }
+        }
+    }
+
+    /**
+     * c = alpha * a b + beta * c with the blocked kernel of the matrix product, which writes every
+     * element of c once per slice of the shared dimension instead of building a b first
+     */
+    template<class A, class B, class C>
+    requires Expr::MatrixExpression<A> && Expr::MatrixExpression<B> && Expr::MatrixExpression<C>
+    constexpr void Gemm(const Detail::ElementOf<C> alpha, const A &a, const B &b, const Detail::ElementOf<C> beta,
+                        C &&c) {
+        constexpr size_t m = Expr::ShapeOf<A>::rows;
+        constexpr size_t k = Expr::ShapeOf<A>::cols;
+        constexpr size_t n = Expr::ShapeOf<B>::cols;
+        static_assert(k == Expr::ShapeOf<B>::rows, "a matrix columns != b matrix rows");
+        static_assert(m == Expr::ShapeOf<C>::rows && n == Expr::ShapeOf<C>::cols, "c has the wrong dimensions");
+        using T = Detail::ElementOf<C>;
+        using Acc = Expr::AccumulatorOf<T>;
+
+        if constexpr (!Expr::Addressable<A>) {
+            Gemm(alpha, CMatrix<k, m, Expr::ValueOf<A>>(a), b, beta, c);
+        } else if constexpr (!Expr::Addressable<B>) {
+            Gemm(alpha, a, CMatrix<n, k, Expr::ValueOf<B>>(b), beta, c);
+        } else {
+            LinAlg::Gemm::MultiplyAdd<Acc>(m, n, k, static_cast<Acc>(alpha),
+                                           [&a](size_t i, size_t p) { return Expr::At(a, i, p); },
+                                           [&b](size_t p, size_t j) { return Expr::At(b, p, j); },
+                                           static_cast<Acc>(beta),
+                                           [&c](size_t i, size_t j) -> T & { return Detail::Ref(c, i, j); });
+        }
+    }
+
+    // runtime sized
+
+    /**
+     * y = alpha * x + y
+     */
+    template<typename T>
+    void Axpy(const std::type_identity_t<T> alpha, const DVector<T> &x, DVector<T> &y) {
+        y.CheckSameSize(x);
+        Parallel::Axpy(alpha, x.GetData(), y.GetData(), y.GetSize());
+    }
+
+    /**
+     * y = alpha * x + beta * y
+     */
+    template<typename T>
+    void Axpby(const std::type_identity_t<T> alpha, const DVector<T> &x, const std::type_identity_t<T> beta,
+               DVector<T> &y) {
+        y.CheckSameSize(x);
+        Parallel::Axpby(alpha, x.GetData(), beta, y.GetData(), y.GetSize());
+    }
+
+    /**
+     * x = alpha * x
+     */
+    template<typename T>
+    void Scal(const std::type_identity_t<T> alpha, DVector<T> &x) {
+        Parallel::Scale(x.GetData(), alpha, x.GetData(), x.GetSize());
+    }
+
+    /**
+     * y = x without reallocating y
+     */
+    template<typename T>
+    void Copy(const DVector<T> &x, DVector<T> &y) {
+        y.CheckSameSize(x);
+        std::copy(x.GetData(), x.GetData() + x.GetSize(), y.GetData());
+    }
+
+    /**
+     * Exchanges the elements of x and y, which keep their storage
+     */
+    template<typename T>
+    void Swap(DVector<T> &x, DVector<T> &y) {
+        y.CheckSameSize(x);
+        std::swap_ranges(x.GetData(), x.GetData() + x.GetSize(), y.GetData());
+    }
+
+    template<typename T>
+    [[nodiscard]] T Dot(const DVector<T> &x, const DVector<T> &y) {
+        y.CheckSameSize(x);
+        return Parallel::Dot(x.GetData(), y.GetData(), x.GetSize());
+    }
+
+    /**
+     * a = alpha * b + a for matrices of any layouts
+     */
+    template<typename T, Layout aLayout, Layout bLayout>
+    void Axpy(const std::type_identity_t<T> alpha, const DMatrix<T, bLayout> &b, DMatrix<T, aLayout> &a) {
+        a.CheckSameDimensions(b);
+        if constexpr (aLayout == bLayout) {
+            Parallel::Axpy(alpha, b.GetData(), a.GetData(), a.GetSize());
+        } else {
+            for (size_t i = 0; i < a.GetRows(); ++i) {
+                for (size_t j = 0; j < a.GetCols(); ++j) {
+                    a(i, j) += alpha * b(i, j);
+                }
+            }
+        }
+    }
+
+    /**
+     * a = alpha * a
+     */
+    template<typename T, Layout layout>
+    void Scal(const std::type_identity_t<T> alpha, DMatrix<T, layout> &a) {
+        a *= alpha;
+    }
+
+    /**
+     * y = alpha * a x + beta * y. Row major matrices take one dot product per row, column major
+     * ones scale y and add one column at a time, so a is streamed once in either layout. Large
+     * products split y into ranges across the thread pool.
+     */
+    template<typename T, Layout layout>
+    void Gemv(const std::type_identity_t<T> alpha, const DMatrix<T, layout> &a, const DVector<T> &x,
+              const std::type_identity_t<T> beta, DVector<T> &y) {
+        if (a.GetCols() != x.GetSize()) {
+            throw std::invalid_argument("a matrix columns != x vector length");
+        }
+        if (a.GetRows() != y.GetSize()) {
+            throw std::invalid_argument("a matrix rows != y vector length");
+        }
+        const size_t rows = a.GetRows(), cols = a.GetCols();
+        const T *in = a.GetData();
+        T *out = y.GetData();
+        // every task owns a range of y
+        Parallel::Apply(rows, [=, &x](size_t begin, size_t end) {
+            if constexpr (layout == Layout::RowMajor) {
+                for (size_t i = begin; i < end; ++i) {
+                    Detail::Scaled(out[i], Simd::Dot(in + i * cols, x.GetData(), cols), T(alpha), T(beta));
+                }
+            } else {
+                if (beta == T()) {
+                    std::fill(out + begin, out + end, T());
+                } else {
+                    Simd::Scale(out + begin, beta, out + begin, end - begin);
+                }
+                for (size_t j = 0; j < cols; ++j) {
+                    Simd::Axpy(alpha * x[j], in + j * rows + begin, out + begin, end - begin);
+                }
+            }
+        }, cols);
+    }
+
+    /**
+     * a = alpha * x y^T + a, one Axpy per row or column of a, with the rows or columns split across
+     * the thread pool
+     */
+    template<typename T, Layout layout>
+    void Ger(const std::type_identity_t<T> alpha, const DVector<T> &x, const DVector<T> &y, DMatrix<T, layout> &a) {
+        if (a.GetRows() != x.GetSize()) {
+            throw std::invalid_argument("a matrix rows != x vector length");
+        }
+        if (a.GetCols() != y.GetSize()) {
+            throw std::invalid_argument("a matrix columns != y vector length");
+        }
+        const size_t rows = a.GetRows(), cols = a.GetCols();
+        T *out = a.GetData();
+        if constexpr (layout == Layout::RowMajor) {
+            Parallel::Apply(rows, [=, &x, &y](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    Simd::Axpy(alpha * x[i], y.GetData(), out + i * cols, cols);
+                }
+            }, cols);
+        } else {
+            Parallel::Apply(cols, [=, &x, &y](size_t begin, size_t end) {
+                for (size_t j = begin; j < end; ++j) {
+                    Simd::Axpy(alpha * y[j], x.GetData(), out + j * rows, rows);
+                }
+            }, rows);
+        }
+    }
+
+    /**
+     * c = alpha * a b + beta * c for matrices of any layouts, split across the thread pool like the
+     * matrix product, see Parallel::MultiplyAdd
+     */
+    template<typename T, Layout aLayout, Layout bLayout, Layout cLayout>
+    void Gemm(const std::type_identity_t<T> alpha, const DMatrix<T, aLayout> &a, const DMatrix<T, bLayout> &b,
+              const std::type_identity_t<T> beta, DMatrix<T, cLayout> &c) {
+        if (a.GetCols() != b.GetRows()) {
+            throw std::invalid_argument("lhs matrix columns != rhs matrix rows");
+        }
+        if (c.GetRows() != a.GetRows() || c.GetCols() != b.GetCols()) {
+            throw std::invalid_argument("output matrix has the wrong dimensions");
+        }
+        Parallel::MultiplyAdd<T>(a.GetRows(), b.GetCols(), a.GetCols(), alpha, Detail::Reader(a), Detail::Reader(b),
+                                 beta, Detail::Writer(c));
+    }
+}
+
+#endif //DRAWING_BLAS_H
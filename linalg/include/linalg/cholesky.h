@@ -0,0 +1,473 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_CHOLESKY_H
+#define DRAWING_CHOLESKY_H
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "dmatrix.h"
+#include "dvector.h"
+#include "expression.h"
+#include "lu.h"
+#include "parallel.h"
+#include "unroll.h"
+
+/**
+ * Factorizations of symmetric matrices: Cholesky, A = L * L^T for positive definite A, and
+ * A = L * D * L^T with unit lower triangular L for any symmetric A whose leading minors are
+ * nonsingular. Both do half the work of LU and read only the lower triangle of A.
+ */
+namespace QS::LinAlg {
+
+    namespace Detail {
+        /**
+         * Right-looking blocked factorization of the lower triangle of a in place, leaving L below
+         * the diagonal and, for LDL^T, D on it. Columns are factored in panels of blockSize, each
+         * down to the last row, and the lower triangle of the trailing submatrix is updated with one
+         * matrix product per panel, which runs on the thread pool for large matrices.
+         * \tparam ldlt false for Cholesky, true for LDL^T
+         * \return false on a pivot that is not positive (Cholesky) or zero (LDL^T)
+         */
+        template<bool ldlt, typename T, Layout layout>
+        bool FactorSymmetric(DMatrix<T, layout> &a, const size_t blockSize) {
+            const size_t n = a.GetRows();
+            // L(j, k) * D(k) for LDL^T, L(j, k) for Cholesky
+            const auto scaled = [&a](size_t j, size_t k) { return ldlt ? a(j, k) * a(k, k) : a(j, k); };
+            for (size_t k0 = 0; k0 < n; k0 += blockSize) {
+                const size_t k1 = k0 + blockSize < n ? k0 + blockSize : n;
+                for (size_t j = k0; j < k1; ++j) {
+                    T pivot = a(j, j);
+                    for (size_t k = k0; k < j; ++k) {
+                        pivot -= a(j, k) * scaled(j, k);
+                    }
+                    if (ldlt ? pivot == T() : !(pivot > T())) {
+                        return false;
+                    }
+                    a(j, j) = ldlt ? pivot : std::sqrt(pivot);
+                    for (size_t i = j + 1; i < n; ++i) {
+                        T sum = a(i, j);
+                        for (size_t k = k0; k < j; ++k) {
+                            sum -= a(i, k) * scaled(j, k);
+                        }
+                        a(i, j) = sum / a(j, j);
+                    }
+                }
+                if (k1 == n) {
+                    break;
+                }
+                // A22 -= L21 * (L21 D1)^T, only on and below the diagonal since the upper triangle
+                // is never read
+                const auto l21 = [&a, k0, k1](size_t i, size_t p) { return a(k1 + i, k0 + p); };
+                const auto l21d = [&scaled, k0, k1](size_t p, size_t j) { return scaled(k1 + j, k0 + p); };
+                const auto a22 = [&a, k1](size_t i, size_t j) -> T & { return a(k1 + i, k1 + j); };
+                Parallel::MultiplyAddLower<T>(n - k1, k1 - k0, T(-1), l21, l21d, T(1), a22);
+            }
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = i + 1; j < n; ++j) {
+                    a(i, j) = T();
+                }
+            }
+            return true;
+        }
+    }
+
+    /**
+     * Cholesky factorization A = L * L^T of a symmetric positive definite RMatrix or CMatrix.
+     *
+     * Every loop is unrolled at compile time. A pivot that is not positive marks the matrix as not
+     * positive definite: Solve() and Inverse() then throw std::invalid_argument.
+     */
+    template<class M>
+    class Cholesky {
+    public:
+        static constexpr int n = Expr::ShapeOf<M>::rows;
+
+        static_assert(n == Expr::ShapeOf<M>::cols, "Cholesky factorization requires a square matrix");
+
+        using value_type = typename M::value_type;
+
+        explicit Cholesky(const M &a) {
+            Detail::Unroll<0, n>([&](auto jc) {
+                constexpr size_t j = decltype(jc)::value;
+                if (!mPositiveDefinite) {
+                    return;
+                }
+                value_type pivot = Detail::Element(a, j, j);
+                Detail::Unroll<0, j>([&](auto k) { pivot -= Lower(j, k) * Lower(j, k); });
+                if (!(pivot > value_type())) {
+                    mPositiveDefinite = false;
+                    return;
+                }
+                const value_type diagonal = std::sqrt(pivot);
+                Lower(j, j) = diagonal;
+                Detail::Unroll<j + 1, n>([&](auto i) {
+                    value_type sum = Detail::Element(a, i, j);
+                    Detail::Unroll<0, j>([&](auto k) { sum -= Lower(i, k) * Lower(j, k); });
+                    Lower(i, j) = sum / diagonal;
+                });
+            });
+        }
+
+        [[nodiscard]] bool IsPositiveDefinite() const noexcept { return mPositiveDefinite; }
+
+        /**
+         * L, zero above the diagonal
+         */
+        [[nodiscard]] const M &GetLower() const noexcept { return mLower; }
+
+        [[nodiscard]] value_type Determinant() const noexcept {
+            value_type out = mPositiveDefinite ? value_type(1) : value_type();
+            Detail::Unroll<0, n>([&](auto i) { out *= Lower(i, i) * Lower(i, i); });
+            return out;
+        }
+
+        /**
+         * x such that A * x = b
+         * \tparam V RVector<n> or CVector<n>
+         */
+        template<class V>
+        [[nodiscard]] V Solve(const V &b) const {
+            static_assert(Expr::ShapeOf<V>::length == n, "rhs vector length != matrix size");
+            Check();
+            V x = b;
+            Substitute(x);
+            return x;
+        }
+
+        [[nodiscard]] M Inverse() const {
+            Check();
+            M out;
+            Detail::Unroll<0, n>([&](auto j) {
+                std::array<value_type, n> x{};
+                x[j] = value_type(1);
+                Substitute(x);
+                Detail::Unroll<0, n>([&](auto i) { Detail::Element(out, i, j) = x[i]; });
+            });
+            return out;
+        }
+
+    private:
+        [[nodiscard]] value_type &Lower(const size_t r, const size_t c) noexcept {
+            return Detail::Element(mLower, r, c);
+        }
+
+        [[nodiscard]] const value_type &Lower(const size_t r, const size_t c) const noexcept {
+            return Detail::Element(mLower, r, c);
+        }
+
+        void Check() const {
+            if (!mPositiveDefinite) {
+                throw std::invalid_argument("matrix is not positive definite");
+            }
+        }
+
+        /**
+         * solves L * L^T * x = x in place
+         */
+        template<class V>
+        void Substitute(V &x) const {
+            Detail::Unroll<0, n>([&](auto ic) {
+                constexpr size_t i = decltype(ic)::value;
+                Detail::Unroll<0, i>([&](auto j) { x[i] -= Lower(i, j) * x[j]; });
+                x[i] /= Lower(i, i);
+            });
+            Detail::Unroll<0, n>([&](auto rc) {
+                constexpr size_t i = n - 1 - decltype(rc)::value;
+                Detail::Unroll<i + 1, n>([&](auto j) { x[i] -= Lower(j, i) * x[j]; });
+                x[i] /= Lower(i, i);
+            });
+        }
+
+        M mLower{};
+
+        bool mPositiveDefinite = true;
+    };
+
+    /**
+     * LDL^T factorization A = L * D * L^T of a symmetric RMatrix or CMatrix, with L unit lower
+     * triangular and D diagonal. Needs no square roots, so it is usable in constant expressions, and
+     * handles indefinite matrices as long as no pivot is zero; it does not pivot, so it is only
+     * accurate when the pivots stay away from zero.
+     *
+     * Every loop is unrolled at compile time. A zero pivot marks the matrix singular: Solve() and
+     * Inverse() then throw std::invalid_argument.
+     */
+    template<class M>
+    class LDLT {
+    public:
+        static constexpr int n = Expr::ShapeOf<M>::rows;
+
+        static_assert(n == Expr::ShapeOf<M>::cols, "LDL^T factorization requires a square matrix");
+
+        using value_type = typename M::value_type;
+
+        constexpr explicit LDLT(const M &a) {
+            Detail::Unroll<0, n>([&](auto jc) {
+                constexpr size_t j = decltype(jc)::value;
+                if (mSingular) {
+                    return;
+                }
+                value_type pivot = Detail::Element(a, j, j);
+                Detail::Unroll<0, j>([&](auto k) { pivot -= Lower(j, k) * Lower(j, k) * mDiagonal[k]; });
+                if (pivot == value_type()) {
+                    mSingular = true;
+                    return;
+                }
+                mDiagonal[j] = pivot;
+                Lower(j, j) = value_type(1);
+                Detail::Unroll<j + 1, n>([&](auto i) {
+                    value_type sum = Detail::Element(a, i, j);
+                    Detail::Unroll<0, j>([&](auto k) { sum -= Lower(i, k) * Lower(j, k) * mDiagonal[k]; });
+                    Lower(i, j) = sum / pivot;
+                });
+            });
+        }
+
+        [[nodiscard]] constexpr bool IsSingular() const noexcept { return mSingular; }
+
+        /**
+         * unit lower triangular L, zero above the diagonal
+         */
+        [[nodiscard]] constexpr const M &GetLower() const noexcept { return mLower; }
+
+        [[nodiscard]] constexpr const std::array<value_type, n> &GetDiagonal() const noexcept { return mDiagonal; }
+
+        [[nodiscard]] constexpr value_type Determinant() const noexcept {
+            value_type out = mSingular ? value_type() : value_type(1);
+            Detail::Unroll<0, n>([&](auto i) { out *= mDiagonal[i]; });
+            return out;
+        }
+
+        /**
+         * x such that A * x = b
+         * \tparam V RVector<n> or CVector<n>
+         */
+        template<class V>
+        [[nodiscard]] constexpr V Solve(const V &b) const {
+            static_assert(Expr::ShapeOf<V>::length == n, "rhs vector length != matrix size");
+            Check();
+            V x = b;
+            Substitute(x);
+            return x;
+        }
+
+        [[nodiscard]] constexpr M Inverse() const {
+            Check();
+            M out;
+            Detail::Unroll<0, n>([&](auto j) {
+                std::array<value_type, n> x{};
+                x[j] = value_type(1);
+                Substitute(x);
+                Detail::Unroll<0, n>([&](auto i) { Detail::Element(out, i, j) = x[i]; });
+            });
+            return out;
+        }
+
+    private:
+        [[nodiscard]] constexpr value_type &Lower(const size_t r, const size_t c) noexcept {
+            return Detail::Element(mLower, r, c);
+        }
+
+        [[nodiscard]] constexpr const value_type &Lower(const size_t r, const size_t c) const noexcept {
+            return Detail::Element(mLower, r, c);
+        }
+
+        constexpr void Check() const {
+            if (mSingular) {
+                throw std::invalid_argument("matrix is singular");
+            }
+        }
+
+        /**
+         * solves L * D * L^T * x = x in place
+         */
+        template<class V>
+        constexpr void Substitute(V &x) const {
+            Detail::Unroll<0, n>([&](auto ic) {
+                constexpr size_t i = decltype(ic)::value;
+                Detail::Unroll<0, i>([&](auto j) { x[i] -= Lower(i, j) * x[j]; });
+            });
+            Detail::Unroll<0, n>([&](auto i) { x[i] /= mDiagonal[i]; });
+            Detail::Unroll<0, n>([&](auto rc) {
+                constexpr size_t i = n - 1 - decltype(rc)::value;
+                Detail::Unroll<i + 1, n>([&](auto j) { x[i] -= Lower(j, i) * x[j]; });
+            });
+        }
+
+        M mLower{};
+
+        std::array<value_type, n> mDiagonal{};
+
+        bool mSingular = false;
+    };
+
+    /**
+     * Blocked Cholesky factorization of a runtime sized matrix, see Detail::FactorSymmetric
+     */
+    template<typename T, Layout layout>
+    class Cholesky<DMatrix<T, layout>> {
+    public:
+        using value_type = T;
+
+        /// columns factored per panel
+        static constexpr size_t kBlockSize = 64;
+
+        /**
+         * throws std::invalid_argument when a is not square
+         */
+        explicit Cholesky(const DMatrix<T, layout> &a) : mLower{a.Clone()} {
+            if (a.GetRows() != a.GetCols()) {
+                throw std::invalid_argument("Cholesky factorization requires a square matrix");
+            }
+            mPositiveDefinite = Detail::FactorSymmetric<false>(mLower, kBlockSize);
+        }
+
+        [[nodiscard]] bool IsPositiveDefinite() const noexcept { return mPositiveDefinite; }
+
+        /**
+         * L, zero above the diagonal. Unspecified when the matrix is not positive definite.
+         */
+        [[nodiscard]] const DMatrix<T, layout> &GetLower() const noexcept { return mLower; }
+
+        [[nodiscard]] T Determinant() const noexcept {
+            T out = mPositiveDefinite ? T(1) : T();
+            for (size_t i = 0; i < mLower.GetRows() && mPositiveDefinite; ++i) {
+                out *= mLower(i, i) * mLower(i, i);
+            }
+            return out;
+        }
+
+        /**
+         * x such that A * x = b
+         */
+        [[nodiscard]] DVector<T> Solve(const DVector<T> &b) const {
+            if (b.GetSize() != mLower.GetRows()) {
+                throw std::invalid_argument("rhs vector length != matrix size");
+            }
+            if (!mPositiveDefinite) {
+                throw std::invalid_argument("matrix is not positive definite");
+            }
+            DVector<T> x = b.Clone();
+            const size_t n = mLower.GetRows();
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < i; ++j) {
+                    x[i] -= mLower(i, j) * x[j];
+                }
+                x[i] /= mLower(i, i);
+            }
+            for (size_t i = n; i-- > 0;) {
+                for (size_t j = i + 1; j < n; ++j) {
+                    x[i] -= mLower(j, i) * x[j];
+                }
+                x[i] /= mLower(i, i);
+            }
+            return x;
+        }
+
+    private:
+        DMatrix<T, layout> mLower;
+
+        bool mPositiveDefinite = false;
+    };
+
+    /**
+     * Blocked LDL^T factorization of a runtime sized matrix, see Detail::FactorSymmetric
+     */
+    template<typename T, Layout layout>
+    class LDLT<DMatrix<T, layout>> {
+    public:
+        using value_type = T;
+
+        /// columns factored per panel
+        static constexpr size_t kBlockSize = 64;
+
+        /**
+         * throws std::invalid_argument when a is not square
+         */
+        explicit LDLT(const DMatrix<T, layout> &a) : mFactors{a.Clone()} {
+            if (a.GetRows() != a.GetCols()) {
+                throw std::invalid_argument("LDL^T factorization requires a square matrix");
+            }
+            mSingular = !Detail::FactorSymmetric<true>(mFactors, kBlockSize);
+        }
+
+        [[nodiscard]] bool IsSingular() const noexcept { return mSingular; }
+
+        /**
+         * L below the diagonal, its unit diagonal implied, and D on it
+         */
+        [[nodiscard]] const DMatrix<T, layout> &GetFactors() const noexcept { return mFactors; }
+
+        [[nodiscard]] T Determinant() const noexcept {
+            T out = mSingular ? T() : T(1);
+            for (size_t i = 0; i < mFactors.GetRows() && !mSingular; ++i) {
+                out *= mFactors(i, i);
+            }
+            return out;
+        }
+
+        /**
+         * x such that A * x = b
+         */
+        [[nodiscard]] DVector<T> Solve(const DVector<T> &b) const {
+            if (b.GetSize() != mFactors.GetRows()) {
+                throw std::invalid_argument("rhs vector length != matrix size");
+            }
+            if (mSingular) {
+                throw std::invalid_argument("matrix is singular");
+            }
+            DVector<T> x = b.Clone();
+            const size_t n = mFactors.GetRows();
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < i; ++j) {
+                    x[i] -= mFactors(i, j) * x[j];
+                }
+            }
+            for (size_t i = 0; i < n; ++i) {
+                x[i] /= mFactors(i, i);
+            }
+            for (size_t i = n; i-- > 0;) {
+                for (size_t j = i + 1; j < n; ++j) {
+                    x[i] -= mFactors(j, i) * x[j];
+                }
+            }
+            return x;
+        }
+
+    private:
+        DMatrix<T, layout> mFactors;
+
+        bool mSingular = false;
+    };
+
+    /**
+     * x[i] such that a[i] * x[i] = b[i] for count small symmetric positive definite systems, e.g.
+     * the per vertex normal equations of a fit. Large batches are split across the thread pool.
+     * \return how many matrices were not positive definite; their x[i] is left zero
+     */
+    template<class M, class V>
+    size_t BatchCholeskySolve(const M *a, const V *b, V *x, const size_t count) {
+        std::atomic<size_t> failures{0};
+        Parallel::Apply(count, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const Cholesky<M> factors(a[i]);
+                if (factors.IsPositiveDefinite()) {
+                    x[i] = factors.Solve(b[i]);
+                } else {
+                    x[i] = V();
+                    ++failures;
+                }
+            }
+        });
+        return failures;
+    }
+}
+
+#endif //DRAWING_CHOLESKY_H
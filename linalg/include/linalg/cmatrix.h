@@ -7,29 +7,42 @@
 
 #include <initializer_list>
 #include <cstddef>
+#include <memory>
+#include <type_traits>
 
 #include "cvector.h"
+#include "gemm.h"
 
 namespace QS::LinAlg {
 
 /**
  * Column Matrix
+ *
+ * \tparam alignment byte alignment of the whole matrix, by default that of T. Columns are never
+ *         padded, so the data stays contiguous; see PaddedCMatrix.
  */
-    template<int col, int row>
+    template<int col, int row, typename T = float, size_t alignment = alignof(T)>
     class CMatrix {
     public:
-        CMatrix() = default;
+        static_assert(alignment >= alignof(T) && (alignment & (alignment - 1)) == 0,
+                      "alignment must be a power of two no smaller than the element alignment");
+
+        using ExpressionShape = Expr::ColumnMajor<col, row>;
+
+        using value_type = T;
+
+        constexpr CMatrix() = default;
 
         ~CMatrix() = default;
 
-        CMatrix(std::initializer_list<float> list) {
+        constexpr CMatrix(std::initializer_list<T> list) {
             auto list_iter = list.begin();
             for (size_t i = 0; i < list.size() && i < col * row; ++i, ++list_iter) {
-                mData[i / col][i % col] = *list_iter;
+                mData[i / row][i % row] = *list_iter;
             }
         }
 
-        CMatrix(std::initializer_list<std::initializer_list<float>> list) {
+        constexpr CMatrix(std::initializer_list<std::initializer_list<T>> list) {
             auto list_iter = list.begin();
             auto data_iter = mData.begin();
             for (; list_iter != list.end() && data_iter != mData.end(); ++list_iter, ++data_iter) {
@@ -37,24 +50,42 @@ namespace QS::LinAlg {
             }
         }
 
-        CMatrix(const CMatrix &m) noexcept {
+        constexpr CMatrix(const CMatrix &m) noexcept {
             mData = m.mData;
         }
 
-        CMatrix &operator=(const CMatrix &m) noexcept {
+        constexpr CMatrix &operator=(const CMatrix &m) noexcept {
             mData = m.mData;
             return *this;
         }
 
-        CMatrix(const CMatrix &&m) noexcept {
+        constexpr CMatrix(const CMatrix &&m) noexcept {
             mData = std::move(m.mData);
         }
 
-        CMatrix &operator=(const CMatrix &&m) noexcept {
+        constexpr CMatrix &operator=(const CMatrix &&m) noexcept {
             mData = std::move(m.mData);
             return *this;
         }
 
+        /**
+         * Evaluates an element-wise expression directly into the new matrix
+         */
+        template<Expr::ExpressionOf<ExpressionShape> E>
+        constexpr CMatrix(const E &expr) {
+            Assign(expr);
+        }
+
+        template<Expr::ExpressionOf<ExpressionShape> E>
+        constexpr CMatrix &operator=(const E &expr) {
+            if (Expr::MayAlias(expr, GetData(), GetData() + col * row)) {
+                // expr reads this matrix in another order, e.g. m = AsRowMajor(Transpose(m))
+                return *this = CMatrix(expr);
+            }
+            Assign(expr);
+            return *this;
+        }
+
         constexpr int GetCol() const noexcept {
             return col;
         }
@@ -63,98 +94,194 @@ namespace QS::LinAlg {
             return row;
         }
 
-        constexpr const CVector<row> &operator[](const size_t idx) const {
+        constexpr const CVector<row, T> &operator[](const size_t idx) const {
             return mData[idx];
         }
 
-        constexpr CVector<row> &operator[](const size_t idx) {
+        constexpr CVector<row, T> &operator[](const size_t idx) {
             return mData[idx];
         }
 
-        constexpr CMatrix operator+(const CMatrix &rhs) const noexcept {
-            CMatrix<col, row> result;
-            for (size_t i = 0; i < col; ++i) {
-                for (size_t j = 0; j < row; ++j) {
-                    result[i][j] = mData[i][j] + rhs[i][j];
-                }
-            }
-            return result;
+        [[nodiscard]] constexpr T Eval(const size_t i, const size_t j) const {
+            return mData[i][j];
         }
 
-        constexpr CMatrix &operator+=(const CMatrix &rhs) noexcept {
-            for (size_t i = 0; i < col; ++i) {
-                for (size_t j = 0; j < row; ++j) {
-                    mData[i][j] += rhs[i][j];
-                }
+        template<Expr::ExpressionOf<ExpressionShape> E>
+        constexpr CMatrix &operator+=(const E &rhs) noexcept {
+            if (Expr::MayAlias(rhs, GetData(), GetData() + col * row)) {
+                return *this += CMatrix(rhs);
             }
+            Detail::For<col>([&](const size_t i) {
+                Detail::For<row>([&](const size_t j) { mData[i][j] += rhs.Eval(i, j); });
+            });
             return *this;
         }
 
-        constexpr CMatrix operator-(const CMatrix &rhs) const noexcept {
-            CMatrix<col, row> result;
-            for (size_t i = 0; i < col; ++i) {
-                for (size_t j = 0; j < col; ++j) {
-                    result[i][j] = mData[i][j] - rhs[i][j];
-                }
+        template<Expr::ExpressionOf<ExpressionShape> E>
+        constexpr CMatrix &operator-=(const E &rhs) noexcept {
+            if (Expr::MayAlias(rhs, GetData(), GetData() + col * row)) {
+                return *this -= CMatrix(rhs);
             }
-            return result;
+            Detail::For<col>([&](const size_t i) {
+                Detail::For<row>([&](const size_t j) { mData[i][j] -= rhs.Eval(i, j); });
+            });
+            return *this;
         }
 
         constexpr CMatrix &AddRows(const size_t from, const size_t to) noexcept {
             for (size_t i = 0; i < col; ++i) {
                 (*this)[i][to] += (*this)[i][from];
             }
+            return *this;
         }
 
-        constexpr CMatrix &MultiplyAddRows(const float scalar, const size_t from, const size_t to) noexcept {
+        constexpr CMatrix &MultiplyAddRows(const T scalar, const size_t from, const size_t to) noexcept {
             for (size_t i = 0; i < col; ++i) {
                 (*this)[i][to] += scalar * (*this)[i][from];
             }
+            return *this;
         }
 
         constexpr CMatrix &SwapRows(const size_t a, const size_t b) noexcept {
             for (size_t i = 0; i < col; ++i) {
-                float temp = (*this)[i][a];
+                T temp = (*this)[i][a];
                 (*this)[i][a] = (*this)[i][b];
                 (*this)[i][b] = temp;
             }
             return *this;
         }
 
-        constexpr CMatrix &ScalarMultiplyRow(const size_t r, const float scalar) noexcept {
+        constexpr CMatrix &ScalarMultiplyRow(const size_t r, const T scalar) noexcept {
             for (size_t i = 0; i < col; ++i) {
                 (*this)[i][r] *= scalar;
             }
+            return *this;
         }
 
-        constexpr float *GetData() noexcept {
-            return mData[0].GetData();
+        constexpr T *GetData() noexcept {
+            return std::assume_aligned<alignment>(mData[0].GetData());
         }
 
-        constexpr const float *GetData() const noexcept {
-            return mData[0].GetData();
+        constexpr const T *GetData() const noexcept {
+            return std::assume_aligned<alignment>(mData[0].GetData());
         }
 
     private:
-        std::array<CVector<row>, col> mData;
+        template<class E>
+        constexpr void Assign(const E &expr) {
+            Detail::For<col>([&](const size_t i) {
+                Detail::For<row>([&](const size_t j) { mData[i][j] = expr.Eval(i, j); });
+            });
+        }
+
+        alignas(alignment) std::array<CVector<row, T>, col> mData;
     };
 
-    template<int n>
-    CMatrix<n, n> Identity(void) {
-        CMatrix<n, n> ret;
-        for (size_t i = 0; i < n; ++i) {
-            for (size_t j = 0; j < n; ++j) {
-                if (i != j) {
-                    ret[i][j] = 0.0f;
-                } else {
-                    ret[i][j] = 1.0f;
+    /**
+     * A CMatrix padded to a power of two bytes, at most a cache line, e.g. 64 for CMatrix<4, 4>
+     */
+    template<int col, int row, typename T = float>
+    using PaddedCMatrix = CMatrix<col, row, T, PaddedAlignment<T, col * row>()>;
+
+    /**
+     * Matrix product with sums accumulated in Acc, e.g. Multiply<double>(a, b) on float matrices.
+     * The result holds the common element type of the operands. Stored matrices and views are read
+     * in place; other expressions are evaluated once before multiplying.
+     */
+    template<typename Acc, class L, class R> requires Expr::ColumnMajorExpression<L> && Expr::ColumnMajorExpression<R>
+    [[nodiscard]] constexpr auto Multiply(const L &lhs, const R &rhs) {
+        constexpr int collhs = Expr::ShapeOf<L>::cols;
+        constexpr int rowlhs = Expr::ShapeOf<L>::rows;
+        constexpr int colrhs = Expr::ShapeOf<R>::cols;
+        constexpr int rowrhs = Expr::ShapeOf<R>::rows;
+        static_assert(collhs == rowrhs, "lhs matrix columns != rhs matrix rows");
+        using T = std::common_type_t<Expr::ValueOf<L>, Expr::ValueOf<R>>;
+
+        if constexpr (!Expr::Addressable<L>) {
+            return Multiply<Acc>(CMatrix<collhs, rowlhs, Expr::ValueOf<L>>(lhs), rhs);
+        } else if constexpr (!Expr::Addressable<R>) {
+            return Multiply<Acc>(lhs, CMatrix<colrhs, rowrhs, Expr::ValueOf<R>>(rhs));
+        } else {
+            CMatrix<colrhs, rowlhs, T> out;
+#ifdef QS_LINALG_SSE
+            if constexpr (collhs == 4 && rowlhs == 4 && colrhs == 4 && std::is_same_v<Expr::ValueOf<L>, float> &&
+                          std::is_same_v<Expr::ValueOf<R>, float> && std::is_same_v<Acc, float> &&
+                          Expr::Dense<L> && Expr::Dense<R>) {
+                if (!std::is_constant_evaluated()) {
+                    Gemm::Multiply4x4(lhs.GetData(), rhs.GetData(), out.GetData());
+                    return out;
+                }
+            }
+#endif
+            Gemm::Multiply<Acc, rowlhs, colrhs, collhs>([&lhs](size_t i, size_t j) { return lhs.Eval(j, i); },
+                                                        [&rhs](size_t i, size_t j) { return rhs.Eval(j, i); },
+                                                        [&out](size_t i, size_t j) -> T & { return out[j][i]; });
+            return out;
+        }
+    }
+
+    /**
+     * Matrix vector product with sums accumulated in Acc
+     */
+    template<typename Acc, class L, class R> requires Expr::ColumnMajorExpression<L> && Expr::ColumnVectorExpression<R>
+    [[nodiscard]] constexpr auto Multiply(const L &lhs, const R &rhs) {
+        constexpr int col = Expr::ShapeOf<L>::cols;
+        constexpr int row = Expr::ShapeOf<L>::rows;
+        static_assert(col == Expr::ShapeOf<R>::length, "lhs matrix columns != rhs vector length");
+        using T = std::common_type_t<Expr::ValueOf<L>, Expr::ValueOf<R>>;
+
+        if constexpr (!Expr::Addressable<L>) {
+            return Multiply<Acc>(CMatrix<col, row, Expr::ValueOf<L>>(lhs), rhs);
+        } else if constexpr (!Expr::Addressable<R>) {
+            return Multiply<Acc>(lhs, CVector<col, Expr::ValueOf<R>>(rhs));
+        } else {
+            CVector<row, T> out;
+#ifdef QS_LINALG_SSE
+            if constexpr (col == 4 && row == 4 && std::is_same_v<Expr::ValueOf<L>, float> &&
+                          std::is_same_v<Expr::ValueOf<R>, float> && std::is_same_v<Acc, float> &&
+                          Expr::Dense<L> && Expr::Dense<R>) {
+                if (!std::is_constant_evaluated()) {
+                    Gemm::Transform4(lhs.GetData(), rhs.GetData(), out.GetData());
+                    return out;
                 }
             }
+#endif
+            Acc sums[row] = {};
+            Detail::For<col>([&](const size_t j) {
+                const Acc v = rhs.Eval(j);
+                Detail::For<row>([&](const size_t i) { sums[i] += static_cast<Acc>(lhs.Eval(j, i)) * v; });
+            });
+            Detail::For<row>([&](const size_t i) { out[i] = static_cast<T>(sums[i]); });
+            return out;
         }
+    }
+
+    /**
+     * Matrix product, accumulated in the Expr::Accumulator of the element type
+     */
+    template<class L, class R> requires Expr::ColumnMajorExpression<L> && Expr::ColumnMajorExpression<R>
+    [[nodiscard]] constexpr auto operator*(const L &lhs, const R &rhs) {
+        using T = std::common_type_t<Expr::ValueOf<L>, Expr::ValueOf<R>>;
+        return Multiply<Expr::AccumulatorOf<T>>(lhs, rhs);
+    }
+
+    /**
+     * Matrix vector product, accumulated in the Expr::Accumulator of the element type
+     */
+    template<class L, class R> requires Expr::ColumnMajorExpression<L> && Expr::ColumnVectorExpression<R>
+    [[nodiscard]] constexpr auto operator*(const L &lhs, const R &rhs) {
+        using T = std::common_type_t<Expr::ValueOf<L>, Expr::ValueOf<R>>;
+        return Multiply<Expr::AccumulatorOf<T>>(lhs, rhs);
+    }
+
+    template<int n, typename T = float>
+    constexpr CMatrix<n, n, T> Identity(void) {
+        CMatrix<n, n, T> ret;
+        Detail::For<n>([&](const size_t i) { ret[i][i] = T(1); });
         return ret;
     }
 
-    inline CMatrix<4, 4>
+    constexpr CMatrix<4, 4>
     OrthographicProjection(float left, float right, float top, float bottom, float far, float near) {
         CMatrix<4, 4> out = {
                 2 / (right - left), 0, 0, 0,
@@ -8,44 +8,48 @@
 #include <array>
 #include <cstddef>
 #include <initializer_list>
+#include <memory>
+
+#include "aligned_buffer.h"
+#include "expression.h"
+#include "simd.h"
 
 namespace QS::LinAlg {
 
-    template<int length>
+    /**
+     * \tparam alignment byte alignment of the vector, by default that of T. A larger power of two
+     *         also pads the size to a multiple of it, see PaddedAlignment and PaddedCVector.
+     */
+    template<int length, typename T = float, size_t alignment = alignof(T)>
     class CVector;
 
-    template<int length>
-    constexpr CVector<length> operator+(const CVector<length> &lhs, const CVector<length> &rhs) noexcept;
-
-    template<int length>
-    constexpr CVector<length> operator-(const CVector<length> &lhs, const CVector<length> &rhs) noexcept;
-
-    template<int length>
-    constexpr float operator*(const CVector<length> &lhs, const CVector<length> &rhs) noexcept;
+    template<int length, typename T, size_t alignment>
+    class CVector {
+    public:
+        static_assert(alignment >= alignof(T) && (alignment & (alignment - 1)) == 0,
+                      "alignment must be a power of two no smaller than the element alignment");
 
-    template<int length>
-    constexpr CVector<length> operator*(const CVector<length> &lhs, const float scalar);
+        using ExpressionShape = Expr::ColumnVector<length>;
 
-    template<int length>
-    constexpr CVector<length> operator*(const float scalar, const CVector<length> &rhs);
+        using value_type = T;
 
-    template<int length>
-    class CVector {
-    public:
         constexpr CVector(void) {
-            for (auto &i: mData) { i = 0.0f; }
+            Detail::For<length>([&](const size_t i) { mData[i] = T(); });
         }
 
         constexpr CVector(const CVector &vec) {
             mData = vec.mData;
         }
 
-        constexpr CVector(std::initializer_list<float> list) {
+        constexpr CVector(std::initializer_list<T> list) {
             auto list_iter = list.begin();
             auto data_iter = mData.begin();
             for (; list_iter != list.end() && data_iter != mData.end(); ++list_iter, ++data_iter) {
                 *data_iter = *list_iter;
             }
+            for (; data_iter != mData.end(); ++data_iter) {
+                *data_iter = T();
+            }
         }
 
         constexpr CVector &operator=(const CVector &vec) {
@@ -62,93 +66,84 @@ namespace QS::LinAlg {
             return *this;
         }
 
+        /**
+         * Evaluates an expression such as a + b * s directly into the new vector
+         */
+        template<Expr::ExpressionOf<ExpressionShape> E>
+        constexpr CVector(const E &expr) {
+            Expr::Evaluate<length>(expr, mData.data());
+        }
+
+        template<Expr::ExpressionOf<ExpressionShape> E>
+        constexpr CVector &operator=(const E &expr) {
+            if (Expr::MayAlias(expr, GetData(), GetData() + length)) {
+                // expr reads this vector through a view of other elements
+                return *this = CVector(expr);
+            }
+            Expr::Evaluate<length>(expr, mData.data());
+            return *this;
+        }
+
         [[nodiscard]] constexpr size_t GetSize(void) const noexcept { return length; }
 
-        [[nodiscard]] constexpr float &operator[](const size_t idx) {
+        [[nodiscard]] constexpr T &operator[](const size_t idx) {
             return mData[idx];
         }
 
-        [[nodiscard]] constexpr const float &operator[](const size_t idx) const {
+        [[nodiscard]] constexpr const T &operator[](const size_t idx) const {
             return mData[idx];
         }
 
         constexpr CVector &operator+=(const CVector &rhs) {
-            for (size_t i = 0; i < length; ++i) {
-                (*this)[i] += rhs[i];
-            }
+            Simd::Add<length>(GetData(), rhs.GetData(), GetData());
             return *this;
         }
 
         constexpr CVector &operator-=(const CVector &rhs) {
-            for (size_t i = 0; i < length; ++i) {
-                (*this)[i] += rhs[i];
-            }
+            Simd::Sub<length>(GetData(), rhs.GetData(), GetData());
             return *this;
         }
 
-        [[nodiscard]] constexpr float *GetData() noexcept {
-            return mData.data();
+        template<Expr::ExpressionOf<ExpressionShape> E>
+        constexpr CVector &operator+=(const E &rhs) {
+            if (Expr::MayAlias(rhs, GetData(), GetData() + length)) {
+                return *this += CVector(rhs);
+            }
+            Detail::For<length>([&](const size_t i) { mData[i] += rhs.Eval(i); });
+            return *this;
         }
 
-        [[nodiscard]] constexpr const float *GetData() const noexcept {
-            return mData.data();
+        template<Expr::ExpressionOf<ExpressionShape> E>
+        constexpr CVector &operator-=(const E &rhs) {
+            if (Expr::MayAlias(rhs, GetData(), GetData() + length)) {
+                return *this -= CVector(rhs);
+            }
+            Detail::For<length>([&](const size_t i) { mData[i] -= rhs.Eval(i); });
+            return *this;
         }
 
-        friend constexpr CVector<length> operator*<>(const CVector<length> &lhs, const float scalar);
-
-        friend constexpr CVector<length> operator*<>(const float scalar, const CVector<length> &rhs);
-
-        friend constexpr CVector<length> operator+<>(const CVector<length> &lhs, const CVector<length> &rhs) noexcept;
+        [[nodiscard]] constexpr const T &Eval(const size_t idx) const {
+            return mData[idx];
+        }
 
-        friend constexpr CVector<length> operator-<>(const CVector<length> &lhs, const CVector<length> &rhs) noexcept;
+        [[nodiscard]] constexpr T *GetData() noexcept {
+            return std::assume_aligned<alignment>(mData.data());
+        }
 
-        friend constexpr float operator*<>(const CVector<length> &lhs, const CVector<length> &rhs) noexcept;
+        [[nodiscard]] constexpr const T *GetData() const noexcept {
+            return std::assume_aligned<alignment>(mData.data());
+        }
 
     private:
-        std::array<float, length> mData;
+        alignas(alignment) std::array<T, length> mData;
 
     };
 
-    template<int length>
-    constexpr CVector<length> operator+(const CVector<length> &lhs, const CVector<length> &rhs) noexcept {
-        CVector<length> out;
-        for (int i = 0; i < length; ++i) {
-            out[i] = lhs[i] + rhs[i];
-        }
-        return out;
-    }
-
-    template<int length>
-    constexpr CVector<length> operator-(const CVector<length> &lhs, const CVector<length> &rhs) noexcept {
-        CVector<length> out;
-        for (int i = 0; i < length; ++i) {
-            out[i] = lhs[i] - rhs[i];
-        }
-        return out;
-    }
-
-    template<int length>
-    constexpr float operator*(const CVector<length> &lhs, const CVector<length> &rhs) noexcept {
-        float out = 0.0f;
-        for (int i = 0; i < length; ++i) {
-            out += lhs[i] * rhs[i];
-        }
-        return out;
-    }
-
-    template<int length>
-    constexpr CVector<length> operator*(const CVector<length> &lhs, const float scalar) {
-        CVector<length> out;
-        for (int i = 0; i < length; ++i) {
-            out[i] = lhs[i] * scalar;
-        }
-        return out;
-    }
-
-    template<int length>
-    constexpr CVector<length> operator*(const float scalar, const CVector<length> &rhs) {
-        return rhs * scalar;
-    }
+    /**
+     * A CVector padded to a power of two bytes, see PaddedRVector
+     */
+    template<int length, typename T = float>
+    using PaddedCVector = CVector<length, T, PaddedAlignment<T, length>()>;
 }
 
 
@@ -0,0 +1,131 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_DISPATCH_H
+#define DRAWING_DISPATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include "simd.h"
+
+#if defined(QS_LINALG_SSE) && (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(_MSC_VER))
+#define QS_LINALG_DISPATCH 1
+#endif
+
+/**
+ * Run time selection of the hot float kernels, so one binary uses AVX-512 where it has it and still
+ * runs on SSE only machines.
+ *
+ * The CPU is examined once, during static initialization when the program starts, so no timed
+ * kernel pays for it; a dispatched kernel called from another static initializer before then runs
+ * the detection itself. The best tier the CPU supports is used from then on. Setting the
+ * environment variable QS_LINALG_TIER to scalar, sse, avx2 or avx512 before the program starts
+ * forces a lower tier, for benchmarking and for narrowing down bugs; a tier the CPU lacks falls
+ * back to the best supported one. SetTier changes it later on.
+ *
+ * Dispatched are Simd::Dot, Simd::Sum and Simd::Axpy over float, and with them the runtime sized
+ * dot products, matrix vector products and Blas level 2 kernels, the micro kernel of Simd::Gemm
+ * behind the float DMatrix products and Blas::Gemm, the gathering dot product behind the float
+ * sparse matrix products, plus the batch transforms of transform.h.
+ * Everything else is compiled for the build's own target flags, which must therefore not exceed
+ * the oldest CPU the binary runs on. Builds with QS_LINALG_NO_SIMD or for other
+ * architectures only have the scalar tier.
+ */
+namespace QS::LinAlg::Dispatch {
+
+    /**
+     * Instruction set levels, each including the ones before it
+     */
+    enum class Tier {
+        Scalar,
+        Sse,
+        /// AVX2 and FMA
+        Avx2,
+        /// AVX-512 F
+        Avx512
+    };
+
+    /// environment variable that forces a tier
+    inline constexpr const char *kTierVariable = "QS_LINALG_TIER";
+
+    /// largest gemmRows * gemmCols of any tier
+    inline constexpr size_t kMaxGemmTile = 128;
+
+    /**
+     * One implementation of every dispatched kernel
+     */
+    struct Kernels {
+        Tier tier;
+
+        /// sum of lhs[i] * rhs[i]
+        float (*dot)(const float *lhs, const float *rhs, size_t n) noexcept;
+
+        /// sum of in[i]
+        float (*sum)(const float *in, size_t n) noexcept;
+
+        /// y[i] += alpha * x[i]
+        void (*axpy)(float alpha, const float *x, float *y, size_t n) noexcept;
+
+        /**
+         * Vertices [begin, end) of a stream through the column major 4x4 matrix m. transform3 reads
+         * and writes x, y, z and uses w for the fourth component; transform4 reads and writes all four.
+         */
+        void (*transform3)(const float *m, float w, const float *in, size_t inStride, float *out, size_t outStride,
+                           size_t begin, size_t end) noexcept;
+
+        void (*transform4)(const float *m, const float *in, size_t inStride, float *out, size_t outStride,
+                           size_t begin, size_t end) noexcept;
+
+        /// rows of the tile gemm computes, and of the panels of a it reads
+        size_t gemmRows;
+
+        /// columns of the tile gemm computes, and of the panels of b it reads
+        size_t gemmCols;
+
+        /**
+         * tile = a b for a gemmRows x k panel a stored column after column and a k x gemmCols panel b
+         * stored row after row. tile is written whole, row major.
+         */
+        void (*gemm)(size_t k, const float *a, const float *b, float *tile) noexcept;
+
+        /// sum of values[k] * x[indices[k]], see SparseMatrix
+        float (*sparseDot)(const float *values, const uint32_t *indices, size_t count, const float *x) noexcept;
+    };
+
+    /**
+     * The best tier the CPU, the operating system and this build all support
+     */
+    [[nodiscard]] Tier GetSupportedTier() noexcept;
+
+    /**
+     * The tier the dispatched kernels currently use
+     */
+    [[nodiscard]] Tier GetTier() noexcept;
+
+    /**
+     * Switches every dispatched kernel to tier. Kernels already running finish on the old one.
+     * Throws std::invalid_argument when tier is above GetSupportedTier().
+     */
+    void SetTier(Tier tier);
+
+    /**
+     * The kernels of the current tier
+     */
+    [[nodiscard]] const Kernels &GetKernels() noexcept;
+
+    /**
+     * The lower case name of a tier, as accepted by QS_LINALG_TIER
+     */
+    [[nodiscard]] const char *GetTierName(Tier tier) noexcept;
+
+    /**
+     * The tier named name, or nothing for an unknown name
+     */
+    [[nodiscard]] std::optional<Tier> ParseTier(std::string_view name) noexcept;
+}
+
+#endif //DRAWING_DISPATCH_H
@@ -0,0 +1,295 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_DMATRIX_H
+#define DRAWING_DMATRIX_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "aligned_buffer.h"
+#include "dvector.h"
+#include "expression.h"
+#include "parallel.h"
+
+namespace QS::LinAlg {
+
+    /**
+     * Order in which the elements of a DMatrix are stored
+     */
+    enum class Layout {
+        RowMajor,
+        ColumnMajor
+    };
+
+    /**
+     * Matrix whose dimensions are chosen at runtime. Storage is one contiguous cache line aligned
+     * block in the given layout. Elements are addressed as m(row, col) in either layout.
+     *
+     * DMatrix is move-only; use Clone() for an explicit copy. Operations on operands with mismatched
+     * dimensions throw std::invalid_argument.
+     */
+    template<typename T = float, Layout layout = Layout::RowMajor>
+    class DMatrix {
+    public:
+        using value_type = T;
+
+        DMatrix() noexcept = default;
+
+        /**
+         * Produces a zero matrix
+         * \param rows number of rows
+         * \param cols number of columns
+         */
+        DMatrix(const size_t rows, const size_t cols) : mRows{rows}, mCols{cols}, mData(rows * cols) {}
+
+        /**
+         * Builds a matrix from a list of rows. Short rows are padded with zeros.
+         */
+        DMatrix(std::initializer_list<std::initializer_list<T>> list) {
+            size_t cols = 0;
+            for (const auto &r: list) {
+                cols = r.size() > cols ? r.size() : cols;
+            }
+            *this = DMatrix(list.size(), cols);
+            size_t i = 0;
+            for (const auto &r: list) {
+                size_t j = 0;
+                for (const T &value: r) {
+                    (*this)(i, j++) = value;
+                }
+                ++i;
+            }
+        }
+
+        /**
+         * Copies a fixed size matrix or matrix expression
+         */
+        template<class E> requires Expr::MatrixExpression<E>
+        explicit DMatrix(const E &expr) : DMatrix(Expr::ShapeOf<E>::rows, Expr::ShapeOf<E>::cols) {
+            for (size_t i = 0; i < mRows; ++i) {
+                for (size_t j = 0; j < mCols; ++j) {
+                    (*this)(i, j) = Expr::At(expr, i, j);
+                }
+            }
+        }
+
+        DMatrix(const DMatrix &) = delete;
+
+        DMatrix &operator=(const DMatrix &) = delete;
+
+        DMatrix(DMatrix &&other) noexcept
+                : mRows{std::exchange(other.mRows, 0)}, mCols{std::exchange(other.mCols, 0)},
+                  mData{std::move(other.mData)} {}
+
+        DMatrix &operator=(DMatrix &&other) noexcept {
+            mRows = std::exchange(other.mRows, 0);
+            mCols = std::exchange(other.mCols, 0);
+            mData = std::move(other.mData);
+            return *this;
+        }
+
+        [[nodiscard]] DMatrix Clone() const {
+            DMatrix out(mRows, mCols);
+            for (size_t i = 0; i < GetSize(); ++i) {
+                out.mData[i] = mData[i];
+            }
+            return out;
+        }
+
+        [[nodiscard]] static constexpr Layout GetLayout() noexcept { return layout; }
+
+        [[nodiscard]] size_t GetRows() const noexcept { return mRows; }
+
+        [[nodiscard]] size_t GetCols() const noexcept { return mCols; }
+
+        /**
+         * total number of elements
+         */
+        [[nodiscard]] size_t GetSize() const noexcept { return mRows * mCols; }
+
+        /**
+         * distance in elements between m(i, j) and m(i + 1, j)
+         */
+        [[nodiscard]] size_t GetRowStride() const noexcept {
+            return layout == Layout::RowMajor ? mCols : 1;
+        }
+
+        /**
+         * distance in elements between m(i, j) and m(i, j + 1)
+         */
+        [[nodiscard]] size_t GetColStride() const noexcept {
+            return layout == Layout::RowMajor ? 1 : mRows;
+        }
+
+        [[nodiscard]] T &operator()(const size_t r, const size_t c) noexcept {
+            return mData[r * GetRowStride() + c * GetColStride()];
+        }
+
+        [[nodiscard]] const T &operator()(const size_t r, const size_t c) const noexcept {
+            return mData[r * GetRowStride() + c * GetColStride()];
+        }
+
+        [[nodiscard]] T *GetData() noexcept { return mData.GetData(); }
+
+        [[nodiscard]] const T *GetData() const noexcept { return mData.GetData(); }
+
+        template<Layout other>
+        DMatrix &operator+=(const DMatrix<T, other> &rhs) {
+            CheckSameDimensions(rhs);
+            if constexpr (other == layout) {
+                Parallel::Add(GetData(), rhs.GetData(), GetData(), GetSize());
+            } else {
+                ForEach([&rhs](T &value, size_t i, size_t j) { value += rhs(i, j); });
+            }
+            return *this;
+        }
+
+        template<Layout other>
+        DMatrix &operator-=(const DMatrix<T, other> &rhs) {
+            CheckSameDimensions(rhs);
+            if constexpr (other == layout) {
+                Parallel::Sub(GetData(), rhs.GetData(), GetData(), GetSize());
+            } else {
+                ForEach([&rhs](T &value, size_t i, size_t j) { value -= rhs(i, j); });
+            }
+            return *this;
+        }
+
+        DMatrix &operator*=(const T scalar) {
+            Parallel::Scale(GetData(), scalar, GetData(), GetSize());
+            return *this;
+        }
+
+        /**
+         * y = A x. x holds GetCols() and y GetRows() elements; they must not overlap.
+         */
+        void Multiply(const T *x, T *y) const {
+            if constexpr (layout == Layout::RowMajor) {
+                for (size_t i = 0; i < mRows; ++i) {
+                    y[i] = Simd::Dot(GetData() + i * mCols, x, mCols);
+                }
+            } else {
+                std::fill(y, y + mRows, T());
+                for (size_t j = 0; j < mCols; ++j) {
+                    Simd::Axpy(x[j], GetData() + j * mRows, y, mRows);
+                }
+            }
+        }
+
+        /**
+         * throws std::invalid_argument when rhs has different dimensions
+         */
+        template<Layout other>
+        void CheckSameDimensions(const DMatrix<T, other> &rhs) const {
+            if (rhs.GetRows() != mRows || rhs.GetCols() != mCols) {
+                throw std::invalid_argument("rhs and lhs matrices have differing dimensions");
+            }
+        }
+
+    private:
+        template<typename F>
+        void ForEach(F f) {
+            for (size_t i = 0; i < mRows; ++i) {
+                for (size_t j = 0; j < mCols; ++j) {
+                    f((*this)(i, j), i, j);
+                }
+            }
+        }
+
+        /// number of rows
+        size_t mRows = 0;
+
+        /// number of columns
+        size_t mCols = 0;
+
+        /// the matrix data
+        AlignedBuffer<T> mData;
+    };
+
+    template<typename T, Layout lhsLayout, Layout rhsLayout>
+    [[nodiscard]] DMatrix<T, lhsLayout> operator+(const DMatrix<T, lhsLayout> &lhs, const DMatrix<T, rhsLayout> &rhs) {
+        DMatrix<T, lhsLayout> out = lhs.Clone();
+        out += rhs;
+        return out;
+    }
+
+    template<typename T, Layout lhsLayout, Layout rhsLayout>
+    [[nodiscard]] DMatrix<T, lhsLayout> operator+(DMatrix<T, lhsLayout> &&lhs, const DMatrix<T, rhsLayout> &rhs) {
+        lhs += rhs;
+        return std::move(lhs);
+    }
+
+    template<typename T, Layout lhsLayout, Layout rhsLayout>
+    [[nodiscard]] DMatrix<T, lhsLayout> operator-(const DMatrix<T, lhsLayout> &lhs, const DMatrix<T, rhsLayout> &rhs) {
+        DMatrix<T, lhsLayout> out = lhs.Clone();
+        out -= rhs;
+        return out;
+    }
+
+    template<typename T, Layout lhsLayout, Layout rhsLayout>
+    [[nodiscard]] DMatrix<T, lhsLayout> operator-(DMatrix<T, lhsLayout> &&lhs, const DMatrix<T, rhsLayout> &rhs) {
+        lhs -= rhs;
+        return std::move(lhs);
+    }
+
+    template<typename T, Layout layout>
+    [[nodiscard]] DMatrix<T, layout> operator*(const DMatrix<T, layout> &lhs, const std::type_identity_t<T> scalar) {
+        DMatrix<T, layout> out(lhs.GetRows(), lhs.GetCols());
+        Parallel::Scale(lhs.GetData(), scalar, out.GetData(), out.GetSize());
+        return out;
+    }
+
+    template<typename T, Layout layout>
+    [[nodiscard]] DMatrix<T, layout> operator*(DMatrix<T, layout> &&lhs, const std::type_identity_t<T> scalar) {
+        lhs *= scalar;
+        return std::move(lhs);
+    }
+
+    template<typename T, Layout layout>
+    [[nodiscard]] DMatrix<T, layout> operator*(const std::type_identity_t<T> scalar, const DMatrix<T, layout> &rhs) {
+        return rhs * scalar;
+    }
+
+    template<typename T, Layout layout>
+    [[nodiscard]] DMatrix<T, layout> operator*(const std::type_identity_t<T> scalar, DMatrix<T, layout> &&rhs) {
+        return std::move(rhs) * scalar;
+    }
+
+    /**
+     * Matrix product. The result uses the layout of lhs. Large products are split across the thread
+     * pool, see Parallel::Multiply, and float ones run on the dispatched kernel of Simd::Gemm.
+     */
+    template<typename T, Layout lhsLayout, Layout rhsLayout>
+    [[nodiscard]] DMatrix<T, lhsLayout> operator*(const DMatrix<T, lhsLayout> &lhs, const DMatrix<T, rhsLayout> &rhs) {
+        if (lhs.GetCols() != rhs.GetRows()) {
+            throw std::invalid_argument("lhs matrix columns != rhs matrix rows");
+        }
+        DMatrix<T, lhsLayout> out(lhs.GetRows(), rhs.GetCols());
+        Parallel::Multiply<T>(lhs.GetRows(), rhs.GetCols(), lhs.GetCols(),
+                              Gemm::Strided<const T>{lhs.GetData(), lhs.GetRowStride(), lhs.GetColStride()},
+                              Gemm::Strided<const T>{rhs.GetData(), rhs.GetRowStride(), rhs.GetColStride()},
+                              Gemm::Strided<T>{out.GetData(), out.GetRowStride(), out.GetColStride()});
+        return out;
+    }
+
+    /**
+     * Matrix vector product
+     */
+    template<typename T, Layout layout>
+    [[nodiscard]] DVector<T> operator*(const DMatrix<T, layout> &lhs, const DVector<T> &rhs) {
+        if (lhs.GetCols() != rhs.GetSize()) {
+            throw std::invalid_argument("lhs matrix columns != rhs vector length");
+        }
+        DVector<T> out(lhs.GetRows());
+        lhs.Multiply(rhs.GetData(), out.GetData());
+        return out;
+    }
+}
+
+#endif //DRAWING_DMATRIX_H
@@ -0,0 +1,173 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_DVECTOR_H
+#define DRAWING_DVECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "aligned_buffer.h"
+#include "expression.h"
+#include "parallel.h"
+
+namespace QS::LinAlg {
+
+    /**
+     * Column vector whose length is chosen at runtime. Storage is cache line aligned heap memory.
+     *
+     * DVector is move-only; use Clone() for an explicit copy. Binary operators taking an rvalue
+     * reuse its storage, so a + b + c allocates once.
+     */
+    template<typename T = float>
+    class DVector {
+    public:
+        using value_type = T;
+
+        DVector() noexcept = default;
+
+        /**
+         * Produces a zero vector
+         * \param length number of elements
+         */
+        explicit DVector(const size_t length) : mData(length) {}
+
+        DVector(std::initializer_list<T> list) : mData(list.size()) {
+            size_t i = 0;
+            for (const T &value: list) {
+                mData[i++] = value;
+            }
+        }
+
+        /**
+         * Copies a fixed size vector or vector expression
+         */
+        template<class E> requires Expr::VectorExpression<E>
+        explicit DVector(const E &expr) : mData(Expr::ShapeOf<E>::length) {
+            for (size_t i = 0; i < mData.GetSize(); ++i) {
+                mData[i] = expr.Eval(i);
+            }
+        }
+
+        DVector(const DVector &) = delete;
+
+        DVector &operator=(const DVector &) = delete;
+
+        DVector(DVector &&) noexcept = default;
+
+        DVector &operator=(DVector &&) noexcept = default;
+
+        [[nodiscard]] DVector Clone() const {
+            DVector out(GetSize());
+            for (size_t i = 0; i < GetSize(); ++i) {
+                out[i] = mData[i];
+            }
+            return out;
+        }
+
+        [[nodiscard]] size_t GetSize() const noexcept { return mData.GetSize(); }
+
+        [[nodiscard]] T &operator[](const size_t idx) noexcept { return mData[idx]; }
+
+        [[nodiscard]] const T &operator[](const size_t idx) const noexcept { return mData[idx]; }
+
+        [[nodiscard]] T *GetData() noexcept { return mData.GetData(); }
+
+        [[nodiscard]] const T *GetData() const noexcept { return mData.GetData(); }
+
+        DVector &operator+=(const DVector &rhs) {
+            CheckSameSize(rhs);
+            Parallel::Add(GetData(), rhs.GetData(), GetData(), GetSize());
+            return *this;
+        }
+
+        DVector &operator-=(const DVector &rhs) {
+            CheckSameSize(rhs);
+            Parallel::Sub(GetData(), rhs.GetData(), GetData(), GetSize());
+            return *this;
+        }
+
+        DVector &operator*=(const T scalar) {
+            Parallel::Scale(GetData(), scalar, GetData(), GetSize());
+            return *this;
+        }
+
+        /**
+         * throws std::invalid_argument when rhs has a different length
+         */
+        void CheckSameSize(const DVector &rhs) const {
+            if (rhs.GetSize() != GetSize()) {
+                throw std::invalid_argument("rhs and lhs vectors have differing lengths");
+            }
+        }
+
+    private:
+        AlignedBuffer<T> mData;
+    };
+
+    template<typename T>
+    [[nodiscard]] DVector<T> operator+(const DVector<T> &lhs, const DVector<T> &rhs) {
+        lhs.CheckSameSize(rhs);
+        DVector<T> out(lhs.GetSize());
+        Parallel::Add(lhs.GetData(), rhs.GetData(), out.GetData(), out.GetSize());
+        return out;
+    }
+
+    template<typename T>
+    [[nodiscard]] DVector<T> operator+(DVector<T> &&lhs, const DVector<T> &rhs) {
+        lhs += rhs;
+        return std::move(lhs);
+    }
+
+    template<typename T>
+    [[nodiscard]] DVector<T> operator-(const DVector<T> &lhs, const DVector<T> &rhs) {
+        lhs.CheckSameSize(rhs);
+        DVector<T> out(lhs.GetSize());
+        Parallel::Sub(lhs.GetData(), rhs.GetData(), out.GetData(), out.GetSize());
+        return out;
+    }
+
+    template<typename T>
+    [[nodiscard]] DVector<T> operator-(DVector<T> &&lhs, const DVector<T> &rhs) {
+        lhs -= rhs;
+        return std::move(lhs);
+    }
+
+    template<typename T>
+    [[nodiscard]] DVector<T> operator*(const DVector<T> &lhs, const std::type_identity_t<T> scalar) {
+        DVector<T> out(lhs.GetSize());
+        Parallel::Scale(lhs.GetData(), scalar, out.GetData(), out.GetSize());
+        return out;
+    }
+
+    template<typename T>
+    [[nodiscard]] DVector<T> operator*(DVector<T> &&lhs, const std::type_identity_t<T> scalar) {
+        lhs *= scalar;
+        return std::move(lhs);
+    }
+
+    template<typename T>
+    [[nodiscard]] DVector<T> operator*(const std::type_identity_t<T> scalar, const DVector<T> &rhs) {
+        return rhs * scalar;
+    }
+
+    template<typename T>
+    [[nodiscard]] DVector<T> operator*(const std::type_identity_t<T> scalar, DVector<T> &&rhs) {
+        return std::move(rhs) * scalar;
+    }
+
+    /**
+     * Dot product
+     */
+    template<typename T>
+    [[nodiscard]] T operator*(const DVector<T> &lhs, const DVector<T> &rhs) {
+        lhs.CheckSameSize(rhs);
+        return Simd::Dot(lhs.GetData(), rhs.GetData(), lhs.GetSize());
+    }
+}
+
+#endif //DRAWING_DVECTOR_H
@@ -0,0 +1,495 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_EIGEN_H
+#define DRAWING_EIGEN_H
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+#include "cmatrix.h"
+#include "cvector.h"
+#include "lu.h"
+#include "parallel.h"
+#include "vector_array.h"
+
+/**
+ * Jacobi eigen and singular value decompositions of small CMatrix sizes.
+ *
+ * The 3x3 cases run a fixed number of sweeps with no data dependent branches, so the same kernel
+ * decomposes one matrix at a time or, through BatchSymmetricEigen and BatchSvd, four float matrices
+ * per SSE register from the lanes of a VectorArray. Other sizes sweep until the off diagonal
+ * entries are down to rounding, about n times the machine epsilon relative to the diagonal, or
+ * until kMaxJacobiSweeps; IsConverged() tells which.
+ */
+namespace QS::LinAlg {
+
+    namespace Detail {
+        /// sweeps of the 3x3 kernels; cyclic Jacobi converges quadratically, and a float or double
+        /// 3x3 matrix is diagonal to rounding after 4 or 5
+        constexpr int kJacobiSweeps = 6;
+
+        /// sweep limit of the general sizes
+        constexpr int kMaxJacobiSweeps = 64;
+
+        // scalar lane operations of the 3x3 kernels; the SSE lanes in eigen.cpp provide the same
+        template<typename T>
+        constexpr T Select(const bool mask, const T a, const T b) noexcept {
+            return mask ? a : b;
+        }
+
+        template<typename T>
+        T Sqrt(const T value) noexcept {
+            return std::sqrt(value);
+        }
+
+        /**
+         * Jacobi rotation in the (p, q) plane that zeroes apq of a symmetric 3x3 matrix, r being the
+         * remaining index, and that is accumulated into the columns p and q of v
+         */
+        template<typename L>
+        void JacobiRotate(L &app, L &aqq, L &apq, L &arp, L &arq, L *vp, L *vq) noexcept {
+            // t = tan of the rotation angle, the smaller root of t^2 + 2 t (aqq - app) / (2 apq) = 1
+            const L d = aqq - app;
+            const L twoApq = apq + apq;
+            const L denominator = Abs(d) + Sqrt(d * d + twoApq * twoApq);
+            L t = twoApq / Select(denominator == L(), L(1), denominator);
+            t = Select(d < L(), -t, t);
+            const L c = L(1) / Sqrt(t * t + L(1));
+            const L s = t * c;
+
+            app = app - t * apq;
+            aqq = aqq + t * apq;
+            apq = L();
+            const L rp = arp, rq = arq;
+            arp = c * rp - s * rq;
+            arq = s * rp + c * rq;
+            for (int k = 0; k < 3; ++k) {
+                const L kp = vp[k], kq = vq[k];
+                vp[k] = c * kp - s * kq;
+                vq[k] = s * kp + c * kq;
+            }
+        }
+
+        /**
+         * swaps the values a and b and the columns u and v when a > b
+         */
+        template<typename L>
+        void SortPair(L &a, L &b, L *u, L *v) noexcept {
+            const auto swap = b < a;
+            const L low = Select(swap, b, a);
+            b = Select(swap, a, b);
+            a = low;
+            for (int k = 0; k < 3; ++k) {
+                const L uk = u[k];
+                u[k] = Select(swap, v[k], uk);
+                v[k] = Select(swap, uk, v[k]);
+            }
+        }
+
+        /**
+         * Eigen decomposition of the symmetric 3x3 matrix given by its upper triangle
+         * a = (a00, a01, a02, a11, a12, a22). values receives the eigenvalues in ascending order and
+         * vectors the matching unit eigenvectors, column major.
+         */
+        template<typename L>
+        void SymmetricEigen3(const L *a, L *values, L *vectors) noexcept {
+            L a00 = a[0], a01 = a[1], a02 = a[2], a11 = a[3], a12 = a[4], a22 = a[5];
+            for (int i = 0; i < 9; ++i) {
+                vectors[i] = i % 4 == 0 ? L(1) : L();
+            }
+            for (int sweep = 0; sweep < kJacobiSweeps; ++sweep) {
+                JacobiRotate(a00, a11, a01, a02, a12, vectors, vectors + 3);
+                JacobiRotate(a00, a22, a02, a01, a12, vectors, vectors + 6);
+                JacobiRotate(a11, a22, a12, a01, a02, vectors + 3, vectors + 6);
+            }
+            values[0] = a00;
+            values[1] = a11;
+            values[2] = a22;
+            SortPair(values[0], values[1], vectors, vectors + 3);
+            SortPair(values[1], values[2], vectors + 3, vectors + 6);
+            SortPair(values[0], values[1], vectors, vectors + 3);
+        }
+
+        /**
+         * Givens rotation of rows i and j of the column major b that zeroes b(j, col), accumulated
+         * into the columns i and j of u
+         */
+        template<typename L>
+        void GivensRotate(L *b, L *u, const int i, const int j, const int col) noexcept {
+            const L x = b[col * 3 + i], y = b[col * 3 + j];
+            const L r = Sqrt(x * x + y * y);
+            const auto zero = r == L();
+            const L inverse = L(1) / Select(zero, L(1), r);
+            const L c = Select(zero, L(1), x * inverse);
+            const L s = y * inverse;
+            for (int k = 0; k < 3; ++k) {
+                const L bi = b[k * 3 + i], bj = b[k * 3 + j];
+                b[k * 3 + i] = c * bi + s * bj;
+                b[k * 3 + j] = c * bj - s * bi;
+                const L ui = u[i * 3 + k], uj = u[j * 3 + k];
+                u[i * 3 + k] = c * ui + s * uj;
+                u[j * 3 + k] = c * uj - s * ui;
+            }
+        }
+
+        /**
+         * SVD m = u * diag(sigma) * v^T of a column major 3x3 matrix, sigma descending and non
+         * negative. v diagonalizes m^T m; a Givens QR of m * v then gives u and sigma, following
+         * McAdams et al., Computing the Singular Value Decomposition of 3x3 matrices with minimal
+         * branching and elementary floating point operations.
+         */
+        template<typename L>
+        void Svd3(const L *m, L *u, L *sigma, L *v) noexcept {
+            L gram[6];
+            int idx = 0;
+            for (int i = 0; i < 3; ++i) {
+                for (int j = i; j < 3; ++j) {
+                    gram[idx++] = m[i * 3] * m[j * 3] + m[i * 3 + 1] * m[j * 3 + 1] + m[i * 3 + 2] * m[j * 3 + 2];
+                }
+            }
+            L values[3], vectors[9];
+            SymmetricEigen3(gram, values, vectors);
+            // largest singular value first
+            for (int k = 0; k < 3; ++k) {
+                for (int r = 0; r < 3; ++r) {
+                    v[k * 3 + r] = vectors[(2 - k) * 3 + r];
+                }
+            }
+
+            L b[9];
+            for (int k = 0; k < 3; ++k) {
+                for (int r = 0; r < 3; ++r) {
+                    b[k * 3 + r] = m[r] * v[k * 3] + m[3 + r] * v[k * 3 + 1] + m[6 + r] * v[k * 3 + 2];
+                }
+            }
+            for (int i = 0; i < 9; ++i) {
+                u[i] = i % 4 == 0 ? L(1) : L();
+            }
+            GivensRotate(b, u, 0, 1, 0);
+            GivensRotate(b, u, 0, 2, 0);
+            GivensRotate(b, u, 1, 2, 1);
+            for (int k = 0; k < 3; ++k) {
+                const auto negative = b[k * 4] < L();
+                sigma[k] = Select(negative, -b[k * 4], b[k * 4]);
+                for (int r = 0; r < 3; ++r) {
+                    u[k * 3 + r] = Select(negative, -u[k * 3 + r], u[k * 3 + r]);
+                }
+            }
+        }
+
+        /**
+         * t = tan of the Jacobi rotation angle that zeroes gamma between two directions with
+         * squared lengths alpha and beta
+         */
+        template<typename T>
+        T JacobiTangent(const T alpha, const T beta, const T gamma) noexcept {
+            const T zeta = (beta - alpha) / (2 * gamma);
+            const T t = T(1) / (Abs(zeta) + std::sqrt(1 + zeta * zeta));
+            return zeta < T() ? -t : t;
+        }
+    }
+
+    template<class M>
+    class SymmetricEigen;
+
+    /**
+     * Eigen decomposition A = V * diag(values) * V^T of a symmetric CMatrix by the Jacobi method.
+     * Only the upper triangle of A is read. Eigenvalues are in ascending order and the columns of
+     * GetVectors() are the matching orthonormal eigenvectors.
+     */
+    template<int n, typename T>
+    class SymmetricEigen<CMatrix<n, n, T>> {
+    public:
+        using value_type = T;
+
+        explicit SymmetricEigen(const CMatrix<n, n, T> &a) {
+            if constexpr (n == 3) {
+                const T upper[6] = { a[0][0], a[1][0], a[2][0], a[1][1], a[2][1], a[2][2] };
+                T values[3], vectors[9];
+                Detail::SymmetricEigen3(upper, values, vectors);
+                for (size_t k = 0; k < 3; ++k) {
+                    mValues[k] = values[k];
+                    for (size_t r = 0; r < 3; ++r) {
+                        mVectors[k][r] = vectors[k * 3 + r];
+                    }
+                }
+            } else {
+                Decompose(a);
+            }
+        }
+
+        [[nodiscard]] const CVector<n, T> &GetValues() const noexcept { return mValues; }
+
+        [[nodiscard]] const CMatrix<n, n, T> &GetVectors() const noexcept { return mVectors; }
+
+        /**
+         * Whether the sweeps reduced the off diagonal entries to rounding before kMaxJacobiSweeps
+         */
+        [[nodiscard]] bool IsConverged() const noexcept { return mConverged; }
+
+    private:
+        void Decompose(const CMatrix<n, n, T> &upper) {
+            CMatrix<n, n, T> a;
+            for (size_t c = 0; c < n; ++c) {
+                for (size_t r = 0; r <= c; ++r) {
+                    a[c][r] = a[r][c] = upper[c][r];
+                }
+            }
+            mVectors = Identity<n, T>();
+            mConverged = false;
+            for (int sweep = 0; sweep < Detail::kMaxJacobiSweeps; ++sweep) {
+                T off = T(), diagonal = T();
+                for (size_t c = 0; c < n; ++c) {
+                    diagonal += a[c][c] * a[c][c];
+                    for (size_t r = 0; r < c; ++r) {
+                        off += a[c][r] * a[c][r];
+                    }
+                }
+                // every entry carries rounding of about n epsilon from the rotations before, so asking
+                // for less than that never ends in float
+                const T tolerance = T(n) * std::numeric_limits<T>::epsilon();
+                if (off <= tolerance * tolerance * diagonal) {
+                    mConverged = true;
+                    break;
+                }
+                for (size_t p = 0; p + 1 < n; ++p) {
+                    for (size_t q = p + 1; q < n; ++q) {
+                        if (a[q][p] != T()) {
+                            Rotate(a, p, q);
+                        }
+                    }
+                }
+            }
+            for (size_t k = 0; k < n; ++k) {
+                mValues[k] = a[k][k];
+            }
+            // selection sort, swapping the eigenvector columns along
+            for (size_t k = 0; k + 1 < n; ++k) {
+                size_t smallest = k;
+                for (size_t i = k + 1; i < n; ++i) {
+                    smallest = mValues[i] < mValues[smallest] ? i : smallest;
+                }
+                std::swap(mValues[k], mValues[smallest]);
+                std::swap(mVectors[k], mVectors[smallest]);
+            }
+        }
+
+        /**
+         * a = J^T a J for the rotation J in the (p, q) plane that zeroes a(p, q)
+         */
+        void Rotate(CMatrix<n, n, T> &a, const size_t p, const size_t q) {
+            const T t = Detail::JacobiTangent(a[p][p], a[q][q], a[q][p]);
+            const T c = T(1) / std::sqrt(t * t + 1);
+            const T s = t * c;
+            for (size_t k = 0; k < n; ++k) {
+                const T kp = a[p][k], kq = a[q][k];
+                a[p][k] = c * kp - s * kq;
+                a[q][k] = s * kp + c * kq;
+            }
+            for (size_t k = 0; k < n; ++k) {
+                const T pk = a[k][p], qk = a[k][q];
+                a[k][p] = c * pk - s * qk;
+                a[k][q] = s * pk + c * qk;
+                const T vp = mVectors[p][k], vq = mVectors[q][k];
+                mVectors[p][k] = c * vp - s * vq;
+                mVectors[q][k] = s * vp + c * vq;
+            }
+        }
+
+        CVector<n, T> mValues;
+
+        CMatrix<n, n, T> mVectors;
+
+        bool mConverged = true;
+    };
+
+    template<class M>
+    class SVD;
+
+    /**
+     * Thin singular value decomposition A = U * diag(sigma) * V^T of a CMatrix with at least as
+     * many rows as columns. Singular values are non negative and descending; U has orthonormal
+     * columns wherever sigma is nonzero and V is orthogonal.
+     *
+     * 3x3 matrices use the branch-light kernel, whose small singular values carry the error of
+     * forming A^T A: about the machine epsilon times the largest. Other sizes use one-sided Jacobi
+     * rotations of the columns of A, which are accurate to the machine epsilon relative to each
+     * singular value.
+     */
+    template<int cols, int rows, typename T>
+    class SVD<CMatrix<cols, rows, T>> {
+    public:
+        static_assert(rows >= cols, "SVD requires at least as many rows as columns; decompose the transpose");
+
+        using value_type = T;
+
+        explicit SVD(const CMatrix<cols, rows, T> &a) {
+            if constexpr (cols == 3 && rows == 3) {
+                T m[9], u[9], sigma[3], v[9];
+                for (size_t i = 0; i < 9; ++i) {
+                    m[i] = a[i / 3][i % 3];
+                }
+                Detail::Svd3(m, u, sigma, v);
+                for (size_t k = 0; k < 3; ++k) {
+                    mSingularValues[k] = sigma[k];
+                    for (size_t r = 0; r < 3; ++r) {
+                        mU[k][r] = u[k * 3 + r];
+                        mV[k][r] = v[k * 3 + r];
+                    }
+                }
+            } else {
+                Decompose(a);
+            }
+        }
+
+        [[nodiscard]] const CMatrix<cols, rows, T> &GetU() const noexcept { return mU; }
+
+        [[nodiscard]] const CVector<cols, T> &GetSingularValues() const noexcept { return mSingularValues; }
+
+        [[nodiscard]] const CMatrix<cols, cols, T> &GetV() const noexcept { return mV; }
+
+        /**
+         * Whether a sweep found every pair of columns orthogonal to rounding before kMaxJacobiSweeps
+         */
+        [[nodiscard]] bool IsConverged() const noexcept { return mConverged; }
+
+    private:
+        void Decompose(const CMatrix<cols, rows, T> &a) {
+            mU = a;
+            mV = Identity<cols, T>();
+            mConverged = false;
+            // the dot products below are rounded to about rows epsilon, so columns count as orthogonal
+            // once gamma is that small relative to their lengths
+            const T tolerance = T(rows) * std::numeric_limits<T>::epsilon();
+            for (int sweep = 0; sweep < Detail::kMaxJacobiSweeps; ++sweep) {
+                bool rotated = false;
+                for (size_t p = 0; p + 1 < cols; ++p) {
+                    for (size_t q = p + 1; q < cols; ++q) {
+                        const T alpha = mU[p] * mU[p];
+                        const T beta = mU[q] * mU[q];
+                        const T gamma = mU[p] * mU[q];
+                        if (Detail::Abs(gamma) <= tolerance * std::sqrt(alpha * beta)) {
+                            continue;
+                        }
+                        const T t = Detail::JacobiTangent(alpha, beta, gamma);
+                        const T c = T(1) / std::sqrt(t * t + 1);
+                        const T s = t * c;
+                        // a rotation this close to the identity changes nothing but the rounding
+                        if (Detail::Abs(s) <= std::numeric_limits<T>::epsilon()) {
+                            continue;
+                        }
+                        rotated = true;
+                        const CVector<rows, T> up = mU[p];
+                        mU[p] = up * c - mU[q] * s;
+                        mU[q] = up * s + mU[q] * c;
+                        const CVector<cols, T> vp = mV[p];
+                        mV[p] = vp * c - mV[q] * s;
+                        mV[q] = vp * s + mV[q] * c;
+                    }
+                }
+                if (!rotated) {
+                    mConverged = true;
+                    break;
+                }
+            }
+            // the rotations leave V orthogonal only to the rounding of each; one modified Gram-Schmidt
+            // pass takes that back to a single rounding
+            for (size_t k = 0; k < cols; ++k) {
+                for (size_t j = 0; j < k; ++j) {
+                    mV[k] = mV[k] - mV[j] * (mV[j] * mV[k]);
+                }
+                mV[k] = mV[k] * (T(1) / std::sqrt(mV[k] * mV[k]));
+            }
+            for (size_t k = 0; k < cols; ++k) {
+                mSingularValues[k] = std::sqrt(mU[k] * mU[k]);
+                if (mSingularValues[k] != T()) {
+                    mU[k] = mU[k] * (T(1) / mSingularValues[k]);
+                }
+            }
+            for (size_t k = 0; k + 1 < cols; ++k) {
+                size_t largest = k;
+                for (size_t i = k + 1; i < cols; ++i) {
+                    largest = mSingularValues[i] > mSingularValues[largest] ? i : largest;
+                }
+                std::swap(mSingularValues[k], mSingularValues[largest]);
+                std::swap(mU[k], mU[largest]);
+                std::swap(mV[k], mV[largest]);
+            }
+        }
+
+        CMatrix<cols, rows, T> mU;
+
+        CVector<cols, T> mSingularValues;
+
+        CMatrix<cols, cols, T> mV;
+
+        bool mConverged = true;
+    };
+
+    /**
+     * Decomposes every symmetric 3x3 matrix of a batch like SymmetricEigen.
+     * \param matrices upper triangles (a00, a01, a02, a11, a12, a22)
+     * \param values resized to the batch; ascending eigenvalues
+     * \param vectors resized to the batch; eigenvectors, column major
+     */
+    template<typename T>
+    void BatchSymmetricEigen(const VectorArray<6, T> &matrices, VectorArray<3, T> &values, VectorArray<9, T> &vectors) {
+        values.Resize(matrices.GetSize());
+        vectors.Resize(matrices.GetSize());
+        for (size_t i = 0; i < matrices.GetSize(); ++i) {
+            T a[6], l[3], v[9];
+            for (size_t c = 0; c < 6; ++c) {
+                a[c] = matrices.GetLane(c)[i];
+            }
+            Detail::SymmetricEigen3(a, l, v);
+            for (size_t c = 0; c < 3; ++c) {
+                values.GetLane(c)[i] = l[c];
+            }
+            for (size_t c = 0; c < 9; ++c) {
+                vectors.GetLane(c)[i] = v[c];
+            }
+        }
+    }
+
+    /**
+     * Decomposes every 3x3 matrix of a batch like SVD.
+     * \param matrices column major 3x3 matrices, component c * 3 + r holding m[c][r]
+     * \param u, v resized to the batch; column major
+     * \param sigma resized to the batch; descending singular values
+     */
+    template<typename T>
+    void BatchSvd(const VectorArray<9, T> &matrices, VectorArray<9, T> &u, VectorArray<3, T> &sigma,
+                  VectorArray<9, T> &v) {
+        u.Resize(matrices.GetSize());
+        sigma.Resize(matrices.GetSize());
+        v.Resize(matrices.GetSize());
+        for (size_t i = 0; i < matrices.GetSize(); ++i) {
+            T m[9], mu[9], s[3], mv[9];
+            for (size_t c = 0; c < 9; ++c) {
+                m[c] = matrices.GetLane(c)[i];
+            }
+            Detail::Svd3(m, mu, s, mv);
+            for (size_t c = 0; c < 9; ++c) {
+                u.GetLane(c)[i] = mu[c];
+                v.GetLane(c)[i] = mv[c];
+            }
+            for (size_t c = 0; c < 3; ++c) {
+                sigma.GetLane(c)[i] = s[c];
+            }
+        }
+    }
+
+    // vectorized float overloads, defined in eigen.cpp. Four matrices are decomposed per SSE
+    // register and large batches are split across the thread pool.
+    void BatchSymmetricEigen(const VectorArray<6, float> &matrices, VectorArray<3, float> &values,
+                             VectorArray<9, float> &vectors);
+
+    void BatchSvd(const VectorArray<9, float> &matrices, VectorArray<9, float> &u, VectorArray<3, float> &sigma,
+                  VectorArray<9, float> &v);
+}
+
+#endif //DRAWING_EIGEN_H
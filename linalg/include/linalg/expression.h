@@ -0,0 +1,409 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_EXPRESSION_H
+#define DRAWING_EXPRESSION_H
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "simd.h"
+
+/**
+ * Lazy element-wise arithmetic for the vector and matrix types.
+ *
+ * operator+, operator- and scalar operator* do not compute anything; they return a small node that
+ * refers to its operands. The work happens in one fused loop when the node is assigned to (or used
+ * to construct) an RVector, CVector, RMatrix or CMatrix, so a chain such as a * s + b - c creates no
+ * intermediate vectors.
+ *
+ * Every expression, including the storage types themselves, provides
+ *  - ExpressionShape: a tag describing its kind and dimensions. Only equal shapes can be combined.
+ *  - value_type: the element type.
+ *  - Eval(i) for vectors or Eval(outer, inner) for matrices, where outer and inner follow the
+ *    storage type's own operator[] (m[outer][inner]).
+ *
+ * Operands of equal shape may differ in element type. A node's value_type is the type its operation
+ * yields, so adding a float vector to a double vector evaluates in double, and assigning the result
+ * to either storage type converts once per element.
+ *
+ * Lvalue operands are held by reference and rvalue operands by value, so an expression saved with
+ * auto never refers to a destroyed temporary. It still refers to the named operands it was built
+ * from.
+ *
+ * Assignment writes element by element, so an expression that reads the destination at other
+ * indices than it writes, such as m = AsRowMajor(Transpose(m)), would see elements it has already
+ * overwritten. MayAlias detects that case and the assignment evaluates into a temporary first.
+ */
+namespace QS::LinAlg::Expr {
+
+    /// shape of an RVector
+    template<int n>
+    struct RowVector {
+        static constexpr int length = n;
+    };
+
+    /// shape of a CVector
+    template<int n>
+    struct ColumnVector {
+        static constexpr int length = n;
+    };
+
+    /// shape of an RMatrix, indexed m[row][col]
+    template<int row, int col>
+    struct RowMajor {
+        static constexpr int rows = row;
+        static constexpr int cols = col;
+        static constexpr int outer = row;
+        static constexpr int inner = col;
+    };
+
+    /// shape of a CMatrix, indexed m[col][row]
+    template<int col, int row>
+    struct ColumnMajor {
+        static constexpr int rows = row;
+        static constexpr int cols = col;
+        static constexpr int outer = col;
+        static constexpr int inner = row;
+    };
+
+    template<class E>
+    using ShapeOf = typename std::remove_cvref_t<E>::ExpressionShape;
+
+    template<class E>
+    using ValueOf = typename std::remove_cvref_t<E>::value_type;
+
+    template<class E>
+    concept Expression = requires {
+        typename ShapeOf<E>;
+        typename ValueOf<E>;
+    };
+
+    template<class E>
+    concept VectorExpression = Expression<E> && requires { ShapeOf<E>::length; };
+
+    template<class E>
+    concept MatrixExpression = Expression<E> && requires { ShapeOf<E>::outer; };
+
+    template<class Shape>
+    struct IsRowMajor : std::false_type {};
+
+    template<int row, int col>
+    struct IsRowMajor<RowMajor<row, col>> : std::true_type {};
+
+    template<class Shape>
+    struct IsColumnMajor : std::false_type {};
+
+    template<int col, int row>
+    struct IsColumnMajor<ColumnMajor<col, row>> : std::true_type {};
+
+    template<class Shape>
+    struct IsColumnVector : std::false_type {};
+
+    template<int n>
+    struct IsColumnVector<ColumnVector<n>> : std::true_type {};
+
+    template<class E>
+    concept RowMajorExpression = Expression<E> && IsRowMajor<ShapeOf<E>>::value;
+
+    template<class E>
+    concept ColumnMajorExpression = Expression<E> && IsColumnMajor<ShapeOf<E>>::value;
+
+    template<class E>
+    concept ColumnVectorExpression = Expression<E> && IsColumnVector<ShapeOf<E>>::value;
+
+    template<class E, class Shape>
+    concept ExpressionOf = Expression<E> && std::same_as<ShapeOf<E>, Shape>;
+
+    /// an expression whose elements live in contiguous memory reachable through GetData()
+    template<class E>
+    concept Dense = Expression<E> && requires(const std::remove_cvref_t<E> &e) {
+        { e.GetData() } -> std::same_as<const ValueOf<E> *>;
+    };
+
+    /**
+     * an expression whose Eval reads an element from memory instead of computing one: the storage
+     * types and the views of view.h, which declare kAddressable. Kernels that visit elements more
+     * than once read these in place; other expressions are evaluated into a temporary first.
+     */
+    template<class E>
+    concept Addressable = Dense<E> || (Expression<E> && std::remove_cvref_t<E>::kAddressable);
+
+    /// lvalue operands are referenced, rvalue operands are moved into the node
+    template<class E>
+    using Stored = std::conditional_t<std::is_lvalue_reference_v<E>,
+            const std::remove_reference_t<E> &,
+            std::remove_cvref_t<E>>;
+
+    /// number of elements of an expression
+    template<class E>
+    inline constexpr size_t kSizeOf = [] {
+        if constexpr (requires { ShapeOf<E>::length; }) {
+            return static_cast<size_t>(ShapeOf<E>::length);
+        } else {
+            return static_cast<size_t>(ShapeOf<E>::outer) * ShapeOf<E>::inner;
+        }
+    }();
+
+    /**
+     * Whether [first, last) and [begin, end) share memory. Addresses of different objects cannot be
+     * ordered during constant evaluation, so it answers true there.
+     */
+    constexpr bool Overlaps(const void *first, const void *last, const void *begin, const void *end) noexcept {
+        if (std::is_constant_evaluated()) {
+            return true;
+        }
+        const std::less<const void *> less;
+        return less(first, end) && less(begin, last);
+    }
+
+    /**
+     * Whether writing e element by element to [begin, end) could overwrite an element before e reads
+     * it: e reads that memory through a view, or reordered, below AsRowMajor or AsColumnMajor. A
+     * stored operand read in place, as m in m = m + n, is safe. Nodes and views decide through a
+     * MayAlias member of their own.
+     */
+    template<class E>
+    constexpr bool MayAlias(const E &e, const void *begin, const void *end, const bool reordered = false) noexcept {
+        if constexpr (requires { e.MayAlias(begin, end, reordered); }) {
+            return e.MayAlias(begin, end, reordered);
+        } else if constexpr (Dense<E>) {
+            return reordered && Overlaps(e.GetData(), e.GetData() + kSizeOf<E>, begin, end);
+        } else {
+            return false;
+        }
+    }
+
+    struct Add {
+        template<typename L, typename R>
+        static constexpr auto Apply(const L &lhs, const R &rhs) { return lhs + rhs; }
+    };
+
+    struct Sub {
+        template<typename L, typename R>
+        static constexpr auto Apply(const L &lhs, const R &rhs) { return lhs - rhs; }
+    };
+
+    template<class E>
+    class MatrixSlice;
+
+    /**
+     * Common interface of the expression nodes
+     */
+    template<class Derived>
+    class Node {
+    public:
+        [[nodiscard]] constexpr auto operator[](const size_t idx) const {
+            const auto &self = static_cast<const Derived &>(*this);
+            if constexpr (MatrixExpression<Derived>) {
+                return MatrixSlice<Derived>(self, idx);
+            } else {
+                return self.Eval(idx);
+            }
+        }
+    };
+
+    /**
+     * m[outer] on a matrix expression, so m[outer][inner] works as it does on the storage types
+     */
+    template<class E>
+    class MatrixSlice {
+    public:
+        constexpr MatrixSlice(const E &expr, const size_t outer) : mExpr{expr}, mOuter{outer} {}
+
+        [[nodiscard]] constexpr auto operator[](const size_t inner) const {
+            return mExpr.Eval(mOuter, inner);
+        }
+
+    private:
+        const E &mExpr;
+        size_t mOuter;
+    };
+
+    /**
+     * Element-wise lhs op rhs
+     */
+    template<class Op, class L, class R>
+    class Binary : public Node<Binary<Op, L, R>> {
+    public:
+        using ExpressionShape = ShapeOf<L>;
+        using value_type = decltype(Op::Apply(std::declval<ValueOf<L>>(), std::declval<ValueOf<R>>()));
+
+        constexpr Binary(L &&lhs, R &&rhs) : mLhs(std::forward<L>(lhs)), mRhs(std::forward<R>(rhs)) {}
+
+        template<typename... Index>
+        [[nodiscard]] constexpr value_type Eval(const Index... idx) const {
+            return Op::Apply(mLhs.Eval(idx...), mRhs.Eval(idx...));
+        }
+
+        /**
+         * Writes all length elements to out
+         */
+        template<int length, typename T>
+        constexpr void EvaluateTo(T *out) const {
+            if constexpr (Dense<L> && Dense<R> && std::is_same_v<ValueOf<L>, T> && std::is_same_v<ValueOf<R>, T>) {
+                if constexpr (std::is_same_v<Op, Add>) {
+                    Simd::Add<length>(mLhs.GetData(), mRhs.GetData(), out);
+                    return;
+                } else if constexpr (std::is_same_v<Op, Sub>) {
+                    Simd::Sub<length>(mLhs.GetData(), mRhs.GetData(), out);
+                    return;
+                }
+            }
+            Detail::For<length>([&](const size_t i) { out[i] = Eval(i); });
+        }
+
+        [[nodiscard]] constexpr bool MayAlias(const void *begin, const void *end, const bool reordered) const noexcept {
+            return Expr::MayAlias(mLhs, begin, end, reordered) || Expr::MayAlias(mRhs, begin, end, reordered);
+        }
+
+    private:
+        Stored<L> mLhs;
+        Stored<R> mRhs;
+    };
+
+    /**
+     * Element-wise expr * scalar
+     */
+    template<class E, typename S>
+    class Scale : public Node<Scale<E, S>> {
+    public:
+        using ExpressionShape = ShapeOf<E>;
+        using value_type = decltype(std::declval<ValueOf<E>>() * std::declval<S>());
+
+        constexpr Scale(E &&expr, const S scalar) : mExpr(std::forward<E>(expr)), mScalar{scalar} {}
+
+        template<typename... Index>
+        [[nodiscard]] constexpr value_type Eval(const Index... idx) const {
+            return mExpr.Eval(idx...) * mScalar;
+        }
+
+        template<int length, typename T>
+        constexpr void EvaluateTo(T *out) const {
+            if constexpr (Dense<E> && std::is_same_v<ValueOf<E>, T> && std::is_same_v<S, T>) {
+                Simd::Scale<length>(mExpr.GetData(), mScalar, out);
+            } else {
+                Detail::For<length>([&](const size_t i) { out[i] = Eval(i); });
+            }
+        }
+
+        [[nodiscard]] constexpr bool MayAlias(const void *begin, const void *end, const bool reordered) const noexcept {
+            return Expr::MayAlias(mExpr, begin, end, reordered);
+        }
+
+    private:
+        Stored<E> mExpr;
+        S mScalar;
+    };
+
+    /**
+     * Writes the elements of the vector expression e to out in a single pass
+     */
+    template<int length, class E, typename T>
+    constexpr void Evaluate(const E &e, T *out) {
+        if constexpr (requires { e.template EvaluateTo<length>(out); }) {
+            e.template EvaluateTo<length>(out);
+        } else {
+            Detail::For<length>([&](const size_t i) { out[i] = e.Eval(i); });
+        }
+    }
+
+    /**
+     * Element at row r and column c of a matrix expression regardless of its storage order
+     */
+    template<class E> requires MatrixExpression<E>
+    constexpr auto At(const E &e, const size_t r, const size_t c) {
+        if constexpr (IsRowMajor<ShapeOf<E>>::value) {
+            return e.Eval(r, c);
+        } else {
+            return e.Eval(c, r);
+        }
+    }
+
+    /**
+     * Type the dot and matrix products accumulate sums of T in. Specialize it for compact element
+     * types whose sums would overflow or lose precision, as Fixed does.
+     */
+    template<typename T>
+    struct Accumulator {
+        using type = T;
+    };
+
+    template<typename T>
+    using AccumulatorOf = typename Accumulator<T>::type;
+
+    /**
+     * sum of lhs[i] * rhs[i] over two vector expressions of equal shape, accumulated in Acc
+     */
+    template<typename Acc, class L, class R> requires VectorExpression<L> && VectorExpression<R>
+    constexpr Acc AccumulateDot(const L &lhs, const R &rhs) {
+        Acc out = Acc();
+        Detail::For<ShapeOf<L>::length>([&](const size_t i) {
+            out += static_cast<Acc>(lhs.Eval(i)) * static_cast<Acc>(rhs.Eval(i));
+        });
+        return out;
+    }
+
+    /**
+     * sum of lhs[i] * rhs[i] over two vector expressions of equal shape
+     */
+    template<class L, class R> requires VectorExpression<L> && VectorExpression<R>
+    constexpr auto Dot(const L &lhs, const R &rhs) {
+        using T = decltype(lhs.Eval(0) * rhs.Eval(0));
+        if constexpr (Dense<L> && Dense<R> && std::is_same_v<ValueOf<L>, T> && std::is_same_v<ValueOf<R>, T> &&
+                      std::is_same_v<AccumulatorOf<T>, T>) {
+            return Simd::Dot<ShapeOf<L>::length>(lhs.GetData(), rhs.GetData());
+        } else {
+            return static_cast<T>(AccumulateDot<AccumulatorOf<T>>(lhs, rhs));
+        }
+    }
+}
+
+namespace QS::LinAlg {
+
+    template<class L, class R> requires Expr::Expression<L> && Expr::Expression<R>
+    [[nodiscard]] constexpr auto operator+(L &&lhs, R &&rhs) {
+        static_assert(std::is_same_v<Expr::ShapeOf<L>, Expr::ShapeOf<R>>, "rhs and lhs have differing dimensions");
+        return Expr::Binary<Expr::Add, L, R>(std::forward<L>(lhs), std::forward<R>(rhs));
+    }
+
+    template<class L, class R> requires Expr::Expression<L> && Expr::Expression<R>
+    [[nodiscard]] constexpr auto operator-(L &&lhs, R &&rhs) {
+        static_assert(std::is_same_v<Expr::ShapeOf<L>, Expr::ShapeOf<R>>, "rhs and lhs have differing dimensions");
+        return Expr::Binary<Expr::Sub, L, R>(std::forward<L>(lhs), std::forward<R>(rhs));
+    }
+
+    template<class E> requires Expr::Expression<E>
+    [[nodiscard]] constexpr auto operator*(E &&lhs, const Expr::ValueOf<E> scalar) {
+        return Expr::Scale<E, Expr::ValueOf<E>>(std::forward<E>(lhs), scalar);
+    }
+
+    template<class E> requires Expr::Expression<E>
+    [[nodiscard]] constexpr auto operator*(const Expr::ValueOf<E> scalar, E &&rhs) {
+        return Expr::Scale<E, Expr::ValueOf<E>>(std::forward<E>(rhs), scalar);
+    }
+
+    /**
+     * Dot product
+     */
+    template<class L, class R> requires Expr::VectorExpression<L> && Expr::VectorExpression<R>
+    [[nodiscard]] constexpr auto operator*(const L &lhs, const R &rhs) {
+        static_assert(std::is_same_v<Expr::ShapeOf<L>, Expr::ShapeOf<R>>, "rhs and lhs have differing dimensions");
+        return Expr::Dot(lhs, rhs);
+    }
+
+    /**
+     * Dot product accumulated in Acc, e.g. Dot<double>(a, b) on float vectors
+     */
+    template<typename Acc, class L, class R> requires Expr::VectorExpression<L> && Expr::VectorExpression<R>
+    [[nodiscard]] constexpr Acc Dot(const L &lhs, const R &rhs) {
+        static_assert(std::is_same_v<Expr::ShapeOf<L>, Expr::ShapeOf<R>>, "rhs and lhs have differing dimensions");
+        return Expr::AccumulateDot<Acc>(lhs, rhs);
+    }
+}
+
+#endif //DRAWING_EXPRESSION_H
@@ -0,0 +1,148 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_FIXED_H
+#define DRAWING_FIXED_H
+
+#include <compare>
+#include <cstdint>
+#include <type_traits>
+
+#include "expression.h"
+
+namespace QS::LinAlg {
+
+    namespace Detail {
+        /// integer holding the product of two Rep values
+        template<typename Rep>
+        struct WideRep;
+
+        template<>
+        struct WideRep<int8_t> {
+            using type = int16_t;
+        };
+
+        template<>
+        struct WideRep<int16_t> {
+            using type = int32_t;
+        };
+
+        template<>
+        struct WideRep<int32_t> {
+            using type = int64_t;
+        };
+
+        template<>
+        struct WideRep<int64_t> {
+            using type = int64_t;
+        };
+    }
+
+    /**
+     * Signed fixed-point number with fraction fractional bits held in the integer Rep, e.g.
+     * Fixed<16> is Q15.16 in 32 bits. Converts implicitly from arithmetic values, rounding to the
+     * nearest step, and explicitly back to them.
+     *
+     * Usable as the element type of the vector and matrix types. Dot and matrix products sum in
+     * Fixed<fraction, wider Rep>, so only the final result is narrowed back to Rep. Products
+     * truncate towards negative infinity. Fixed<fraction, int64_t> has no wider type, so its
+     * products overflow once both raw values exceed 32 bits.
+     */
+    template<int fraction, typename Rep = int32_t>
+    class Fixed {
+        static_assert(std::is_integral_v<Rep> && std::is_signed_v<Rep>, "Rep must be a signed integer");
+        static_assert(fraction > 0 && fraction < static_cast<int>(sizeof(Rep) * 8) - 1,
+                      "fraction must leave room for the sign and integer bits");
+
+    public:
+        using Wide = typename Detail::WideRep<Rep>::type;
+
+        /// raw value of 1
+        static constexpr Rep kOne = Rep(1) << fraction;
+
+        constexpr Fixed() noexcept = default;
+
+        template<typename A> requires std::is_arithmetic_v<A>
+        constexpr Fixed(const A value) noexcept {
+            if constexpr (std::is_floating_point_v<A>) {
+                const A scaled = value * kOne;
+                mRaw = static_cast<Rep>(scaled < A() ? scaled - A(0.5) : scaled + A(0.5));
+            } else {
+                mRaw = static_cast<Rep>(static_cast<Rep>(value) * kOne);
+            }
+        }
+
+        /**
+         * Converts between representations of the same precision, e.g. a widened sum back to Rep
+         */
+        template<typename R>
+        constexpr Fixed(const Fixed<fraction, R> &other) noexcept : mRaw{static_cast<Rep>(other.GetRaw())} {}
+
+        [[nodiscard]] static constexpr Fixed FromRaw(const Rep raw) noexcept {
+            Fixed out;
+            out.mRaw = raw;
+            return out;
+        }
+
+        [[nodiscard]] constexpr Rep GetRaw() const noexcept { return mRaw; }
+
+        template<typename A> requires std::is_arithmetic_v<A>
+        [[nodiscard]] explicit constexpr operator A() const noexcept {
+            if constexpr (std::is_floating_point_v<A>) {
+                return static_cast<A>(mRaw) / kOne;
+            } else {
+                return static_cast<A>(mRaw / kOne);
+            }
+        }
+
+        constexpr Fixed &operator+=(const Fixed rhs) noexcept {
+            mRaw = static_cast<Rep>(mRaw + rhs.mRaw);
+            return *this;
+        }
+
+        constexpr Fixed &operator-=(const Fixed rhs) noexcept {
+            mRaw = static_cast<Rep>(mRaw - rhs.mRaw);
+            return *this;
+        }
+
+        constexpr Fixed &operator*=(const Fixed rhs) noexcept {
+            mRaw = static_cast<Rep>(static_cast<Wide>(mRaw) * rhs.mRaw >> fraction);
+            return *this;
+        }
+
+        constexpr Fixed &operator/=(const Fixed rhs) noexcept {
+            mRaw = static_cast<Rep>(static_cast<Wide>(mRaw) * kOne / rhs.mRaw);
+            return *this;
+        }
+
+        [[nodiscard]] friend constexpr Fixed operator+(Fixed lhs, const Fixed rhs) noexcept { return lhs += rhs; }
+
+        [[nodiscard]] friend constexpr Fixed operator-(Fixed lhs, const Fixed rhs) noexcept { return lhs -= rhs; }
+
+        [[nodiscard]] friend constexpr Fixed operator*(Fixed lhs, const Fixed rhs) noexcept { return lhs *= rhs; }
+
+        [[nodiscard]] friend constexpr Fixed operator/(Fixed lhs, const Fixed rhs) noexcept { return lhs /= rhs; }
+
+        [[nodiscard]] friend constexpr Fixed operator-(const Fixed value) noexcept {
+            return FromRaw(static_cast<Rep>(-value.mRaw));
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(Fixed, Fixed) noexcept = default;
+
+        [[nodiscard]] friend constexpr std::strong_ordering operator<=>(Fixed, Fixed) noexcept = default;
+
+    private:
+        Rep mRaw = 0;
+    };
+}
+
+namespace QS::LinAlg::Expr {
+
+    template<int fraction, typename Rep>
+    struct Accumulator<Fixed<fraction, Rep>> {
+        using type = Fixed<fraction, typename Fixed<fraction, Rep>::Wide>;
+    };
+}
+
+#endif //DRAWING_FIXED_H
@@ -0,0 +1,288 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_GEMM_H
+#define DRAWING_GEMM_H
+
+#include <cstddef>
+#include <type_traits>
+
+#include "simd.h"
+#include "unroll.h"
+
+/**
+ * Matrix multiply engine shared by the matrix types.
+ *
+ * Operands are passed as accessors: a(i, p) and b(p, j) return an element of the left and right
+ * operand and c(i, j) returns a reference into the output. This keeps the engine independent of
+ * the storage order of the matrix types and usable during constant evaluation. Products whose
+ * operands and output are all Strided float arrays skip the accessors at run time and go to the
+ * packed, dispatched micro kernel of Simd::Gemm.
+ */
+namespace QS::LinAlg::Gemm {
+
+    /// rows of the output computed by one micro kernel invocation
+    constexpr size_t kMicroRows = 4;
+
+    /// columns of the output computed by one micro kernel invocation
+    constexpr size_t kMicroCols = 4;
+
+    /// rows of the left operand kept hot in cache per block
+    constexpr size_t kBlockRows = 64;
+
+    /// length of the shared dimension walked per block
+    constexpr size_t kBlockDepth = 256;
+
+    /// columns of the right operand kept hot in cache per block
+    constexpr size_t kBlockCols = 512;
+
+    /// largest m * n * k the fixed size Multiply generates as straight-line code
+    constexpr size_t kUnrollVolume = 256;
+
+    /**
+     * Accessor over an array in which element (i, j) sits at data[i * rowStride + j * colStride],
+     * which covers both layouts of the runtime sized matrices
+     */
+    template<typename T>
+    struct Strided {
+        T *data;
+        size_t rowStride;
+        size_t colStride;
+
+        constexpr T &operator()(const size_t i, const size_t j) const noexcept {
+            return data[i * rowStride + j * colStride];
+        }
+    };
+
+    /**
+     * The accessor a shifted so that (0, 0) is its element (i0, j0). A Strided accessor stays one.
+     */
+    template<typename A>
+    [[nodiscard]] constexpr auto Offset(const A &a, const size_t i0, const size_t j0) {
+        return [&a, i0, j0](size_t i, size_t j) -> decltype(auto) { return a(i0 + i, j0 + j); };
+    }
+
+    template<typename T>
+    [[nodiscard]] constexpr Strided<T> Offset(const Strided<T> &a, const size_t i0, const size_t j0) {
+        return {&a(i0, j0), a.rowStride, a.colStride};
+    }
+
+    namespace Detail {
+        template<typename A>
+        inline constexpr bool kStridedFloat = std::is_same_v<A, Strided<float>> ||
+                                              std::is_same_v<A, Strided<const float>>;
+
+        /**
+         * Whether a float product over the accessors A, B and C can run on Simd::Gemm
+         */
+        template<typename T, typename A, typename B, typename C>
+        inline constexpr bool kDispatched = std::is_same_v<T, float> && kStridedFloat<A> && kStridedFloat<B> &&
+                                            std::is_same_v<std::remove_cvref_t<C>, Strided<float>>;
+
+        /**
+         * Writes one finished sum to the output. The first slice of the shared dimension overwrites,
+         * or with scaled computes alpha * sum + beta * out; later slices add (alpha *) sum. A beta of
+         * zero ignores out, so it may hold anything, NaN included, as in BLAS.
+         */
+        template<bool scaled, typename R, typename T>
+        constexpr void Store(R &out, const T sum, const T alpha, const T beta, const bool accumulate) {
+            if constexpr (scaled) {
+                if (accumulate) {
+                    out += alpha * sum;
+                } else if (beta == T()) {
+                    out = alpha * sum;
+                } else {
+                    out = alpha * sum + beta * out;
+                }
+            } else if (accumulate) {
+                out += sum;
+            } else {
+                out = sum;
+            }
+        }
+
+        /**
+         * Computes a rows x cols tile of the output starting at (i0, j0) over the shared dimension
+         * [p0, p1), holding the whole tile in registers. When accumulate is false the tile is
+         * overwritten instead of added to, see Store.
+         */
+        template<size_t rows, size_t cols, bool scaled, typename T, typename A, typename B, typename C>
+        constexpr void MicroKernel(size_t i0, size_t j0, size_t p0, size_t p1, const A &a, const B &b, C &c,
+                                   T alpha, T beta, bool accumulate) {
+            T acc[rows][cols] = {};
+            for (size_t p = p0; p < p1; ++p) {
+                T av[rows] = {};
+                for (size_t r = 0; r < rows; ++r) {
+                    av[r] = a(i0 + r, p);
+                }
+                for (size_t s = 0; s < cols; ++s) {
+                    const T bv = b(p, j0 + s);
+                    for (size_t r = 0; r < rows; ++r) {
+                        acc[r][s] += av[r] * bv;
+                    }
+                }
+            }
+            for (size_t r = 0; r < rows; ++r) {
+                for (size_t s = 0; s < cols; ++s) {
+                    Store<scaled>(c(i0 + r, j0 + s), acc[r][s], alpha, beta, accumulate);
+                }
+            }
+        }
+
+        /**
+         * Same as MicroKernel for the partial tiles on the right and bottom edges of the output
+         */
+        template<bool scaled, typename T, typename A, typename B, typename C>
+        constexpr void EdgeKernel(size_t i0, size_t j0, size_t rows, size_t cols, size_t p0, size_t p1,
+                                  const A &a, const B &b, C &c, T alpha, T beta, bool accumulate) {
+            T acc[kMicroRows][kMicroCols] = {};
+            for (size_t p = p0; p < p1; ++p) {
+                for (size_t s = 0; s < cols; ++s) {
+                    const T bv = b(p, j0 + s);
+                    for (size_t r = 0; r < rows; ++r) {
+                        acc[r][s] += static_cast<T>(a(i0 + r, p)) * bv;
+                    }
+                }
+            }
+            for (size_t r = 0; r < rows; ++r) {
+                for (size_t s = 0; s < cols; ++s) {
+                    Store<scaled>(c(i0 + r, j0 + s), acc[r][s], alpha, beta, accumulate);
+                }
+            }
+        }
+
+        /**
+         * The blocked loop nest behind Multiply and MultiplyAdd
+         */
+        template<bool scaled, typename T, typename A, typename B, typename C>
+        constexpr void Blocked(size_t m, size_t n, size_t k, const A &a, const B &b, C &c, const T alpha,
+                               const T beta) {
+            if (k == 0) {
+                for (size_t i = 0; i < m; ++i) {
+                    for (size_t j = 0; j < n; ++j) {
+                        Store<scaled>(c(i, j), T(), alpha, beta, false);
+                    }
+                }
+                return;
+            }
+            for (size_t jc = 0; jc < n; jc += kBlockCols) {
+                const size_t jEnd = jc + kBlockCols < n ? jc + kBlockCols : n;
+                for (size_t pc = 0; pc < k; pc += kBlockDepth) {
+                    const size_t pEnd = pc + kBlockDepth < k ? pc + kBlockDepth : k;
+                    const bool accumulate = pc != 0;
+                    for (size_t ic = 0; ic < m; ic += kBlockRows) {
+                        const size_t iEnd = ic + kBlockRows < m ? ic + kBlockRows : m;
+                        for (size_t j = jc; j < jEnd; j += kMicroCols) {
+                            const size_t cols = jEnd - j < kMicroCols ? jEnd - j : kMicroCols;
+                            for (size_t i = ic; i < iEnd; i += kMicroRows) {
+                                const size_t rows = iEnd - i < kMicroRows ? iEnd - i : kMicroRows;
+                                if (rows == kMicroRows && cols == kMicroCols) {
+                                    MicroKernel<kMicroRows, kMicroCols, scaled>(i, j, pc, pEnd, a, b, c, alpha, beta,
+                                                                                accumulate);
+                                } else {
+                                    EdgeKernel<scaled>(i, j, rows, cols, pc, pEnd, a, b, c, alpha, beta, accumulate);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * c = a * b where a is m x k, b is k x n and c is m x n.
+     * \tparam T type the products are summed in, which may be wider than the elements of a, b and c.
+     *           Sums are written to c once per kBlockDepth slice of the shared dimension.
+     * \param m rows of a and c
+     * \param n columns of b and c
+     * \param k columns of a and rows of b
+     * \param a left operand accessor
+     * \param b right operand accessor
+     * \param c output accessor, must not alias a or b
+     */
+    template<typename T, typename A, typename B, typename C>
+    constexpr void Multiply(size_t m, size_t n, size_t k, const A &a, const B &b, C &&c) {
+        if constexpr (Detail::kDispatched<T, A, B, C>) {
+            if (!std::is_constant_evaluated()) {
+                Simd::Gemm(m, n, k, 1.0f, a.data, a.rowStride, a.colStride, b.data, b.rowStride, b.colStride, 0.0f,
+                           c.data, c.rowStride, c.colStride);
+                return;
+            }
+        }
+        Detail::Blocked<false>(m, n, k, a, b, c, T(1), T());
+    }
+
+    /**
+     * Multiply for sizes known at compile time. Products of at most kUnrollVolume multiply adds, 4x4
+     * by 4x4 among them, are fully unrolled with no loop or edge branches left; larger ones take the
+     * blocked path. Every sum is added up in the same order either way, so both give equal results.
+     */
+    template<typename T, size_t m, size_t n, size_t k, typename A, typename B, typename C>
+    constexpr void Multiply(const A &a, const B &b, C &&c) {
+        if constexpr (m * n * k <= kUnrollVolume) {
+            LinAlg::Detail::Unroll<0, m>([&](const size_t i) {
+                LinAlg::Detail::Unroll<0, n>([&](const size_t j) {
+                    T sum = T();
+                    LinAlg::Detail::Unroll<0, k>([&](const size_t p) {
+                        sum += static_cast<T>(a(i, p)) * static_cast<T>(b(p, j));
+                    });
+                    c(i, j) = sum;
+                });
+            });
+        } else {
+            Multiply<T>(m, n, k, a, b, c);
+        }
+    }
+
+    /**
+     * c = alpha * a * b + beta * c in the same single pass over c as Multiply. A beta of zero does
+     * not read c.
+     */
+    template<typename T, typename A, typename B, typename C>
+    constexpr void MultiplyAdd(size_t m, size_t n, size_t k, const T alpha, const A &a, const B &b, const T beta,
+                               C &&c) {
+        if constexpr (Detail::kDispatched<T, A, B, C>) {
+            if (!std::is_constant_evaluated()) {
+                Simd::Gemm(m, n, k, alpha, a.data, a.rowStride, a.colStride, b.data, b.rowStride, b.colStride, beta,
+                           c.data, c.rowStride, c.colStride);
+                return;
+            }
+        }
+        Detail::Blocked<true>(m, n, k, a, b, c, alpha, beta);
+    }
+
+#ifdef QS_LINALG_SSE
+    /**
+     * out = a * b for column major 4x4 float matrices. out must not alias a or b.
+     */
+    inline void Multiply4x4(const float *a, const float *b, float *out) noexcept {
+        const __m128 c0 = _mm_loadu_ps(a);
+        const __m128 c1 = _mm_loadu_ps(a + 4);
+        const __m128 c2 = _mm_loadu_ps(a + 8);
+        const __m128 c3 = _mm_loadu_ps(a + 12);
+        for (int j = 0; j < 4; ++j) {
+            const float *bj = b + 4 * j;
+            __m128 r = _mm_mul_ps(c0, _mm_set1_ps(bj[0]));
+            r = _mm_add_ps(r, _mm_mul_ps(c1, _mm_set1_ps(bj[1])));
+            r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_set1_ps(bj[2])));
+            r = _mm_add_ps(r, _mm_mul_ps(c3, _mm_set1_ps(bj[3])));
+            _mm_storeu_ps(out + 4 * j, r);
+        }
+    }
+
+    /**
+     * out = a * v for a column major 4x4 float matrix. out must not alias v.
+     */
+    inline void Transform4(const float *a, const float *v, float *out) noexcept {
+        __m128 r = _mm_mul_ps(_mm_loadu_ps(a), _mm_set1_ps(v[0]));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(a + 4), _mm_set1_ps(v[1])));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(a + 8), _mm_set1_ps(v[2])));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(a + 12), _mm_set1_ps(v[3])));
+        _mm_storeu_ps(out, r);
+    }
+#endif
+}
+
+#endif //DRAWING_GEMM_H
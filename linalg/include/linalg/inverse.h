@@ -0,0 +1,226 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_INVERSE_H
+#define DRAWING_INVERSE_H
+
+#include <stdexcept>
+#include <type_traits>
+
+#include "cmatrix.h"
+#include "simd.h"
+
+/**
+ * Closed-form inverses of 4x4 transforms. These skip the pivoting and branching of LU and are the
+ * ones to use for per-frame view and model matrices.
+ */
+namespace QS::LinAlg {
+
+#ifdef QS_LINALG_SSE
+    namespace Detail {
+        /// _mm_shuffle_ps selecting lanes x, y, z, w in order
+        template<int x, int y, int z, int w>
+        inline __m128 Shuffle(__m128 a, __m128 b) noexcept {
+            return _mm_shuffle_ps(a, b, _MM_SHUFFLE(w, z, y, x));
+        }
+
+        template<int x, int y, int z, int w>
+        inline __m128 Swizzle(__m128 a) noexcept {
+            return Shuffle<x, y, z, w>(a, a);
+        }
+
+        /// a * b for 2x2 matrices packed as (m00, m01, m10, m11)
+        inline __m128 Mat2Mul(__m128 a, __m128 b) noexcept {
+            return _mm_add_ps(_mm_mul_ps(a, Swizzle<0, 3, 0, 3>(b)),
+                              _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+        }
+
+        /// adj(a) * b
+        inline __m128 Mat2AdjMul(__m128 a, __m128 b) noexcept {
+            return _mm_sub_ps(_mm_mul_ps(Swizzle<3, 3, 0, 0>(a), b),
+                              _mm_mul_ps(Swizzle<1, 1, 2, 2>(a), Swizzle<2, 3, 0, 1>(b)));
+        }
+
+        /// a * adj(b)
+        inline __m128 Mat2MulAdj(__m128 a, __m128 b) noexcept {
+            return _mm_sub_ps(_mm_mul_ps(a, Swizzle<3, 0, 3, 0>(b)),
+                              _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+        }
+
+        /**
+         * Inverse of a 4x4 float matrix by 2x2 block cofactors. Works on either storage order since
+         * inverting the transpose yields the transposed inverse.
+         * \returns false if the matrix is singular, leaving out untouched
+         */
+        inline bool Inverse4x4(const float *in, float *out) noexcept {
+            const __m128 r0 = _mm_loadu_ps(in);
+            const __m128 r1 = _mm_loadu_ps(in + 4);
+            const __m128 r2 = _mm_loadu_ps(in + 8);
+            const __m128 r3 = _mm_loadu_ps(in + 12);
+
+            // 2x2 blocks | A B |
+            //            | C D |
+            const __m128 a = _mm_movelh_ps(r0, r1);
+            const __m128 b = _mm_movehl_ps(r1, r0);
+            const __m128 c = _mm_movelh_ps(r2, r3);
+            const __m128 d = _mm_movehl_ps(r3, r2);
+
+            // (|A|, |B|, |C|, |D|)
+            const __m128 detSub = _mm_sub_ps(
+                    _mm_mul_ps(Shuffle<0, 2, 0, 2>(r0, r2), Shuffle<1, 3, 1, 3>(r1, r3)),
+                    _mm_mul_ps(Shuffle<1, 3, 1, 3>(r0, r2), Shuffle<0, 2, 0, 2>(r1, r3)));
+            const __m128 detA = Swizzle<0, 0, 0, 0>(detSub);
+            const __m128 detB = Swizzle<1, 1, 1, 1>(detSub);
+            const __m128 detC = Swizzle<2, 2, 2, 2>(detSub);
+            const __m128 detD = Swizzle<3, 3, 3, 3>(detSub);
+
+            const __m128 dc = Mat2AdjMul(d, c);
+            const __m128 ab = Mat2AdjMul(a, b);
+            __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), Mat2Mul(b, dc));
+            __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), Mat2Mul(c, ab));
+            __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), Mat2MulAdj(d, ab));
+            __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), Mat2MulAdj(a, dc));
+
+            // |M| = |A| |D| + |B| |C| - tr(adj(A) B adj(D) C)
+            __m128 trace = _mm_mul_ps(ab, Swizzle<0, 2, 1, 3>(dc));
+            trace = _mm_add_ps(trace, Swizzle<1, 0, 3, 2>(trace));
+            trace = _mm_add_ps(trace, Swizzle<2, 3, 0, 1>(trace));
+            const __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+            if (_mm_cvtss_f32(det) == 0.0f) {
+                return false;
+            }
+
+            const __m128 scale = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+            x = _mm_mul_ps(x, scale);
+            y = _mm_mul_ps(y, scale);
+            z = _mm_mul_ps(z, scale);
+            w = _mm_mul_ps(w, scale);
+
+            // the adjugate shuffle and the block layout combined
+            _mm_storeu_ps(out, Shuffle<3, 1, 3, 1>(x, y));
+            _mm_storeu_ps(out + 4, Shuffle<2, 0, 2, 0>(x, y));
+            _mm_storeu_ps(out + 8, Shuffle<3, 1, 3, 1>(z, w));
+            _mm_storeu_ps(out + 12, Shuffle<2, 0, 2, 0>(z, w));
+            return true;
+        }
+    }
+#endif
+
+    /**
+     * Inverse of a general 4x4 matrix by cofactor expansion. Vectorized outside of constant
+     * evaluation for float matrices. Throws std::invalid_argument when m is singular.
+     */
+    template<typename T, size_t alignment>
+    constexpr CMatrix<4, 4, T, alignment> Inverse4x4(const CMatrix<4, 4, T, alignment> &m) {
+        CMatrix<4, 4, T, alignment> out;
+#ifdef QS_LINALG_SSE
+        if constexpr (std::is_same_v<T, float>) {
+            if (!std::is_constant_evaluated()) {
+                if (!Detail::Inverse4x4(m.GetData(), out.GetData())) {
+                    throw std::invalid_argument("matrix is singular");
+                }
+                return out;
+            }
+        }
+#endif
+        // inverting the transpose transposes the inverse, so the storage order does not matter here
+        const T s0 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+        const T s1 = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+        const T s2 = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+        const T s3 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+        const T s4 = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+        const T s5 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+
+        const T c5 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+        const T c4 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+        const T c3 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+        const T c2 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+        const T c1 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+        const T c0 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+
+        const T det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        if (det == T()) {
+            throw std::invalid_argument("matrix is singular");
+        }
+        const T inv = 1 / det;
+
+        out[0][0] = (m[1][1] * c5 - m[1][2] * c4 + m[1][3] * c3) * inv;
+        out[0][1] = (-m[0][1] * c5 + m[0][2] * c4 - m[0][3] * c3) * inv;
+        out[0][2] = (m[3][1] * s5 - m[3][2] * s4 + m[3][3] * s3) * inv;
+        out[0][3] = (-m[2][1] * s5 + m[2][2] * s4 - m[2][3] * s3) * inv;
+
+        out[1][0] = (-m[1][0] * c5 + m[1][2] * c2 - m[1][3] * c1) * inv;
+        out[1][1] = (m[0][0] * c5 - m[0][2] * c2 + m[0][3] * c1) * inv;
+        out[1][2] = (-m[3][0] * s5 + m[3][2] * s2 - m[3][3] * s1) * inv;
+        out[1][3] = (m[2][0] * s5 - m[2][2] * s2 + m[2][3] * s1) * inv;
+
+        out[2][0] = (m[1][0] * c4 - m[1][1] * c2 + m[1][3] * c0) * inv;
+        out[2][1] = (-m[0][0] * c4 + m[0][1] * c2 - m[0][3] * c0) * inv;
+        out[2][2] = (m[3][0] * s4 - m[3][1] * s2 + m[3][3] * s0) * inv;
+        out[2][3] = (-m[2][0] * s4 + m[2][1] * s2 - m[2][3] * s0) * inv;
+
+        out[3][0] = (-m[1][0] * c3 + m[1][1] * c1 - m[1][2] * c0) * inv;
+        out[3][1] = (m[0][0] * c3 - m[0][1] * c1 + m[0][2] * c0) * inv;
+        out[3][2] = (-m[3][0] * s3 + m[3][1] * s1 - m[3][2] * s0) * inv;
+        out[3][3] = (m[2][0] * s3 - m[2][1] * s1 + m[2][2] * s0) * inv;
+        return out;
+    }
+
+    /**
+     * Inverse of an affine transform, a linear part (rotation, scale, shear) followed by a
+     * translation, with a bottom row of (0, 0, 0, 1). The linear part is inverted through its
+     * adjugate. Throws std::invalid_argument when the linear part is singular.
+     */
+    template<typename T, size_t alignment>
+    constexpr CMatrix<4, 4, T, alignment> AffineInverse(const CMatrix<4, 4, T, alignment> &m) {
+        // rows of the inverse linear part are the cross products of its columns
+        const CVector<4, T> &x = m[0];
+        const CVector<4, T> &y = m[1];
+        const CVector<4, T> &z = m[2];
+        const T r0[3] = { y[1] * z[2] - y[2] * z[1], y[2] * z[0] - y[0] * z[2], y[0] * z[1] - y[1] * z[0] };
+        const T r1[3] = { z[1] * x[2] - z[2] * x[1], z[2] * x[0] - z[0] * x[2], z[0] * x[1] - z[1] * x[0] };
+        const T r2[3] = { x[1] * y[2] - x[2] * y[1], x[2] * y[0] - x[0] * y[2], x[0] * y[1] - x[1] * y[0] };
+
+        const T det = x[0] * r0[0] + x[1] * r0[1] + x[2] * r0[2];
+        if (det == T()) {
+            throw std::invalid_argument("matrix is singular");
+        }
+        const T inv = 1 / det;
+
+        CMatrix<4, 4, T, alignment> out;
+        for (size_t c = 0; c < 3; ++c) {
+            out[c][0] = r0[c] * inv;
+            out[c][1] = r1[c] * inv;
+            out[c][2] = r2[c] * inv;
+        }
+        const CVector<4, T> &t = m[3];
+        for (size_t r = 0; r < 3; ++r) {
+            out[3][r] = -(out[0][r] * t[0] + out[1][r] * t[1] + out[2][r] * t[2]);
+        }
+        out[3][3] = T(1);
+        return out;
+    }
+
+    /**
+     * Inverse of a rigid transform, a rotation followed by a translation: the rotation is
+     * transposed and the translation rotated back and negated. m must not contain scale.
+     */
+    template<typename T, size_t alignment>
+    constexpr CMatrix<4, 4, T, alignment> RigidInverse(const CMatrix<4, 4, T, alignment> &m) noexcept {
+        CMatrix<4, 4, T, alignment> out;
+        for (size_t c = 0; c < 3; ++c) {
+            for (size_t r = 0; r < 3; ++r) {
+                out[c][r] = m[r][c];
+            }
+        }
+        const CVector<4, T> &t = m[3];
+        for (size_t r = 0; r < 3; ++r) {
+            out[3][r] = -(m[r][0] * t[0] + m[r][1] * t[1] + m[r][2] * t[2]);
+        }
+        out[3][3] = T(1);
+        return out;
+    }
+}
+
+#endif //DRAWING_INVERSE_H
@@ -0,0 +1,463 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_ITERATIVE_H
+#define DRAWING_ITERATIVE_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include "dmatrix.h"
+#include "dvector.h"
+#include "parallel.h"
+#include "sparse.h"
+
+/**
+ * Krylov solvers for large linear systems A x = b. A is any matrix with GetRows(), GetCols() and a
+ * Multiply(const T *x, T *y) computing y = A x, which covers DMatrix and SparseMatrix; each
+ * iteration costs one or two such products plus a few vector updates on the thread pool.
+ *
+ * Preconditioners provide Apply(const T *r, T *z, n) computing z = M^-1 r for an approximation M of
+ * A that is cheap to invert.
+ */
+namespace QS::LinAlg {
+
+    /**
+     * Stopping criteria and instrumentation shared by the solvers
+     */
+    struct SolverOptions {
+        /// stop once ||b - A x|| <= tolerance * ||b||
+        double tolerance = 1e-6;
+
+        /// stop after this many iterations even when the tolerance is not met
+        size_t maxIterations = 1000;
+
+        /// called after every iteration with the iteration number and the relative residual
+        std::function<void(size_t iteration, double residual)> monitor;
+    };
+
+    struct SolverResult {
+        /// whether the tolerance was met
+        bool converged = false;
+
+        /// iterations carried out
+        size_t iterations = 0;
+
+        /// final relative residual ||b - A x|| / ||b||
+        double residual = 0.0;
+
+        /// relative residual before the first iteration and after every iteration
+        std::vector<double> residuals;
+    };
+
+    /**
+     * M = I, solving without preconditioning
+     */
+    struct IdentityPreconditioner {
+        template<typename T>
+        void Apply(const T *r, T *z, const size_t n) const {
+            std::copy(r, r + n, z);
+        }
+    };
+
+    /**
+     * M = diag(A). Cheap to build and apply, and effective when the diagonal dominates or the rows
+     * are badly scaled against each other.
+     */
+    template<typename T = float>
+    class JacobiPreconditioner {
+    public:
+        /**
+         * throws std::invalid_argument when a is not square or has a zero on its diagonal
+         */
+        template<Layout layout>
+        explicit JacobiPreconditioner(const SparseMatrix<T, layout> &a) : mInverseDiagonal(a.GetRows()) {
+            CheckSquare(a.GetRows(), a.GetCols());
+            for (size_t i = 0; i < a.GetRows(); ++i) {
+                SetDiagonal(i, a(i, i));
+            }
+        }
+
+        template<Layout layout>
+        explicit JacobiPreconditioner(const DMatrix<T, layout> &a) : mInverseDiagonal(a.GetRows()) {
+            CheckSquare(a.GetRows(), a.GetCols());
+            for (size_t i = 0; i < a.GetRows(); ++i) {
+                SetDiagonal(i, a(i, i));
+            }
+        }
+
+        void Apply(const T *r, T *z, const size_t n) const {
+            Simd::Mul(r, mInverseDiagonal.GetData(), z, n);
+        }
+
+    private:
+        static void CheckSquare(const size_t rows, const size_t cols) {
+            if (rows != cols) {
+                throw std::invalid_argument("preconditioner requires a square matrix");
+            }
+        }
+
+        void SetDiagonal(const size_t i, const T value) {
+            if (value == T()) {
+                throw std::invalid_argument("matrix has a zero on its diagonal");
+            }
+            mInverseDiagonal[i] = T(1) / value;
+        }
+
+        DVector<T> mInverseDiagonal;
+    };
+
+    /**
+     * Zero fill incomplete Cholesky factorization, IC(0): M = L L^T where L is restricted to the
+     * nonzero pattern of the lower triangle of A. For symmetric positive definite A only, and
+     * usually cuts the Conjugate Gradient iteration count several times over Jacobi.
+     *
+     * Applying M^-1 is a forward and a backward substitution, which run serially.
+     */
+    template<typename T = float>
+    class IncompleteCholesky {
+    public:
+        /**
+         * Only the lower triangle of a is read. Throws std::invalid_argument when a is not square or
+         * the factorization meets a non positive pivot, which happens when a is not positive
+         * definite and can happen for some that are.
+         */
+        template<Layout layout>
+        explicit IncompleteCholesky(const SparseMatrix<T, layout> &a) {
+            if (a.GetRows() != a.GetCols()) {
+                throw std::invalid_argument("preconditioner requires a square matrix");
+            }
+            if constexpr (layout == Layout::RowMajor) {
+                Factor(a);
+            } else {
+                Factor(a.template ToLayout<Layout::RowMajor>());
+            }
+        }
+
+        /**
+         * L in compressed rows, the diagonal the last entry of every row
+         */
+        [[nodiscard]] const CsrMatrix<T> &GetLower() const noexcept { return mLower; }
+
+        void Apply(const T *r, T *z, const size_t n) const {
+            const size_t *offsets = mLower.GetOffsets();
+            const uint32_t *indices = mLower.GetIndices();
+            const T *values = mLower.GetValues();
+            // L y = r, row by row
+            for (size_t i = 0; i < n; ++i) {
+                T sum = r[i];
+                const size_t diagonal = offsets[i + 1] - 1;
+                for (size_t k = offsets[i]; k < diagonal; ++k) {
+                    sum -= values[k] * z[indices[k]];
+                }
+                z[i] = sum / values[diagonal];
+            }
+            // L^T z = y, reading the rows of L as the columns of L^T
+            for (size_t i = n; i-- > 0;) {
+                const size_t diagonal = offsets[i + 1] - 1;
+                z[i] /= values[diagonal];
+                for (size_t k = offsets[i]; k < diagonal; ++k) {
+                    z[indices[k]] -= values[k] * z[i];
+                }
+            }
+        }
+
+    private:
+        void Factor(const CsrMatrix<T> &a) {
+            const size_t n = a.GetRows();
+            std::vector<size_t> offsets(n + 1, 0);
+            std::vector<uint32_t> indices;
+            std::vector<T> values;
+            indices.reserve(a.GetNonZeroCount() / 2 + n);
+            values.reserve(a.GetNonZeroCount() / 2 + n);
+
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t k = a.GetOffsets()[i]; k < a.GetOffsets()[i + 1] && a.GetIndices()[k] <= i; ++k) {
+                    indices.push_back(a.GetIndices()[k]);
+                    values.push_back(a.GetValues()[k]);
+                }
+                if (indices.size() == offsets[i] || indices.back() != i) {
+                    throw std::invalid_argument("matrix has a zero on its diagonal");
+                }
+                offsets[i + 1] = indices.size();
+
+                const size_t diagonal = offsets[i + 1] - 1;
+                for (size_t k = offsets[i]; k < diagonal; ++k) {
+                    const size_t j = indices[k];
+                    values[k] = (values[k] - RowProduct(offsets, indices, values, offsets[i], k, j)) /
+                                values[offsets[j + 1] - 1];
+                }
+                T pivot = values[diagonal];
+                for (size_t k = offsets[i]; k < diagonal; ++k) {
+                    pivot -= values[k] * values[k];
+                }
+                if (!(pivot > T())) {
+                    throw std::invalid_argument("matrix is not positive definite");
+                }
+                values[diagonal] = std::sqrt(pivot);
+            }
+            mLower = CsrMatrix<T>::FromArrays(n, n, std::move(offsets), std::move(indices), std::move(values));
+        }
+
+        /**
+         * sum of L(i, m) * L(j, m) over the pattern shared by row i, entries [begin, end), and the
+         * strictly lower part of row j
+         */
+        static T RowProduct(const std::vector<size_t> &offsets, const std::vector<uint32_t> &indices,
+                            const std::vector<T> &values, size_t begin, const size_t end, const size_t j) {
+            T out = T();
+            size_t k = offsets[j];
+            const size_t jEnd = offsets[j + 1] - 1;
+            while (begin < end && k < jEnd) {
+                if (indices[begin] < indices[k]) {
+                    ++begin;
+                } else if (indices[k] < indices[begin]) {
+                    ++k;
+                } else {
+                    out += values[begin++] * values[k++];
+                }
+            }
+            return out;
+        }
+
+        CsrMatrix<T> mLower;
+    };
+
+    namespace Detail {
+        template<typename T>
+        [[nodiscard]] T Norm(const DVector<T> &v) {
+            return std::sqrt(Parallel::Dot(v.GetData(), v.GetData(), v.GetSize()));
+        }
+
+        /**
+         * throws std::invalid_argument unless a is square and b and x match it
+         */
+        template<class M, typename T>
+        void CheckSystem(const M &a, const DVector<T> &b, const DVector<T> &x) {
+            if (a.GetRows() != a.GetCols()) {
+                throw std::invalid_argument("iterative solvers require a square matrix");
+            }
+            if (b.GetSize() != a.GetRows() || x.GetSize() != a.GetRows()) {
+                throw std::invalid_argument("vector length != matrix size");
+            }
+        }
+
+        /**
+         * r = b - A x
+         */
+        template<class M, typename T>
+        void Residual(const M &a, const DVector<T> &b, const DVector<T> &x, DVector<T> &r) {
+            a.Multiply(x.GetData(), r.GetData());
+            Parallel::Sub(b.GetData(), r.GetData(), r.GetData(), r.GetSize());
+        }
+
+        /**
+         * The residual the solvers update each iteration drifts from b - A x in finite precision.
+         * Once it meets the tolerance, r is recomputed from x, and the true relative residual
+         * returned, so that convergence is only claimed for x itself.
+         */
+        template<class M, typename T>
+        [[nodiscard]] double Confirm(const M &a, const DVector<T> &b, const DVector<T> &x, DVector<T> &r,
+                                     const double bNorm, const SolverOptions &options, const double residual) {
+            if (residual > options.tolerance) {
+                return residual;
+            }
+            Residual(a, b, x, r);
+            return Norm(r) / bNorm;
+        }
+
+        /**
+         * Records the residual of an iteration; true when it meets the tolerance
+         */
+        inline bool Report(SolverResult &result, const SolverOptions &options, const size_t iteration,
+                           const double residual) {
+            result.iterations = iteration;
+            result.residual = residual;
+            result.residuals.push_back(residual);
+            if (iteration > 0 && options.monitor) {
+                options.monitor(iteration, residual);
+            }
+            result.converged = residual <= options.tolerance;
+            return result.converged;
+        }
+    }
+
+    /**
+     * Preconditioned Conjugate Gradient for symmetric positive definite A.
+     *
+     * \param x the initial guess on entry, the solution on return
+     * \return the iteration count and residuals; when the tolerance was not met x holds the last
+     * iterate
+     */
+    template<class M, class P>
+    SolverResult ConjugateGradient(const M &a, const DVector<typename M::value_type> &b,
+                                   DVector<typename M::value_type> &x, const P &preconditioner,
+                                   const SolverOptions &options = {}) {
+        using T = typename M::value_type;
+        Detail::CheckSystem(a, b, x);
+        const size_t n = b.GetSize();
+        SolverResult result;
+        const double bNorm = Detail::Norm(b);
+        if (bNorm == 0.0) {
+            std::fill(x.GetData(), x.GetData() + n, T());
+            Detail::Report(result, options, 0, 0.0);
+            return result;
+        }
+
+        DVector<T> r(n), z(n), p(n), ap(n);
+        Detail::Residual(a, b, x, r);
+        if (Detail::Report(result, options, 0, Detail::Norm(r) / bNorm)) {
+            return result;
+        }
+        preconditioner.Apply(r.GetData(), z.GetData(), n);
+        std::copy(z.GetData(), z.GetData() + n, p.GetData());
+        T rz = Parallel::Dot(r.GetData(), z.GetData(), n);
+
+        for (size_t iteration = 1; iteration <= options.maxIterations; ++iteration) {
+            a.Multiply(p.GetData(), ap.GetData());
+            const T pap = Parallel::Dot(p.GetData(), ap.GetData(), n);
+            if (pap == T()) {
+                break;
+            }
+            const T alpha = rz / pap;
+            Parallel::Axpy(alpha, p.GetData(), x.GetData(), n);
+            Parallel::Axpy(-alpha, ap.GetData(), r.GetData(), n);
+            const double updated = Detail::Norm(r) / bNorm;
+            const double residual = Detail::Confirm(a, b, x, r, bNorm, options, updated);
+            if (Detail::Report(result, options, iteration, residual)) {
+                break;
+            }
+
+            preconditioner.Apply(r.GetData(), z.GetData(), n);
+            const T rzNext = Parallel::Dot(r.GetData(), z.GetData(), n);
+            // p = z + beta p, restarting along z when r was recomputed
+            const T beta = residual == updated ? rzNext / rz : T();
+            Parallel::Scale(p.GetData(), beta, p.GetData(), n);
+            Parallel::Add(p.GetData(), z.GetData(), p.GetData(), n);
+            rz = rzNext;
+        }
+        return result;
+    }
+
+    template<class M>
+    SolverResult ConjugateGradient(const M &a, const DVector<typename M::value_type> &b,
+                                   DVector<typename M::value_type> &x, const SolverOptions &options = {}) {
+        return ConjugateGradient(a, b, x, IdentityPreconditioner{}, options);
+    }
+
+    /**
+     * Right preconditioned BiCGSTAB for general nonsymmetric A.
+     *
+     * Stops early without converging if the method breaks down, which is rare but possible for
+     * indefinite matrices.
+     *
+     * \param x the initial guess on entry, the solution on return
+     * \return the iteration count and residuals; when the tolerance was not met x holds the last
+     * iterate
+     */
+    template<class M, class P>
+    SolverResult BiCgStab(const M &a, const DVector<typename M::value_type> &b, DVector<typename M::value_type> &x,
+                          const P &preconditioner, const SolverOptions &options = {}) {
+        using T = typename M::value_type;
+        Detail::CheckSystem(a, b, x);
+        const size_t n = b.GetSize();
+        SolverResult result;
+        const double bNorm = Detail::Norm(b);
+        if (bNorm == 0.0) {
+            std::fill(x.GetData(), x.GetData() + n, T());
+            Detail::Report(result, options, 0, 0.0);
+            return result;
+        }
+
+        DVector<T> r(n), shadow(n), p(n), v(n), pHat(n), sHat(n), t(n);
+        Detail::Residual(a, b, x, r);
+        if (Detail::Report(result, options, 0, Detail::Norm(r) / bNorm)) {
+            return result;
+        }
+        T rho, alpha, omega;
+        bool restarted;
+        // begins the iteration afresh from the current r
+        const auto Restart = [&]() {
+            std::copy(r.GetData(), r.GetData() + n, shadow.GetData());
+            std::fill(p.GetData(), p.GetData() + n, T());
+            std::fill(v.GetData(), v.GetData() + n, T());
+            rho = alpha = omega = T(1);
+            restarted = true;
+        };
+        Restart();
+
+        for (size_t iteration = 1; iteration <= options.maxIterations; ++iteration) {
+            // a zero rho or shadow . v is a breakdown of the recurrence, often caused by rounding alone.
+            // Starting over from the current r gets past it unless it recurs right after a restart.
+            // x and r are unchanged by such an iteration, but it still counts and reports.
+            const T rhoNext = Parallel::Dot(shadow.GetData(), r.GetData(), n);
+            if (rhoNext == T()) {
+                if (restarted || Detail::Report(result, options, iteration, Detail::Norm(r) / bNorm)) {
+                    break;
+                }
+                Restart();
+                continue;
+            }
+            // p = r + beta (p - omega v)
+            const T beta = (rhoNext / rho) * (alpha / omega);
+            Parallel::Axpy(-omega, v.GetData(), p.GetData(), n);
+            Parallel::Scale(p.GetData(), beta, p.GetData(), n);
+            Parallel::Add(p.GetData(), r.GetData(), p.GetData(), n);
+            rho = rhoNext;
+
+            preconditioner.Apply(p.GetData(), pHat.GetData(), n);
+            a.Multiply(pHat.GetData(), v.GetData());
+            const T shadowV = Parallel::Dot(shadow.GetData(), v.GetData(), n);
+            if (shadowV == T()) {
+                if (restarted || Detail::Report(result, options, iteration, Detail::Norm(r) / bNorm)) {
+                    break;
+                }
+                Restart();
+                continue;
+            }
+            alpha = rho / shadowV;
+            Parallel::Axpy(alpha, pHat.GetData(), x.GetData(), n);
+            // r becomes s = r - alpha v
+            Parallel::Axpy(-alpha, v.GetData(), r.GetData(), n);
+            const double sNorm = Detail::Norm(r) / bNorm;
+            if (sNorm <= options.tolerance) {
+                if (Detail::Report(result, options, iteration, Detail::Confirm(a, b, x, r, bNorm, options, sNorm))) {
+                    break;
+                }
+                Restart();
+                continue;
+            }
+
+            preconditioner.Apply(r.GetData(), sHat.GetData(), n);
+            a.Multiply(sHat.GetData(), t.GetData());
+            const T tt = Parallel::Dot(t.GetData(), t.GetData(), n);
+            omega = tt == T() ? T() : Parallel::Dot(t.GetData(), r.GetData(), n) / tt;
+            Parallel::Axpy(omega, sHat.GetData(), x.GetData(), n);
+            Parallel::Axpy(-omega, t.GetData(), r.GetData(), n);
+            const double updated = Detail::Norm(r) / bNorm;
+            const double residual = Detail::Confirm(a, b, x, r, bNorm, options, updated);
+            if (Detail::Report(result, options, iteration, residual) || omega == T()) {
+                break;
+            }
+            restarted = false;
+            if (residual != updated) {
+                Restart();
+            }
+        }
+        return result;
+    }
+
+    template<class M>
+    SolverResult BiCgStab(const M &a, const DVector<typename M::value_type> &b, DVector<typename M::value_type> &x,
+                          const SolverOptions &options = {}) {
+        return BiCgStab(a, b, x, IdentityPreconditioner{}, options);
+    }
+}
+
+#endif //DRAWING_ITERATIVE_H
@@ -0,0 +1,403 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_LU_H
+#define DRAWING_LU_H
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "cmatrix.h"
+#include "dmatrix.h"
+#include "dvector.h"
+#include "expression.h"
+#include "parallel.h"
+#include "rmatrix.h"
+
+namespace QS::LinAlg {
+
+    namespace Detail {
+        /**
+         * element (r, c) of a square fixed size matrix in either storage order
+         */
+        template<class M>
+        constexpr auto &Element(M &m, const size_t r, const size_t c) noexcept {
+            if constexpr (Expr::ColumnMajorExpression<std::remove_const_t<M>>) {
+                return m[c][r];
+            } else {
+                return m[r][c];
+            }
+        }
+
+        template<typename T>
+        constexpr T Abs(const T value) noexcept {
+            return value < T() ? -value : value;
+        }
+    }
+
+    /**
+     * LU decomposition with partial pivoting, P * A = L * U, of a square RMatrix or CMatrix.
+     *
+     * The elimination is carried out with the matrix row operations SwapRows and MultiplyAddRows
+     * and is usable in constant expressions. A zero pivot marks the matrix singular: Determinant()
+     * returns 0 and Inverse() and Solve() throw std::invalid_argument.
+     */
+    template<class M>
+    class LU {
+    public:
+        static constexpr int n = Expr::ShapeOf<M>::rows;
+
+        static_assert(n == Expr::ShapeOf<M>::cols, "LU decomposition requires a square matrix");
+
+        using value_type = typename M::value_type;
+
+        constexpr explicit LU(const M &a) : mUpper{a} {
+            for (size_t i = 0; i < n; ++i) {
+                mPermutation[i] = i;
+            }
+            for (size_t k = 0; k < n; ++k) {
+                size_t pivot = k;
+                for (size_t i = k + 1; i < n; ++i) {
+                    if (Detail::Abs(Detail::Element(mUpper, i, k)) > Detail::Abs(Detail::Element(mUpper, pivot, k))) {
+                        pivot = i;
+                    }
+                }
+                if (pivot != k) {
+                    mUpper.SwapRows(k, pivot);
+                    mLower.SwapRows(k, pivot);
+                    std::swap(mPermutation[k], mPermutation[pivot]);
+                    mSign = -mSign;
+                }
+                const value_type diagonal = Detail::Element(mUpper, k, k);
+                if (diagonal == value_type()) {
+                    mSingular = true;
+                    continue;
+                }
+                for (size_t i = k + 1; i < n; ++i) {
+                    const value_type factor = Detail::Element(mUpper, i, k) / diagonal;
+                    if (factor != value_type()) {
+                        mUpper.MultiplyAddRows(-factor, k, i);
+                    }
+                    Detail::Element(mLower, i, k) = factor;
+                }
+            }
+            for (size_t i = 0; i < n; ++i) {
+                Detail::Element(mLower, i, i) = value_type(1);
+            }
+        }
+
+        [[nodiscard]] constexpr bool IsSingular() const noexcept { return mSingular; }
+
+        /**
+         * unit lower triangular factor
+         */
+        [[nodiscard]] constexpr const M &GetLower() const noexcept { return mLower; }
+
+        /**
+         * upper triangular factor
+         */
+        [[nodiscard]] constexpr const M &GetUpper() const noexcept { return mUpper; }
+
+        /**
+         * row i of P * A is row GetPermutation()[i] of A
+         */
+        [[nodiscard]] constexpr const std::array<size_t, n> &GetPermutation() const noexcept {
+            return mPermutation;
+        }
+
+        [[nodiscard]] constexpr value_type Determinant() const noexcept {
+            value_type out = mSign;
+            for (size_t i = 0; i < n; ++i) {
+                out *= Detail::Element(mUpper, i, i);
+            }
+            return out;
+        }
+
+        /**
+         * x such that A * x = b
+         * \tparam V RVector<n> or CVector<n>
+         */
+        template<class V>
+        [[nodiscard]] constexpr V Solve(const V &b) const {
+            static_assert(Expr::ShapeOf<V>::length == n, "rhs vector length != matrix size");
+            std::array<value_type, n> x{};
+            for (size_t i = 0; i < n; ++i) {
+                x[i] = b[mPermutation[i]];
+            }
+            Substitute(x);
+            V out;
+            for (size_t i = 0; i < n; ++i) {
+                out[i] = x[i];
+            }
+            return out;
+        }
+
+        [[nodiscard]] constexpr M Inverse() const {
+            M out;
+            for (size_t j = 0; j < n; ++j) {
+                std::array<value_type, n> x{};
+                for (size_t i = 0; i < n; ++i) {
+                    x[i] = mPermutation[i] == j ? value_type(1) : value_type();
+                }
+                Substitute(x);
+                for (size_t i = 0; i < n; ++i) {
+                    Detail::Element(out, i, j) = x[i];
+                }
+            }
+            return out;
+        }
+
+    private:
+        /**
+         * solves L * U * x = x in place
+         */
+        constexpr void Substitute(std::array<value_type, n> &x) const {
+            if (mSingular) {
+                throw std::invalid_argument("matrix is singular");
+            }
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < i; ++j) {
+                    x[i] -= Detail::Element(mLower, i, j) * x[j];
+                }
+            }
+            for (size_t i = n; i-- > 0;) {
+                for (size_t j = i + 1; j < n; ++j) {
+                    x[i] -= Detail::Element(mUpper, i, j) * x[j];
+                }
+                x[i] /= Detail::Element(mUpper, i, i);
+            }
+        }
+
+        /// L, filled below the diagonal as the elimination proceeds
+        M mLower;
+
+        /// U, the eliminated matrix
+        M mUpper;
+
+        /// row permutation P
+        std::array<size_t, n> mPermutation{};
+
+        /// determinant of P
+        value_type mSign = value_type(1);
+
+        bool mSingular = false;
+    };
+
+    /**
+     * Blocked LU decomposition with partial pivoting of a runtime sized matrix.
+     *
+     * L and U share one matrix. Columns are factored in panels of kBlockSize; the trailing
+     * submatrix is updated with one matrix product per panel, which runs on the thread pool for
+     * large matrices.
+     */
+    template<typename T, Layout layout>
+    class LU<DMatrix<T, layout>> {
+    public:
+        using value_type = T;
+
+        /// columns factored per panel
+        static constexpr size_t kBlockSize = 64;
+
+        /**
+         * throws std::invalid_argument when a is not square
+         */
+        explicit LU(const DMatrix<T, layout> &a) : mFactors{a.Clone()}, mPermutation(a.GetRows()) {
+            if (a.GetRows() != a.GetCols()) {
+                throw std::invalid_argument("LU decomposition requires a square matrix");
+            }
+            const size_t n = a.GetRows();
+            for (size_t i = 0; i < n; ++i) {
+                mPermutation[i] = i;
+            }
+            for (size_t k0 = 0; k0 < n; k0 += kBlockSize) {
+                const size_t k1 = k0 + kBlockSize < n ? k0 + kBlockSize : n;
+                FactorPanel(k0, k1);
+                if (k1 < n) {
+                    UpdateTrailing(k0, k1);
+                }
+            }
+        }
+
+        [[nodiscard]] bool IsSingular() const noexcept { return mSingular; }
+
+        /**
+         * L below the diagonal, its unit diagonal implied, and U on and above it
+         */
+        [[nodiscard]] const DMatrix<T, layout> &GetFactors() const noexcept { return mFactors; }
+
+        [[nodiscard]] const std::vector<size_t> &GetPermutation() const noexcept { return mPermutation; }
+
+        [[nodiscard]] T Determinant() const noexcept {
+            T out = mSign;
+            for (size_t i = 0; i < mFactors.GetRows(); ++i) {
+                out *= mFactors(i, i);
+            }
+            return out;
+        }
+
+        /**
+         * x such that A * x = b
+         */
+        [[nodiscard]] DVector<T> Solve(const DVector<T> &b) const {
+            if (b.GetSize() != mFactors.GetRows()) {
+                throw std::invalid_argument("rhs vector length != matrix size");
+            }
+            DVector<T> x(b.GetSize());
+            for (size_t i = 0; i < x.GetSize(); ++i) {
+                x[i] = b[mPermutation[i]];
+            }
+            Substitute(x.GetData());
+            return x;
+        }
+
+        [[nodiscard]] DMatrix<T, layout> Inverse() const {
+            const size_t n = mFactors.GetRows();
+            DMatrix<T, layout> out(n, n);
+            std::vector<T> x(n);
+            for (size_t j = 0; j < n; ++j) {
+                for (size_t i = 0; i < n; ++i) {
+                    x[i] = mPermutation[i] == j ? T(1) : T();
+                }
+                Substitute(x.data());
+                for (size_t i = 0; i < n; ++i) {
+                    out(i, j) = x[i];
+                }
+            }
+            return out;
+        }
+
+    private:
+        /**
+         * unblocked factorization of columns [k0, k1), applying the row swaps across the full width
+         * and the eliminations to the panel columns only
+         */
+        void FactorPanel(const size_t k0, const size_t k1) {
+            DMatrix<T, layout> &a = mFactors;
+            const size_t n = a.GetRows();
+            for (size_t k = k0; k < k1; ++k) {
+                size_t pivot = k;
+                for (size_t i = k + 1; i < n; ++i) {
+                    if (Detail::Abs(a(i, k)) > Detail::Abs(a(pivot, k))) {
+                        pivot = i;
+                    }
+                }
+                if (pivot != k) {
+                    for (size_t j = 0; j < n; ++j) {
+                        std::swap(a(k, j), a(pivot, j));
+                    }
+                    std::swap(mPermutation[k], mPermutation[pivot]);
+                    mSign = -mSign;
+                }
+                const T diagonal = a(k, k);
+                if (diagonal == T()) {
+                    mSingular = true;
+                    continue;
+                }
+                for (size_t i = k + 1; i < n; ++i) {
+                    const T factor = a(i, k) / diagonal;
+                    a(i, k) = factor;
+                    for (size_t j = k + 1; j < k1; ++j) {
+                        a(i, j) -= factor * a(k, j);
+                    }
+                }
+            }
+        }
+
+        /**
+         * U12 = L11^-1 * A12 followed by A22 -= L21 * U12
+         */
+        void UpdateTrailing(const size_t k0, const size_t k1) {
+            DMatrix<T, layout> &a = mFactors;
+            const size_t n = a.GetRows();
+            for (size_t k = k0; k < k1; ++k) {
+                for (size_t i = k + 1; i < k1; ++i) {
+                    const T factor = a(i, k);
+                    for (size_t j = k1; j < n; ++j) {
+                        a(i, j) -= factor * a(k, j);
+                    }
+                }
+            }
+
+            // L21, U12 and A22 are disjoint blocks of the factors, so A22 is updated in place
+            const Gemm::Strided<T> factors{a.GetData(), a.GetRowStride(), a.GetColStride()};
+            Parallel::MultiplyAdd<T>(n - k1, n - k1, k1 - k0, T(-1), Gemm::Offset(factors, k1, k0),
+                                     Gemm::Offset(factors, k0, k1), T(1), Gemm::Offset(factors, k1, k1));
+        }
+
+        void Substitute(T *x) const {
+            if (mSingular) {
+                throw std::invalid_argument("matrix is singular");
+            }
+            const DMatrix<T, layout> &a = mFactors;
+            const size_t n = a.GetRows();
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < i; ++j) {
+                    x[i] -= a(i, j) * x[j];
+                }
+            }
+            for (size_t i = n; i-- > 0;) {
+                for (size_t j = i + 1; j < n; ++j) {
+                    x[i] -= a(i, j) * x[j];
+                }
+                x[i] /= a(i, i);
+            }
+        }
+
+        /// packed L and U
+        DMatrix<T, layout> mFactors;
+
+        /// row i of P * A is row mPermutation[i] of A
+        std::vector<size_t> mPermutation;
+
+        /// determinant of P
+        T mSign = T(1);
+
+        bool mSingular = false;
+    };
+
+    /**
+     * Determinant of a square matrix through its LU decomposition
+     */
+    template<class M> requires Expr::MatrixExpression<M> && Expr::Dense<M>
+    [[nodiscard]] constexpr auto Determinant(const M &m) {
+        return LU<M>(m).Determinant();
+    }
+
+    template<typename T, Layout layout>
+    [[nodiscard]] T Determinant(const DMatrix<T, layout> &m) {
+        return LU<DMatrix<T, layout>>(m).Determinant();
+    }
+
+    /**
+     * Inverse of a square matrix. Throws std::invalid_argument when m is singular.
+     */
+    template<class M> requires Expr::MatrixExpression<M> && Expr::Dense<M>
+    [[nodiscard]] constexpr M Inverse(const M &m) {
+        return LU<M>(m).Inverse();
+    }
+
+    template<typename T, Layout layout>
+    [[nodiscard]] DMatrix<T, layout> Inverse(const DMatrix<T, layout> &m) {
+        return LU<DMatrix<T, layout>>(m).Inverse();
+    }
+
+    /**
+     * x such that m * x = b. Throws std::invalid_argument when m is singular.
+     */
+    template<class M, class V> requires Expr::MatrixExpression<M> && Expr::Dense<M>
+    [[nodiscard]] constexpr V Solve(const M &m, const V &b) {
+        return LU<M>(m).Solve(b);
+    }
+
+    template<typename T, Layout layout>
+    [[nodiscard]] DVector<T> Solve(const DMatrix<T, layout> &m, const DVector<T> &b) {
+        return LU<DMatrix<T, layout>>(m).Solve(b);
+    }
+}
+
+#endif //DRAWING_LU_H
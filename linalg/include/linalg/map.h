@@ -0,0 +1,158 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_MAP_H
+#define DRAWING_MAP_H
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "cmatrix.h"
+#include "rmatrix.h"
+#include "view.h"
+
+/**
+ * Vectors and matrices over memory linalg does not own: vertex buffers, mmapped files, GPU staging
+ * memory. Nothing is copied; a Map is a view (see view.h) created from a pointer instead of from an
+ * RVector, CVector, RMatrix or CMatrix, and works with every operator and kernel those do.
+ *
+ * Map<RVector<3>>(p) reads and writes the three floats at p. Map<const RVector<3>> is read only.
+ * The second argument selects a stride: between the elements of a vector, or between the rows of an
+ * RMatrix (columns of a CMatrix), e.g. the pitch of an image. Map<V, kDynamicStride> takes it at run
+ * time. Only the default, contiguous Map is Expr::Dense.
+ *
+ * MapArray<V> is count such objects spaced a run time stride apart, e.g. the positions of an
+ * interleaved vertex buffer.
+ *
+ * The memory need not be aligned beyond the element type.
+ */
+namespace QS::LinAlg {
+
+    namespace Detail {
+        template<class V>
+        struct MapTraits;
+
+        template<int n, typename T, size_t alignment>
+        struct MapTraits<RVector<n, T, alignment>> {
+            using Element = T;
+            static constexpr size_t kContiguous = 1;
+
+            template<typename E, size_t stride>
+            using View = VectorView<Expr::RowVector<n>, E, stride>;
+        };
+
+        template<int n, typename T, size_t alignment>
+        struct MapTraits<CVector<n, T, alignment>> {
+            using Element = T;
+            static constexpr size_t kContiguous = 1;
+
+            template<typename E, size_t stride>
+            using View = VectorView<Expr::ColumnVector<n>, E, stride>;
+        };
+
+        template<int row, int col, typename T, size_t alignment>
+        struct MapTraits<RMatrix<row, col, T, alignment>> {
+            using Element = T;
+            static constexpr size_t kContiguous = col;
+
+            template<typename E, size_t stride>
+            using View = MatrixView<Expr::RowMajor<row, col>, E, stride, 1>;
+        };
+
+        template<int col, int row, typename T, size_t alignment>
+        struct MapTraits<CMatrix<col, row, T, alignment>> {
+            using Element = T;
+            static constexpr size_t kContiguous = row;
+
+            template<typename E, size_t stride>
+            using View = MatrixView<Expr::ColumnMajor<col, row>, E, stride, 1>;
+        };
+
+        /// the element type of a Map<V>, const when V is
+        template<class V>
+        using MapElement = std::conditional_t<std::is_const_v<V>,
+                const typename MapTraits<std::remove_cv_t<V>>::Element,
+                typename MapTraits<std::remove_cv_t<V>>::Element>;
+    }
+
+    /**
+     * A V over memory at a pointer. The stride is between vector elements for RVector and CVector
+     * and between the rows or columns of RMatrix and CMatrix.
+     */
+    template<class V, size_t stride = Detail::MapTraits<std::remove_cv_t<V>>::kContiguous>
+    using Map = typename Detail::MapTraits<std::remove_cv_t<V>>::template View<Detail::MapElement<V>, stride>;
+
+    /**
+     * count contiguous V at data, data + stride, data + 2 * stride, ... where stride counts elements,
+     * e.g. MapArray<RVector<3>>(geometry.GetVerticesPointer(), 9, count) for the positions of
+     * Geometry<9> vertices
+     */
+    template<class V>
+    class MapArray {
+    public:
+        using T = Detail::MapElement<V>;
+
+        using value_type = Map<V>;
+
+        class Iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = Map<V>;
+            using pointer = void;
+            using reference = Map<V>;
+
+            constexpr Iterator() noexcept = default;
+
+            constexpr Iterator(T *data, const size_t stride, const size_t idx) noexcept
+                    : mData{data}, mStride{stride}, mIdx{idx} {}
+
+            [[nodiscard]] constexpr Map<V> operator*() const noexcept { return Map<V>(mData + mIdx * mStride); }
+
+            constexpr Iterator &operator++() noexcept {
+                ++mIdx;
+                return *this;
+            }
+
+            constexpr Iterator operator++(int) noexcept {
+                Iterator out = *this;
+                ++mIdx;
+                return out;
+            }
+
+            [[nodiscard]] constexpr bool operator==(const Iterator &rhs) const noexcept { return mIdx == rhs.mIdx; }
+
+        private:
+            // an index rather than a pointer, which could step past the end of the buffer
+            T *mData = nullptr;
+            size_t mStride = 0;
+            size_t mIdx = 0;
+        };
+
+        constexpr MapArray(T *data, const size_t stride, const size_t count) noexcept
+                : mData{data}, mStride{stride}, mCount{count} {}
+
+        [[nodiscard]] constexpr Map<V> operator[](const size_t idx) const noexcept {
+            return Map<V>(mData + idx * mStride);
+        }
+
+        [[nodiscard]] constexpr size_t GetSize() const noexcept { return mCount; }
+
+        [[nodiscard]] constexpr size_t GetStride() const noexcept { return mStride; }
+
+        [[nodiscard]] constexpr T *GetData() const noexcept { return mData; }
+
+        [[nodiscard]] constexpr Iterator begin() const noexcept { return Iterator(mData, mStride, 0); }
+
+        [[nodiscard]] constexpr Iterator end() const noexcept { return Iterator(mData, mStride, mCount); }
+
+    private:
+        T *mData;
+        size_t mStride;
+        size_t mCount;
+    };
+}
+
+#endif //DRAWING_MAP_H
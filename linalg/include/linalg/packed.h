@@ -0,0 +1,219 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_PACKED_H
+#define DRAWING_PACKED_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "expression.h"
+
+/**
+ * Compact element types for vertex attributes and other memory bound data: Half, an IEEE 754
+ * binary16 float, and UNorm8 and UNorm16, which map [0, 1] onto the full range of an unsigned
+ * integer as GPUs do for normalized attributes.
+ *
+ * Each converts implicitly to and from float, so arithmetic on them happens in float and the
+ * vector and matrix types accept them as element types. Converting a whole buffer at once is
+ * faster through Pack and Unpack, which are vectorized for float.
+ */
+namespace QS::LinAlg {
+
+    namespace Detail {
+        /**
+         * float to binary16 bits, rounding to nearest even. NaN becomes a quiet NaN.
+         */
+        constexpr uint16_t FloatToHalf(const float value) noexcept {
+            constexpr uint32_t infinity = 255u << 23;
+            // smallest float that rounds to a binary16 infinity
+            constexpr uint32_t halfMax = (127u + 16u) << 23;
+            // adding this float aligns the 10 subnormal mantissa bits at the bottom
+            constexpr uint32_t subnormalMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+            uint32_t bits = std::bit_cast<uint32_t>(value);
+            const uint32_t sign = bits & 0x80000000u;
+            bits ^= sign;
+
+            uint32_t out;
+            if (bits >= halfMax) {
+                out = bits > infinity ? 0x7e00u : 0x7c00u;
+            } else if (bits < (113u << 23)) {
+                const float aligned = std::bit_cast<float>(bits) + std::bit_cast<float>(subnormalMagic);
+                out = std::bit_cast<uint32_t>(aligned) - subnormalMagic;
+            } else {
+                const uint32_t odd = (bits >> 13) & 1u;
+                out = (bits + (static_cast<uint32_t>(15 - 127) << 23) + 0xfffu + odd) >> 13;
+            }
+            return static_cast<uint16_t>(out | sign >> 16);
+        }
+
+        /**
+         * binary16 bits to float, exact
+         */
+        constexpr float HalfToFloat(const uint16_t half) noexcept {
+            const uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+            const uint32_t exponent = (half >> 10) & 0x1fu;
+            const uint32_t mantissa = half & 0x3ffu;
+            if (exponent == 0) {
+                const float magnitude = static_cast<float>(mantissa) * 0x1p-24f;
+                return std::bit_cast<float>(sign | std::bit_cast<uint32_t>(magnitude));
+            }
+            if (exponent == 31) {
+                return std::bit_cast<float>(sign | 0x7f800000u | mantissa << 13);
+            }
+            return std::bit_cast<float>(sign | (exponent + 112u) << 23 | mantissa << 13);
+        }
+
+        /**
+         * value clamped to [0, 1] and scaled to [0, max], rounding to nearest even. NaN becomes 0.
+         */
+        template<typename Rep>
+        constexpr Rep FloatToUNorm(const float value) noexcept {
+            constexpr Rep max = std::numeric_limits<Rep>::max();
+            if (!(value > 0.0f)) {
+                return 0;
+            }
+            if (value >= 1.0f) {
+                return max;
+            }
+            const float scaled = value * max;
+            auto out = static_cast<uint32_t>(scaled);
+            const float fraction = scaled - static_cast<float>(out);
+            if (fraction > 0.5f || (fraction == 0.5f && (out & 1u))) {
+                ++out;
+            }
+            return static_cast<Rep>(out);
+        }
+    }
+
+    /**
+     * IEEE 754 half precision float: 1 sign, 5 exponent and 10 mantissa bits. Exact up to 2048 and
+     * finite up to 65504.
+     */
+    class Half {
+    public:
+        constexpr Half() noexcept = default;
+
+        constexpr Half(const float value) noexcept : mBits{Detail::FloatToHalf(value)} {}
+
+        [[nodiscard]] static constexpr Half FromBits(const uint16_t bits) noexcept {
+            Half out;
+            out.mBits = bits;
+            return out;
+        }
+
+        [[nodiscard]] constexpr uint16_t GetBits() const noexcept { return mBits; }
+
+        constexpr operator float() const noexcept { return Detail::HalfToFloat(mBits); }
+
+        constexpr Half &operator+=(const float rhs) noexcept { return *this = *this + rhs; }
+
+        constexpr Half &operator-=(const float rhs) noexcept { return *this = *this - rhs; }
+
+        constexpr Half &operator*=(const float rhs) noexcept { return *this = *this * rhs; }
+
+        constexpr Half &operator/=(const float rhs) noexcept { return *this = *this / rhs; }
+
+    private:
+        uint16_t mBits = 0;
+    };
+
+    /**
+     * Unsigned normalized value: the integer k of Rep stands for k / max(Rep). Floats are clamped
+     * to [0, 1] when converted.
+     */
+    template<typename Rep>
+    class UNorm {
+        static_assert(std::is_integral_v<Rep> && std::is_unsigned_v<Rep> && sizeof(Rep) <= 2,
+                      "Rep must be an 8 or 16 bit unsigned integer");
+
+    public:
+        constexpr UNorm() noexcept = default;
+
+        constexpr UNorm(const float value) noexcept : mBits{Detail::FloatToUNorm<Rep>(value)} {}
+
+        [[nodiscard]] static constexpr UNorm FromBits(const Rep bits) noexcept {
+            UNorm out;
+            out.mBits = bits;
+            return out;
+        }
+
+        [[nodiscard]] constexpr Rep GetBits() const noexcept { return mBits; }
+
+        constexpr operator float() const noexcept {
+            return static_cast<float>(mBits) / std::numeric_limits<Rep>::max();
+        }
+
+        constexpr UNorm &operator+=(const float rhs) noexcept { return *this = *this + rhs; }
+
+        constexpr UNorm &operator-=(const float rhs) noexcept { return *this = *this - rhs; }
+
+        constexpr UNorm &operator*=(const float rhs) noexcept { return *this = *this * rhs; }
+
+        constexpr UNorm &operator/=(const float rhs) noexcept { return *this = *this / rhs; }
+
+    private:
+        Rep mBits = 0;
+    };
+
+    using UNorm8 = UNorm<uint8_t>;
+
+    using UNorm16 = UNorm<uint16_t>;
+
+    static_assert(sizeof(Half) == 2 && sizeof(UNorm8) == 1 && sizeof(UNorm16) == 2,
+                  "packed spans must match the GPU attribute formats");
+
+    /**
+     * out[i] = in[i] converted to T for i in [0, n)
+     */
+    template<typename T>
+    void Pack(const float *in, T *out, const size_t n) noexcept {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = in[i];
+        }
+    }
+
+    /**
+     * out[i] = in[i] converted to float for i in [0, n)
+     */
+    template<typename T>
+    void Unpack(const T *in, float *out, const size_t n) noexcept {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = in[i];
+        }
+    }
+
+    // vectorized overloads, defined in packed.cpp. Half uses the F16C instructions when the target
+    // has them.
+    void Pack(const float *in, Half *out, size_t n) noexcept;
+
+    void Pack(const float *in, UNorm8 *out, size_t n) noexcept;
+
+    void Pack(const float *in, UNorm16 *out, size_t n) noexcept;
+
+    void Unpack(const Half *in, float *out, size_t n) noexcept;
+
+    void Unpack(const UNorm8 *in, float *out, size_t n) noexcept;
+
+    void Unpack(const UNorm16 *in, float *out, size_t n) noexcept;
+}
+
+namespace QS::LinAlg::Expr {
+
+    template<>
+    struct Accumulator<Half> {
+        using type = float;
+    };
+
+    template<typename Rep>
+    struct Accumulator<UNorm<Rep>> {
+        using type = float;
+    };
+}
+
+#endif //DRAWING_PACKED_H
@@ -0,0 +1,224 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_PARALLEL_H
+#define DRAWING_PARALLEL_H
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "gemm.h"
+#include "simd.h"
+#include "thread_pool.h"
+
+/**
+ * Multithreaded kernels for the runtime sized types. Work below the serial cutoffs runs on the
+ * calling thread so small products never pay for scheduling. The fixed size types never use these.
+ */
+namespace QS::LinAlg::Parallel {
+
+    /// output tile computed by one task of Multiply
+    constexpr size_t kTileRows = Gemm::kBlockRows;
+
+    /// output tile computed by one task of Multiply
+    constexpr size_t kTileCols = 128;
+
+    /// elements handled by one task of Apply
+    constexpr size_t kGrainSize = 1 << 14;
+
+    namespace Detail {
+        inline std::atomic<size_t> gMultiplyCutoff{64 * 64 * 64};
+
+        inline std::atomic<size_t> gElementCutoff{1 << 16};
+    }
+
+    /**
+     * Products with fewer than flops multiply-adds (m * n * k) run serially
+     */
+    inline void SetMultiplyCutoff(const size_t flops) noexcept { Detail::gMultiplyCutoff = flops; }
+
+    [[nodiscard]] inline size_t GetMultiplyCutoff() noexcept { return Detail::gMultiplyCutoff; }
+
+    /**
+     * Element-wise operations over fewer than elements values run serially
+     */
+    inline void SetElementCutoff(const size_t elements) noexcept { Detail::gElementCutoff = elements; }
+
+    [[nodiscard]] inline size_t GetElementCutoff() noexcept { return Detail::gElementCutoff; }
+
+    /**
+     * Calls f(begin, end) over consecutive sub-ranges covering [0, n), in parallel when n reaches the
+     * element cutoff
+     * \param cost elements touched per index, e.g. the row length when f walks whole rows; the
+     * cutoff and the kGrainSize elements per task then count elements rather than indices
+     */
+    template<typename F>
+    void Apply(const size_t n, F &&f, const size_t cost = 1) {
+        ThreadPool &pool = GetThreadPool();
+        if (n * cost < GetElementCutoff() || pool.GetThreadCount() == 1) {
+            f(size_t{0}, n);
+            return;
+        }
+        const size_t grain = cost < kGrainSize ? kGrainSize / cost : 1;
+        const size_t chunks = (n + grain - 1) / grain;
+        pool.ParallelFor(chunks, [n, grain, &f](size_t chunk) {
+            const size_t begin = chunk * grain;
+            f(begin, begin + grain < n ? begin + grain : n);
+        });
+    }
+
+    /**
+     * Simd::Add split across the pool
+     */
+    template<typename T>
+    void Add(const T *lhs, const T *rhs, T *out, const size_t n) {
+        Apply(n, [=](size_t begin, size_t end) { Simd::Add(lhs + begin, rhs + begin, out + begin, end - begin); });
+    }
+
+    /**
+     * Simd::Sub split across the pool
+     */
+    template<typename T>
+    void Sub(const T *lhs, const T *rhs, T *out, const size_t n) {
+        Apply(n, [=](size_t begin, size_t end) { Simd::Sub(lhs + begin, rhs + begin, out + begin, end - begin); });
+    }
+
+    /**
+     * Simd::Scale split across the pool
+     */
+    template<typename T>
+    void Scale(const T *lhs, const T scalar, T *out, const size_t n) {
+        Apply(n, [=](size_t begin, size_t end) { Simd::Scale(lhs + begin, scalar, out + begin, end - begin); });
+    }
+
+    /**
+     * Simd::Axpy split across the pool
+     */
+    template<typename T>
+    void Axpy(const T alpha, const T *x, T *y, const size_t n) {
+        Apply(n, [=](size_t begin, size_t end) { Simd::Axpy(alpha, x + begin, y + begin, end - begin); });
+    }
+
+    /**
+     * Simd::Axpby split across the pool
+     */
+    template<typename T>
+    void Axpby(const T alpha, const T *x, const T beta, T *y, const size_t n) {
+        Apply(n, [=](size_t begin, size_t end) { Simd::Axpby(alpha, x + begin, beta, y + begin, end - begin); });
+    }
+
+    /**
+     * Simd::Dot split across the pool. Every chunk of kGrainSize elements is summed separately and
+     * the partial sums are added in order, serially below the cutoff as well, so the result does not
+     * depend on the thread count.
+     */
+    template<typename T>
+    [[nodiscard]] T Dot(const T *lhs, const T *rhs, const size_t n) {
+        const size_t chunks = (n + kGrainSize - 1) / kGrainSize;
+        const auto partialDot = [=](const size_t chunk) {
+            const size_t begin = chunk * kGrainSize;
+            return Simd::Dot(lhs + begin, rhs + begin, (begin + kGrainSize < n ? begin + kGrainSize : n) - begin);
+        };
+        T out = T();
+        ThreadPool &pool = GetThreadPool();
+        if (n < GetElementCutoff() || pool.GetThreadCount() == 1) {
+            for (size_t chunk = 0; chunk < chunks; ++chunk) {
+                out += partialDot(chunk);
+            }
+            return out;
+        }
+        std::vector<T> partial(chunks);
+        pool.ParallelFor(chunks, [&partial, &partialDot](size_t chunk) { partial[chunk] = partialDot(chunk); });
+        for (const T &value: partial) {
+            out += value;
+        }
+        return out;
+    }
+
+    /**
+     * c = a * b like Gemm::Multiply, with the output split into kTileRows x kTileCols tiles that are
+     * scheduled on the thread pool
+     */
+    template<typename T, typename A, typename B, typename C>
+    void Multiply(const size_t m, const size_t n, const size_t k, const A &a, const B &b, C &&c) {
+        ThreadPool &pool = GetThreadPool();
+        if (m * n * k < GetMultiplyCutoff() || pool.GetThreadCount() == 1) {
+            Gemm::Multiply<T>(m, n, k, a, b, c);
+            return;
+        }
+        const size_t tileRows = (m + kTileRows - 1) / kTileRows;
+        const size_t tileCols = (n + kTileCols - 1) / kTileCols;
+        pool.ParallelFor(tileRows * tileCols, [&](size_t tile) {
+            const size_t i0 = (tile / tileCols) * kTileRows;
+            const size_t j0 = (tile % tileCols) * kTileCols;
+            const size_t rows = m - i0 < kTileRows ? m - i0 : kTileRows;
+            const size_t cols = n - j0 < kTileCols ? n - j0 : kTileCols;
+            Gemm::Multiply<T>(rows, cols, k, Gemm::Offset(a, i0, 0), Gemm::Offset(b, 0, j0), Gemm::Offset(c, i0, j0));
+        });
+    }
+
+    /**
+     * c = alpha * a * b + beta * c like Gemm::MultiplyAdd, tiled like Multiply
+     */
+    template<typename T, typename A, typename B, typename C>
+    void MultiplyAdd(const size_t m, const size_t n, const size_t k, const T alpha, const A &a, const B &b,
+                     const T beta, C &&c) {
+        ThreadPool &pool = GetThreadPool();
+        if (m * n * k < GetMultiplyCutoff() || pool.GetThreadCount() == 1) {
+            Gemm::MultiplyAdd<T>(m, n, k, alpha, a, b, beta, c);
+            return;
+        }
+        const size_t tileRows = (m + kTileRows - 1) / kTileRows;
+        const size_t tileCols = (n + kTileCols - 1) / kTileCols;
+        pool.ParallelFor(tileRows * tileCols, [&](size_t tile) {
+            const size_t i0 = (tile / tileCols) * kTileRows;
+            const size_t j0 = (tile % tileCols) * kTileCols;
+            const size_t rows = m - i0 < kTileRows ? m - i0 : kTileRows;
+            const size_t cols = n - j0 < kTileCols ? n - j0 : kTileCols;
+            Gemm::MultiplyAdd<T>(rows, cols, k, alpha, Gemm::Offset(a, i0, 0), Gemm::Offset(b, 0, j0), beta,
+                                 Gemm::Offset(c, i0, j0));
+        });
+    }
+
+    /**
+     * MultiplyAdd for an n x n c of which only the lower triangle is wanted, as in the symmetric
+     * updates of a Cholesky factorization. Only the kTileRows x kTileRows tiles on and below the
+     * diagonal are computed, about half the work; the tiles on the diagonal are computed whole, so
+     * entries just above the diagonal are overwritten too.
+     */
+    template<typename T, typename A, typename B, typename C>
+    void MultiplyAddLower(const size_t n, const size_t k, const T alpha, const A &a, const B &b, const T beta,
+                          C &&c) {
+        const size_t tileCount = (n + kTileRows - 1) / kTileRows;
+        // tile t is row i, column j of the lower block triangle, numbered row by row
+        const auto tile = [&](size_t t) {
+            size_t i = static_cast<size_t>((std::sqrt(8.0 * static_cast<double>(t) + 1.0) - 1.0) / 2.0);
+            while (i * (i + 1) / 2 > t) {
+                --i;
+            }
+            while ((i + 1) * (i + 2) / 2 <= t) {
+                ++i;
+            }
+            const size_t i0 = i * kTileRows;
+            const size_t j0 = (t - i * (i + 1) / 2) * kTileRows;
+            const size_t rows = n - i0 < kTileRows ? n - i0 : kTileRows;
+            const size_t cols = n - j0 < kTileRows ? n - j0 : kTileRows;
+            Gemm::MultiplyAdd<T>(rows, cols, k, alpha, Gemm::Offset(a, i0, 0), Gemm::Offset(b, 0, j0), beta,
+                                 Gemm::Offset(c, i0, j0));
+        };
+        const size_t tiles = tileCount * (tileCount + 1) / 2;
+        ThreadPool &pool = GetThreadPool();
+        if (n * n * k / 2 < GetMultiplyCutoff() || pool.GetThreadCount() == 1) {
+            for (size_t t = 0; t < tiles; ++t) {
+                tile(t);
+            }
+            return;
+        }
+        pool.ParallelFor(tiles, tile);
+    }
+}
+
+#endif //DRAWING_PARALLEL_H
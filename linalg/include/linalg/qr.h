@@ -0,0 +1,391 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_QR_H
+#define DRAWING_QR_H
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "cmatrix.h"
+#include "cvector.h"
+#include "dmatrix.h"
+#include "dvector.h"
+#include "expression.h"
+#include "lu.h"
+#include "parallel.h"
+#include "rmatrix.h"
+#include "rvector.h"
+#include "unroll.h"
+
+namespace QS::LinAlg {
+
+    namespace Detail {
+        /**
+         * the vector type V with n elements
+         */
+        template<class V, int n>
+        struct Resized;
+
+        template<int length, typename T, size_t alignment, int n>
+        struct Resized<RVector<length, T, alignment>, n> {
+            using type = RVector<n, T>;
+        };
+
+        template<int length, typename T, size_t alignment, int n>
+        struct Resized<CVector<length, T, alignment>, n> {
+            using type = CVector<n, T>;
+        };
+
+        /**
+         * Householder reflector H = I - tau v v^T with v[0] = 1 that maps x = (alpha, x[1..]) onto
+         * (beta, 0, ...). x[1..] is overwritten with v[1..] by scale, alpha with beta, and tau
+         * returned. tau = 0 when x[1..] is already zero.
+         * \param at at(i) is x[i]
+         */
+        template<typename T, typename At>
+        T Householder(const size_t n, At &&at) {
+            T sigma = T();
+            for (size_t i = 1; i < n; ++i) {
+                sigma += at(i) * at(i);
+            }
+            if (sigma == T()) {
+                return T();
+            }
+            const T alpha = at(0);
+            const T norm = std::sqrt(alpha * alpha + sigma);
+            const T beta = alpha > T() ? -norm : norm;
+            const T scale = T(1) / (alpha - beta);
+            for (size_t i = 1; i < n; ++i) {
+                at(i) *= scale;
+            }
+            at(0) = beta;
+            return (beta - alpha) / beta;
+        }
+
+        /**
+         * Householder above for a length n known at compile time, with both loops unrolled
+         */
+        template<typename T, size_t n, typename At>
+        T Householder(At &&at) {
+            T sigma = T();
+            Unroll<1, n>([&](auto i) { sigma += at(i) * at(i); });
+            if (sigma == T()) {
+                return T();
+            }
+            const T alpha = at(0);
+            const T norm = std::sqrt(alpha * alpha + sigma);
+            const T beta = alpha > T() ? -norm : norm;
+            const T scale = T(1) / (alpha - beta);
+            Unroll<1, n>([&](auto i) { at(i) *= scale; });
+            at(0) = beta;
+            return (beta - alpha) / beta;
+        }
+    }
+
+    /**
+     * Householder QR decomposition, A = Q * R, of an RMatrix or CMatrix with at least as many rows
+     * as columns.
+     *
+     * R is stored on and above the diagonal of GetFactors() and the Householder vectors below it,
+     * as LAPACK does; Q is never formed. Every loop is unrolled at compile time, which suits the
+     * small matrices this is meant for.
+     */
+    template<class M>
+    class QR {
+    public:
+        static constexpr int rows = Expr::ShapeOf<M>::rows;
+
+        static constexpr int cols = Expr::ShapeOf<M>::cols;
+
+        static_assert(rows >= cols, "QR decomposition requires at least as many rows as columns");
+
+        using value_type = typename M::value_type;
+
+        explicit QR(const M &a) : mFactors{a} {
+            Detail::Unroll<0, cols>([&](auto kc) {
+                constexpr size_t k = decltype(kc)::value;
+                mTau[k] = Detail::Householder<value_type, rows - k>(
+                        [this](size_t i) -> value_type & { return Element(k + i, k); });
+                Detail::Unroll<k + 1, cols>([&](auto j) {
+                    Reflect<k>([this, j](size_t i) -> value_type & { return Element(i, j); });
+                });
+            });
+        }
+
+        /**
+         * whether R has a zero on its diagonal, which makes Solve throw
+         */
+        [[nodiscard]] bool IsRankDeficient() const noexcept {
+            bool out = false;
+            Detail::Unroll<0, cols>([&](auto k) { out = out || Detail::Element(mFactors, k, k) == value_type(); });
+            return out;
+        }
+
+        /**
+         * R on and above the diagonal, the Householder vectors below it
+         */
+        [[nodiscard]] const M &GetFactors() const noexcept { return mFactors; }
+
+        /**
+         * Q = H(0) * ... * H(cols - 1) with H(k) = I - GetTau()[k] * v v^T
+         */
+        [[nodiscard]] const std::array<value_type, cols> &GetTau() const noexcept { return mTau; }
+
+        /**
+         * x minimizing ||A * x - b||. Throws std::invalid_argument when A is rank deficient.
+         * \tparam V RVector<rows> or CVector<rows>; the result is the same kind of vector of length
+         * cols
+         */
+        template<class V>
+        [[nodiscard]] typename Detail::Resized<V, cols>::type Solve(const V &b) const {
+            static_assert(Expr::ShapeOf<V>::length == rows, "rhs vector length != matrix rows");
+            std::array<value_type, rows> y{};
+            Detail::Unroll<0, rows>([&](auto i) { y[i] = b[i]; });
+            Detail::Unroll<0, cols>([&](auto k) {
+                Reflect<decltype(k)::value>([&y](size_t i) -> value_type & { return y[i]; });
+            });
+            typename Detail::Resized<V, cols>::type out;
+            Detail::Unroll<0, cols>([&](auto rc) {
+                constexpr size_t i = cols - 1 - decltype(rc)::value;
+                value_type sum = y[i];
+                Detail::Unroll<i + 1, cols>([&](auto j) { sum -= Detail::Element(mFactors, i, j) * out[j]; });
+                const value_type diagonal = Detail::Element(mFactors, i, i);
+                if (diagonal == value_type()) {
+                    throw std::invalid_argument("matrix is rank deficient");
+                }
+                out[i] = sum / diagonal;
+            });
+            return out;
+        }
+
+    private:
+        value_type &Element(const size_t r, const size_t c) noexcept { return Detail::Element(mFactors, r, c); }
+
+        /**
+         * applies H(k) to the column x, where x(i) is row i
+         */
+        template<size_t k, typename At>
+        void Reflect(At &&x) const {
+            if (mTau[k] == value_type()) {
+                return;
+            }
+            value_type w = x(k);
+            Detail::Unroll<k + 1, rows>([&](auto i) { w += Detail::Element(mFactors, i, k) * x(i); });
+            w *= mTau[k];
+            x(k) -= w;
+            Detail::Unroll<k + 1, rows>([&](auto i) { x(i) -= w * Detail::Element(mFactors, i, k); });
+        }
+
+        M mFactors;
+
+        std::array<value_type, cols> mTau{};
+    };
+
+    /**
+     * Blocked Householder QR decomposition of a runtime sized matrix with at least as many rows as
+     * columns.
+     *
+     * Columns are factored in panels of kBlockSize. The panel's reflectors are combined into the
+     * compact WY form I - V * T * V^T and applied to the trailing columns with two matrix products,
+     * which run on the thread pool for large matrices.
+     */
+    template<typename T, Layout layout>
+    class QR<DMatrix<T, layout>> {
+    public:
+        using value_type = T;
+
+        /// columns factored per panel
+        static constexpr size_t kBlockSize = 32;
+
+        /**
+         * throws std::invalid_argument when a has fewer rows than columns
+         */
+        explicit QR(const DMatrix<T, layout> &a) : mFactors{a.Clone()}, mTau(a.GetCols()) {
+            if (a.GetRows() < a.GetCols()) {
+                throw std::invalid_argument("QR decomposition requires at least as many rows as columns");
+            }
+            const size_t n = a.GetCols();
+            for (size_t k0 = 0; k0 < n; k0 += kBlockSize) {
+                const size_t k1 = k0 + kBlockSize < n ? k0 + kBlockSize : n;
+                FactorPanel(k0, k1);
+                if (k1 < n) {
+                    UpdateTrailing(k0, k1);
+                }
+            }
+        }
+
+        [[nodiscard]] bool IsRankDeficient() const noexcept {
+            for (size_t k = 0; k < mFactors.GetCols(); ++k) {
+                if (mFactors(k, k) == T()) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * R on and above the diagonal, the Householder vectors below it
+         */
+        [[nodiscard]] const DMatrix<T, layout> &GetFactors() const noexcept { return mFactors; }
+
+        [[nodiscard]] const std::vector<T> &GetTau() const noexcept { return mTau; }
+
+        /**
+         * x minimizing ||A * x - b||. Throws std::invalid_argument when A is rank deficient.
+         */
+        [[nodiscard]] DVector<T> Solve(const DVector<T> &b) const {
+            const size_t m = mFactors.GetRows(), n = mFactors.GetCols();
+            if (b.GetSize() != m) {
+                throw std::invalid_argument("rhs vector length != matrix rows");
+            }
+            DVector<T> y = b.Clone();
+            for (size_t k = 0; k < n; ++k) {
+                Reflect(k, [&y](size_t i) -> T & { return y[i]; });
+            }
+            DVector<T> out(n);
+            for (size_t i = n; i-- > 0;) {
+                T sum = y[i];
+                for (size_t j = i + 1; j < n; ++j) {
+                    sum -= mFactors(i, j) * out[j];
+                }
+                if (mFactors(i, i) == T()) {
+                    throw std::invalid_argument("matrix is rank deficient");
+                }
+                out[i] = sum / mFactors(i, i);
+            }
+            return out;
+        }
+
+    private:
+        /**
+         * unblocked factorization of columns [k0, k1), applying each reflector to the rest of the
+         * panel only
+         */
+        void FactorPanel(const size_t k0, const size_t k1) {
+            DMatrix<T, layout> &a = mFactors;
+            for (size_t k = k0; k < k1; ++k) {
+                mTau[k] = Detail::Householder<T>(a.GetRows() - k, [&a, k](size_t i) -> T & { return a(k + i, k); });
+                for (size_t j = k + 1; j < k1; ++j) {
+                    Reflect(k, [&a, j](size_t i) -> T & { return a(i, j); });
+                }
+            }
+        }
+
+        /**
+         * Applies H(k1 - 1) * ... * H(k0) = I - V * T^T * V^T to the columns right of the panel as
+         * W = T^T * (V^T * A2) followed by A2 -= V * W
+         */
+        void UpdateTrailing(const size_t k0, const size_t k1) {
+            DMatrix<T, layout> &a = mFactors;
+            const size_t m = a.GetRows() - k0, n = a.GetCols() - k1, b = k1 - k0;
+            // V, unit lower trapezoidal, copied out of the factors so both products take strided operands
+            DMatrix<T, layout> v(m, b);
+            for (size_t p = 0; p < b; ++p) {
+                v(p, p) = T(1);
+                for (size_t i = p + 1; i < m; ++i) {
+                    v(i, p) = a(k0 + i, k0 + p);
+                }
+            }
+            const Gemm::Strided<const T> vs{v.GetData(), v.GetRowStride(), v.GetColStride()};
+            const Gemm::Strided<const T> vts{v.GetData(), v.GetColStride(), v.GetRowStride()};
+            const Gemm::Strided<T> factors{a.GetData(), a.GetRowStride(), a.GetColStride()};
+            const Gemm::Strided<T> a2 = Gemm::Offset(factors, k0, k1);
+
+            // row major, so the triangular product below works on contiguous rows
+            DMatrix<T, Layout::RowMajor> w(b, n);
+            const Gemm::Strided<T> ws{w.GetData(), w.GetRowStride(), w.GetColStride()};
+            Parallel::Multiply<T>(b, n, m, vts, a2, ws);
+
+            // W = T^T * W in place; row i of T^T * W reads rows 0..i of W, so the rows are replaced bottom up
+            const DMatrix<T, layout> t = TriangularFactor(k0, k1);
+            for (size_t i = b; i-- > 0;) {
+                T *row = &w(i, 0);
+                Simd::Scale(row, t(i, i), row, n);
+                for (size_t p = 0; p < i; ++p) {
+                    Simd::Axpy(t(p, i), &w(p, 0), row, n);
+                }
+            }
+
+            // V and W are copies, so A2 is updated in place
+            Parallel::MultiplyAdd<T>(m, n, b, T(-1), vs, ws, T(1), a2);
+        }
+
+        /**
+         * upper triangular T with H(k0) * ... * H(k1 - 1) = I - V * T * V^T, built a column at a
+         * time from T(0:i, i) = -tau(i) * T(0:i, 0:i) * V(:, 0:i)^T * v(i)
+         */
+        [[nodiscard]] DMatrix<T, layout> TriangularFactor(const size_t k0, const size_t k1) const {
+            const DMatrix<T, layout> &a = mFactors;
+            const size_t b = k1 - k0;
+            DMatrix<T, layout> t(b, b);
+            std::vector<T> z(b);
+            for (size_t i = 0; i < b; ++i) {
+                const T tau = mTau[k0 + i];
+                t(i, i) = tau;
+                // z = V(:, 0:i)^T * v(i); v(i) is zero above row i and one on it
+                for (size_t p = 0; p < i; ++p) {
+                    T sum = a(k0 + i, k0 + p);
+                    for (size_t r = k0 + i + 1; r < a.GetRows(); ++r) {
+                        sum += a(r, k0 + p) * a(r, k0 + i);
+                    }
+                    z[p] = sum;
+                }
+                for (size_t p = 0; p < i; ++p) {
+                    T sum = T();
+                    for (size_t q = p; q < i; ++q) {
+                        sum += t(p, q) * z[q];
+                    }
+                    t(p, i) = -tau * sum;
+                }
+            }
+            return t;
+        }
+
+        /**
+         * applies H(k) to the column x, where x(i) is row i
+         */
+        template<typename At>
+        void Reflect(const size_t k, At &&x) const {
+            if (mTau[k] == T()) {
+                return;
+            }
+            const DMatrix<T, layout> &a = mFactors;
+            T w = x(k);
+            for (size_t i = k + 1; i < a.GetRows(); ++i) {
+                w += a(i, k) * x(i);
+            }
+            w *= mTau[k];
+            x(k) -= w;
+            for (size_t i = k + 1; i < a.GetRows(); ++i) {
+                x(i) -= w * a(i, k);
+            }
+        }
+
+        /// packed R and Householder vectors
+        DMatrix<T, layout> mFactors;
+
+        std::vector<T> mTau;
+    };
+
+    /**
+     * x minimizing ||m * x - b|| for a matrix with at least as many rows as columns, through its QR
+     * decomposition. Throws std::invalid_argument when m is rank deficient.
+     */
+    template<class M, class V> requires Expr::MatrixExpression<M> && Expr::Dense<M>
+    [[nodiscard]] auto LeastSquares(const M &m, const V &b) {
+        return QR<M>(m).Solve(b);
+    }
+
+    template<typename T, Layout layout>
+    [[nodiscard]] DVector<T> LeastSquares(const DMatrix<T, layout> &m, const DVector<T> &b) {
+        return QR<DMatrix<T, layout>>(m).Solve(b);
+    }
+}
+
+#endif //DRAWING_QR_H
@@ -0,0 +1,251 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_QUATERNION_H
+#define DRAWING_QUATERNION_H
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+#include "cmatrix.h"
+#include "expression.h"
+#include "rvector.h"
+
+namespace QS::LinAlg {
+
+    /**
+     * Rotation quaternion x i + y j + z k + w, stored as the four values (x, y, z, w).
+     *
+     * Unit quaternions represent rotations; q * p applies p first and then q. A span of
+     * Quaternion<float> is a packed float buffer of 4 values per rotation, which the batched
+     * Slerp and Nlerp below consume directly.
+     */
+    template<typename T = float>
+    class Quaternion {
+    public:
+        using value_type = T;
+
+        /**
+         * Produces the identity rotation
+         */
+        constexpr Quaternion() noexcept : mData{ T(), T(), T(), T(1) } {}
+
+        constexpr Quaternion(const T x, const T y, const T z, const T w) noexcept : mData{ x, y, z, w } {}
+
+        /**
+         * Rotation by angle radians about a unit axis
+         */
+        [[nodiscard]] static Quaternion FromAxisAngle(const RVector<3, T> &axis, const T angle) noexcept {
+            const T s = std::sin(angle / 2);
+            return { axis[0] * s, axis[1] * s, axis[2] * s, std::cos(angle / 2) };
+        }
+
+        /**
+         * Rotation held by the upper left 3x3 block of m, which must be orthonormal
+         */
+        template<int n, size_t alignment> requires (n == 3 || n == 4)
+        [[nodiscard]] static Quaternion FromMatrix(const CMatrix<n, n, T, alignment> &m) noexcept {
+            // element (r, c) is m[c][r]
+            const T m00 = m[0][0], m11 = m[1][1], m22 = m[2][2];
+            const T trace = m00 + m11 + m22;
+            Quaternion out;
+            if (trace > T()) {
+                const T s = std::sqrt(trace + 1) * 2;
+                out = { (m[1][2] - m[2][1]) / s, (m[2][0] - m[0][2]) / s, (m[0][1] - m[1][0]) / s, s / 4 };
+            } else if (m00 > m11 && m00 > m22) {
+                const T s = std::sqrt(1 + m00 - m11 - m22) * 2;
+                out = { s / 4, (m[0][1] + m[1][0]) / s, (m[2][0] + m[0][2]) / s, (m[1][2] - m[2][1]) / s };
+            } else if (m11 > m22) {
+                const T s = std::sqrt(1 + m11 - m00 - m22) * 2;
+                out = { (m[0][1] + m[1][0]) / s, s / 4, (m[1][2] + m[2][1]) / s, (m[2][0] - m[0][2]) / s };
+            } else {
+                const T s = std::sqrt(1 + m22 - m00 - m11) * 2;
+                out = { (m[2][0] + m[0][2]) / s, (m[1][2] + m[2][1]) / s, s / 4, (m[0][1] - m[1][0]) / s };
+            }
+            return out.Normalized();
+        }
+
+        /**
+         * Rotation matrix of a unit quaternion. The 4x4 form has no translation.
+         */
+        template<int n> requires (n == 3 || n == 4)
+        [[nodiscard]] constexpr CMatrix<n, n, T> ToMatrix() const noexcept {
+            const T x = mData[0], y = mData[1], z = mData[2], w = mData[3];
+            CMatrix<n, n, T> out;
+            out[0][0] = 1 - 2 * (y * y + z * z);
+            out[0][1] = 2 * (x * y + w * z);
+            out[0][2] = 2 * (x * z - w * y);
+            out[1][0] = 2 * (x * y - w * z);
+            out[1][1] = 1 - 2 * (x * x + z * z);
+            out[1][2] = 2 * (y * z + w * x);
+            out[2][0] = 2 * (x * z + w * y);
+            out[2][1] = 2 * (y * z - w * x);
+            out[2][2] = 1 - 2 * (x * x + y * y);
+            if constexpr (n == 4) {
+                out[3][3] = 1;
+            }
+            return out;
+        }
+
+        [[nodiscard]] constexpr T GetX() const noexcept { return mData[0]; }
+
+        [[nodiscard]] constexpr T GetY() const noexcept { return mData[1]; }
+
+        [[nodiscard]] constexpr T GetZ() const noexcept { return mData[2]; }
+
+        [[nodiscard]] constexpr T GetW() const noexcept { return mData[3]; }
+
+        [[nodiscard]] constexpr T &operator[](const size_t idx) noexcept { return mData[idx]; }
+
+        [[nodiscard]] constexpr const T &operator[](const size_t idx) const noexcept { return mData[idx]; }
+
+        [[nodiscard]] constexpr T *GetData() noexcept { return mData.data(); }
+
+        [[nodiscard]] constexpr const T *GetData() const noexcept { return mData.data(); }
+
+        [[nodiscard]] constexpr T Dot(const Quaternion &rhs) const noexcept {
+            return mData[0] * rhs[0] + mData[1] * rhs[1] + mData[2] * rhs[2] + mData[3] * rhs[3];
+        }
+
+        [[nodiscard]] T Norm() const noexcept { return std::sqrt(Dot(*this)); }
+
+        Quaternion &Normalize() noexcept {
+            return *this *= 1 / Norm();
+        }
+
+        [[nodiscard]] Quaternion Normalized() const noexcept {
+            Quaternion out = *this;
+            return out.Normalize();
+        }
+
+        [[nodiscard]] constexpr Quaternion Conjugate() const noexcept {
+            return { -mData[0], -mData[1], -mData[2], mData[3] };
+        }
+
+        /**
+         * Inverse rotation. Equal to Conjugate() for unit quaternions.
+         */
+        [[nodiscard]] constexpr Quaternion Inverse() const noexcept {
+            return Conjugate() * (1 / Dot(*this));
+        }
+
+        /**
+         * Rotates a 3 component vector, RVector<3> or CVector<3>
+         */
+        template<class V> requires (Expr::ShapeOf<V>::length == 3)
+        [[nodiscard]] constexpr V Rotate(const V &v) const noexcept {
+            // v + 2 w (q x v) + 2 q x (q x v)
+            const T x = mData[0], y = mData[1], z = mData[2], w = mData[3];
+            const T tx = 2 * (y * v[2] - z * v[1]);
+            const T ty = 2 * (z * v[0] - x * v[2]);
+            const T tz = 2 * (x * v[1] - y * v[0]);
+            V out;
+            out[0] = v[0] + w * tx + (y * tz - z * ty);
+            out[1] = v[1] + w * ty + (z * tx - x * tz);
+            out[2] = v[2] + w * tz + (x * ty - y * tx);
+            return out;
+        }
+
+        constexpr Quaternion &operator*=(const T scalar) noexcept {
+            for (auto &value: mData) {
+                value *= scalar;
+            }
+            return *this;
+        }
+
+        constexpr Quaternion &operator*=(const Quaternion &rhs) noexcept {
+            return *this = *this * rhs;
+        }
+
+        [[nodiscard]] friend constexpr Quaternion operator*(const Quaternion &lhs, const Quaternion &rhs) noexcept {
+            const T x1 = lhs[0], y1 = lhs[1], z1 = lhs[2], w1 = lhs[3];
+            const T x2 = rhs[0], y2 = rhs[1], z2 = rhs[2], w2 = rhs[3];
+            return { w1 * x2 + x1 * w2 + y1 * z2 - z1 * y2,
+                     w1 * y2 - x1 * z2 + y1 * w2 + z1 * x2,
+                     w1 * z2 + x1 * y2 - y1 * x2 + z1 * w2,
+                     w1 * w2 - x1 * x2 - y1 * y2 - z1 * z2 };
+        }
+
+        [[nodiscard]] friend constexpr Quaternion operator*(Quaternion lhs, const T scalar) noexcept {
+            return lhs *= scalar;
+        }
+
+        [[nodiscard]] friend constexpr Quaternion operator*(const T scalar, Quaternion rhs) noexcept {
+            return rhs *= scalar;
+        }
+
+        [[nodiscard]] friend constexpr Quaternion operator+(const Quaternion &lhs, const Quaternion &rhs) noexcept {
+            return { lhs[0] + rhs[0], lhs[1] + rhs[1], lhs[2] + rhs[2], lhs[3] + rhs[3] };
+        }
+
+        [[nodiscard]] friend constexpr Quaternion operator-(const Quaternion &q) noexcept {
+            return { -q[0], -q[1], -q[2], -q[3] };
+        }
+
+    private:
+        std::array<T, 4> mData;
+    };
+
+    static_assert(sizeof(Quaternion<float>) == 4 * sizeof(float), "quaternion spans must be packed floats");
+
+    /**
+     * Normalized linear interpolation along the shorter arc. Cheaper than Slerp but does not move
+     * at constant angular speed.
+     */
+    template<typename T>
+    [[nodiscard]] Quaternion<T> Nlerp(const Quaternion<T> &from, const Quaternion<T> &to, const T t) noexcept {
+        const T sign = from.Dot(to) < T() ? T(-1) : T(1);
+        return (from * (1 - t) + to * (sign * t)).Normalize();
+    }
+
+    /**
+     * Spherical linear interpolation along the shorter arc
+     */
+    template<typename T>
+    [[nodiscard]] Quaternion<T> Slerp(const Quaternion<T> &from, const Quaternion<T> &to, const T t) noexcept {
+        T cosine = from.Dot(to);
+        const T sign = cosine < T() ? T(-1) : T(1);
+        cosine *= sign;
+        // nearly parallel rotations divide by a vanishing sine
+        if (cosine > T(0.9995)) {
+            return Nlerp(from, to, t);
+        }
+        const T angle = std::acos(cosine);
+        const T s = 1 / std::sin(angle);
+        return from * (std::sin((1 - t) * angle) * s) + to * (sign * std::sin(t * angle) * s);
+    }
+
+    /**
+     * out[i] = Nlerp(from[i], to[i], t[i]) for the first count rotations. out may alias from or to.
+     */
+    template<typename T>
+    void Nlerp(const Quaternion<T> *from, const Quaternion<T> *to, const T *t, Quaternion<T> *out,
+               const size_t count) noexcept {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = Nlerp(from[i], to[i], t[i]);
+        }
+    }
+
+    /**
+     * out[i] = Slerp(from[i], to[i], t[i]) for the first count rotations. out may alias from or to.
+     */
+    template<typename T>
+    void Slerp(const Quaternion<T> *from, const Quaternion<T> *to, const T *t, Quaternion<T> *out,
+               const size_t count) noexcept {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = Slerp(from[i], to[i], t[i]);
+        }
+    }
+
+    // vectorized float overloads, defined in quaternion.cpp. The float Slerp evaluates a series in
+    // place of acos and sin; its weights are within 1e-7 of the exact ones.
+    void Nlerp(const Quaternion<float> *from, const Quaternion<float> *to, const float *t, Quaternion<float> *out,
+               size_t count) noexcept;
+
+    void Slerp(const Quaternion<float> *from, const Quaternion<float> *to, const float *t, Quaternion<float> *out,
+               size_t count) noexcept;
+}
+
+#endif //DRAWING_QUATERNION_H
@@ -5,24 +5,36 @@
 #ifndef DRAWING_RMATRIX_H
 #define DRAWING_RMATRIX_H
 
+#include <memory>
+#include <type_traits>
+
+#include "gemm.h"
 #include "rvector.h"
 
 namespace QS::LinAlg {
 
-    template<int row, int col>
+    /**
+     * \tparam alignment byte alignment of the whole matrix, by default that of T. Rows are never
+     *         padded, so the data stays contiguous; see PaddedRMatrix.
+     */
+    template<int row, int col, typename T = float, size_t alignment = alignof(T)>
     class RMatrix;
 
-    template<int rowlhs, int collhs, int rowrhs, int colrhs>
-    constexpr RMatrix<rowlhs, colrhs> operator*(RMatrix<rowlhs, collhs> lhs, RMatrix<rowrhs, colrhs> rhs);
-
-    template<int row, int col>
+    template<int row, int col, typename T, size_t alignment>
     class RMatrix {
     public:
-        RMatrix() = default;
+        static_assert(alignment >= alignof(T) && (alignment & (alignment - 1)) == 0,
+                      "alignment must be a power of two no smaller than the element alignment");
+
+        using ExpressionShape = Expr::RowMajor<row, col>;
+
+        using value_type = T;
+
+        constexpr RMatrix() = default;
 
         ~RMatrix() = default;
 
-        RMatrix(std::initializer_list<std::initializer_list<float>> list) {
+        constexpr RMatrix(std::initializer_list<std::initializer_list<T>> list) {
             auto list_iter = list.begin();
             auto data_iter = mData.begin();
             for (; list_iter != list.end() && data_iter != mData.end(); ++list_iter, ++data_iter) {
@@ -31,47 +43,73 @@ namespace QS::LinAlg {
         }
 
 
-        RMatrix(const RMatrix &m) noexcept {
+        constexpr RMatrix(const RMatrix &m) noexcept {
             mData = m.mData;
         }
 
-        RMatrix &operator=(const RMatrix &m) noexcept {
+        constexpr RMatrix &operator=(const RMatrix &m) noexcept {
             mData = m.mData;
             return *this;
         }
 
-        RMatrix(const RMatrix &&m) noexcept {
+        constexpr RMatrix(const RMatrix &&m) noexcept {
             mData = std::move(m.mData);
         }
 
-        RMatrix &operator=(const RMatrix &&m) noexcept {
+        constexpr RMatrix &operator=(const RMatrix &&m) noexcept {
             mData = std::move(m.mData);
             return *this;
         }
 
-        constexpr const RVector<col> &operator[](const unsigned long long idx) const noexcept {
+        /**
+         * Evaluates an element-wise expression directly into the new matrix
+         */
+        template<Expr::ExpressionOf<ExpressionShape> E>
+        constexpr RMatrix(const E &expr) {
+            Assign(expr);
+        }
+
+        template<Expr::ExpressionOf<ExpressionShape> E>
+        constexpr RMatrix &operator=(const E &expr) {
+            if (Expr::MayAlias(expr, GetData(), GetData() + row * col)) {
+                // expr reads this matrix in another order, e.g. m = AsRowMajor(Transpose(m))
+                return *this = RMatrix(expr);
+            }
+            Assign(expr);
+            return *this;
+        }
+
+        constexpr const RVector<col, T> &operator[](const unsigned long long idx) const noexcept {
             return mData[idx];
         }
 
-        constexpr RVector<col> &operator[](const unsigned long long idx) {
+        constexpr RVector<col, T> &operator[](const unsigned long long idx) {
             return mData[idx];
         }
 
-        constexpr RMatrix &operator+=(const RMatrix &rhs) noexcept {
-            for (size_t i = 0; i < row; ++i) {
-                for (size_t j = 0; j < col; ++j) {
-                    (*this)[i][j] += rhs[i][j];
-                }
+        [[nodiscard]] constexpr T Eval(const size_t i, const size_t j) const noexcept {
+            return mData[i][j];
+        }
+
+        template<Expr::ExpressionOf<ExpressionShape> E>
+        constexpr RMatrix &operator+=(const E &rhs) noexcept {
+            if (Expr::MayAlias(rhs, GetData(), GetData() + row * col)) {
+                return *this += RMatrix(rhs);
             }
+            Detail::For<row>([&](const size_t i) {
+                Detail::For<col>([&](const size_t j) { (*this)[i][j] += rhs.Eval(i, j); });
+            });
             return *this;
         }
 
-        constexpr RMatrix &operator-=(const RMatrix &rhs) noexcept {
-            for (size_t i = 0; i < row; ++i) {
-                for (size_t j = 0; j < col; ++j) {
-                    (*this)[i][j] -= rhs[i][j];
-                }
+        template<Expr::ExpressionOf<ExpressionShape> E>
+        constexpr RMatrix &operator-=(const E &rhs) noexcept {
+            if (Expr::MayAlias(rhs, GetData(), GetData() + row * col)) {
+                return *this -= RMatrix(rhs);
             }
+            Detail::For<row>([&](const size_t i) {
+                Detail::For<col>([&](const size_t j) { (*this)[i][j] -= rhs.Eval(i, j); });
+            });
             return *this;
         }
 
@@ -82,7 +120,7 @@ namespace QS::LinAlg {
             return *this;
         }
 
-        constexpr RMatrix &MultiplyAddRows(const float scalar, const size_t from, const size_t to) noexcept {
+        constexpr RMatrix &MultiplyAddRows(const T scalar, const size_t from, const size_t to) noexcept {
             for (size_t i = 0; i < col; ++i) {
                 (*this)[to][i] += scalar * (*this)[from][i];
             }
@@ -94,74 +132,83 @@ namespace QS::LinAlg {
             return *this;
         }
 
-        constexpr RMatrix &ScalarMultiplyRow(const size_t r, const float scalar) noexcept {
+        constexpr RMatrix &ScalarMultiplyRow(const size_t r, const T scalar) noexcept {
             for (size_t i = 0; i < col; ++i) {
                 (*this)[r][i] *= scalar;
             }
+            return *this;
         }
 
-    private:
-        std::array<RVector<col>, row> mData;
-    };
-
-    template<int rowlhs, int collhs, int rowrhs, int colrhs>
-    constexpr RMatrix<rowlhs, colrhs> operator*(RMatrix<rowlhs, collhs> rhs, RMatrix<rowrhs, colrhs> lhs) {
-        static_assert(colrhs == rowlhs, "rhs matrix columns != lhs matrix rows");
-
-        RMatrix<rowrhs, collhs> out;
-        for (unsigned long long i = 0l; i < rowlhs; ++i) {
-            for (unsigned long long j = 0l; j < colrhs; ++j) {
-                for (unsigned long long k = 0l; k < rowlhs; ++k) {
-                    out[i][j] += lhs[i][k] * rhs[k][i];
-                }
-            }
+        constexpr T *GetData() noexcept {
+            return std::assume_aligned<alignment>(mData[0].GetData());
         }
-        return out;
-    }
-
-    template<int row, int col>
-    constexpr RMatrix<row, col> operator*(const RMatrix<row, col> &lhs, const float scalar) {
-        RMatrix<row, col> out;
 
-        for (int i = 0; i < row; ++i) {
-            for (int j = 0; j < col; ++j) {
-                out = lhs[i][j] * scalar;
-            }
+        constexpr const T *GetData() const noexcept {
+            return std::assume_aligned<alignment>(mData[0].GetData());
         }
-        return out;
-    }
 
-    template<int row, int col>
-    constexpr RMatrix<row, col> operator*(const float scalar, const RMatrix<row, col> &lhs) {
-        return lhs * scalar;
-    }
+    private:
+        template<class E>
+        constexpr void Assign(const E &expr) {
+            Detail::For<row>([&](const size_t i) {
+                Detail::For<col>([&](const size_t j) { mData[i][j] = expr.Eval(i, j); });
+            });
+        }
 
-    template<int rowlhs, int collhs, int rowrhs, int colrhs>
-    constexpr RMatrix<rowlhs, collhs>
-    operator+(const RMatrix<rowlhs, collhs> &rhs, const RMatrix<rowrhs, colrhs> &lhs) {
-        static_assert(rowrhs == rowlhs && colrhs == collhs, "rhs and lhs matrices have differing dimensions");
+        alignas(alignment) std::array<RVector<col, T>, row> mData;
+    };
 
-        RMatrix<rowrhs, collhs> out;
-        for (unsigned long long i = 0l; i < rowrhs; ++i) {
-            for (unsigned long long j = 0l; j < rowlhs; ++j) {
-                out[i][j] = rhs[i][j] + lhs[i][j];
+    /**
+     * An RMatrix padded to a power of two bytes, at most a cache line, e.g. 64 for RMatrix<4, 4>
+     */
+    template<int row, int col, typename T = float>
+    using PaddedRMatrix = RMatrix<row, col, T, PaddedAlignment<T, row * col>()>;
+
+    /**
+     * Matrix product with sums accumulated in Acc, e.g. Multiply<double>(a, b) on float matrices.
+     * The result holds the common element type of the operands. Stored matrices and views are read
+     * in place; other expressions are evaluated once before multiplying.
+     */
+    template<typename Acc, class L, class R> requires Expr::RowMajorExpression<L> && Expr::RowMajorExpression<R>
+    [[nodiscard]] constexpr auto Multiply(const L &lhs, const R &rhs) {
+        constexpr int rowlhs = Expr::ShapeOf<L>::rows;
+        constexpr int collhs = Expr::ShapeOf<L>::cols;
+        constexpr int rowrhs = Expr::ShapeOf<R>::rows;
+        constexpr int colrhs = Expr::ShapeOf<R>::cols;
+        static_assert(collhs == rowrhs, "lhs matrix columns != rhs matrix rows");
+        using T = std::common_type_t<Expr::ValueOf<L>, Expr::ValueOf<R>>;
+
+        if constexpr (!Expr::Addressable<L>) {
+            return Multiply<Acc>(RMatrix<rowlhs, collhs, Expr::ValueOf<L>>(lhs), rhs);
+        } else if constexpr (!Expr::Addressable<R>) {
+            return Multiply<Acc>(lhs, RMatrix<rowrhs, colrhs, Expr::ValueOf<R>>(rhs));
+        } else {
+            RMatrix<rowlhs, colrhs, T> out;
+#ifdef QS_LINALG_SSE
+            if constexpr (rowlhs == 4 && collhs == 4 && colrhs == 4 && std::is_same_v<Expr::ValueOf<L>, float> &&
+                          std::is_same_v<Expr::ValueOf<R>, float> && std::is_same_v<Acc, float> &&
+                          Expr::Dense<L> && Expr::Dense<R>) {
+                if (!std::is_constant_evaluated()) {
+                    // row major data of a matrix is the column major data of its transpose: (AB)^T = B^T A^T
+                    Gemm::Multiply4x4(rhs.GetData(), lhs.GetData(), out.GetData());
+                    return out;
+                }
             }
+#endif
+            Gemm::Multiply<Acc, rowlhs, colrhs, collhs>([&lhs](size_t i, size_t j) { return lhs.Eval(i, j); },
+                                                        [&rhs](size_t i, size_t j) { return rhs.Eval(i, j); },
+                                                        [&out](size_t i, size_t j) -> T & { return out[i][j]; });
+            return out;
         }
-        return out;
     }
 
-    template<int rowlhs, int collhs, int rowrhs, int colrhs>
-    constexpr RMatrix<rowlhs, collhs>
-    operator-(const RMatrix<rowlhs, collhs> &rhs, const RMatrix<rowrhs, colrhs> &lhs) {
-        static_assert(rowrhs == rowlhs && colrhs == collhs, "rhs and lhs matrices have differing dimensions");
-
-        RMatrix<rowrhs, collhs> out;
-        for (unsigned long long i = 0l; i < rowrhs; ++i) {
-            for (unsigned long long j = 0l; j < rowlhs; ++j) {
-                out[i][j] = rhs[i][j] - lhs[i][j];
-            }
-        }
-        return out;
+    /**
+     * Matrix product, accumulated in the Expr::Accumulator of the element type
+     */
+    template<class L, class R> requires Expr::RowMajorExpression<L> && Expr::RowMajorExpression<R>
+    [[nodiscard]] constexpr auto operator*(const L &lhs, const R &rhs) {
+        using T = std::common_type_t<Expr::ValueOf<L>, Expr::ValueOf<R>>;
+        return Multiply<Expr::AccumulatorOf<T>>(lhs, rhs);
     }
 }
 
@@ -7,35 +7,36 @@
 
 #include <algorithm>
 #include <array>
+#include <memory>
+
+#include "aligned_buffer.h"
+#include "expression.h"
+#include "simd.h"
 
 namespace QS::LinAlg {
 
-    template<int length, typename T = float>
+    /**
+     * \tparam alignment byte alignment of the vector, by default that of T. A larger power of two
+     *         also pads the size to a multiple of it, see PaddedAlignment and PaddedRVector.
+     */
+    template<int length, typename T = float, size_t alignment = alignof(T)>
     class RVector;
 
-    template<int length, typename T>
-    constexpr RVector<length, T> operator+(const RVector<length, T> &lhs, const RVector<length, T> &rhs) noexcept;
-
-    template<int length, typename T>
-    constexpr RVector<length, T> operator-(const RVector<length, T> &lhs, const RVector<length, T> &rhs) noexcept;
-
-    template<int length, typename T>
-    constexpr T operator*(const RVector<length, T> &lhs, const RVector<length, T> &rhs) noexcept;
+    template<int length, typename T, size_t alignment>
+    class RVector {
+    public:
+        static_assert(alignment >= alignof(T) && (alignment & (alignment - 1)) == 0,
+                      "alignment must be a power of two no smaller than the element alignment");
 
-    template<int length, typename T>
-    constexpr RVector<length, T> operator*(const RVector<length, T> &lhs, const T scalar);
+        using ExpressionShape = Expr::RowVector<length>;
 
-    template<int length, typename T>
-    constexpr RVector<length, T> operator*(const T scalar, const RVector<length, T> &rhs);
+        using value_type = T;
 
-    template<int length, typename T>
-    class RVector {
-    public:
         /**
          * Produces an identity vector
          */
         constexpr RVector(void) {
-            for (auto &i: mData) { i = T(); }
+            Detail::For<length>([&](const size_t i) { mData[i] = T(); });
         }
 
         constexpr RVector(const RVector &vec) {
@@ -58,7 +59,7 @@ namespace QS::LinAlg {
                 *data_iter = *list_iter;
             }
             for (; data_iter != mData.end(); ++data_iter) {
-                *data_iter = 0.0f;
+                *data_iter = T();
             }
         }
 
@@ -67,6 +68,24 @@ namespace QS::LinAlg {
             return *this;
         }
 
+        /**
+         * Evaluates an expression such as a + b * s directly into the new vector
+         */
+        template<Expr::ExpressionOf<ExpressionShape> E>
+        constexpr RVector(const E &expr) {
+            Expr::Evaluate<length>(expr, mData.data());
+        }
+
+        template<Expr::ExpressionOf<ExpressionShape> E>
+        constexpr RVector &operator=(const E &expr) {
+            if (Expr::MayAlias(expr, GetData(), GetData() + length)) {
+                // expr reads this vector through a view of other elements
+                return *this = RVector(expr);
+            }
+            Expr::Evaluate<length>(expr, mData.data());
+            return *this;
+        }
+
         [[nodiscard]] size_t GetSize() const noexcept { return length; }
 
         [[nodiscard]] constexpr T &operator[](const size_t idx) noexcept {
@@ -77,83 +96,57 @@ namespace QS::LinAlg {
             return mData[idx];
         }
 
+        [[nodiscard]] constexpr const T &Eval(const size_t idx) const noexcept {
+            return mData[idx];
+        }
+
         constexpr RVector &operator+=(const RVector &rhs) noexcept {
-            for (unsigned long long i = 0; i < length; ++i) {
-                (*this)[i] += rhs[i];
-            }
+            Simd::Add<length>(GetData(), rhs.GetData(), GetData());
             return *this;
         }
 
         constexpr RVector &operator-=(const RVector &rhs) noexcept {
-            for (size_t i = 0; i < length; ++i) {
-                (*this)[i] -= rhs[i];
+            Simd::Sub<length>(GetData(), rhs.GetData(), GetData());
+            return *this;
+        }
+
+        template<Expr::ExpressionOf<ExpressionShape> E>
+        constexpr RVector &operator+=(const E &rhs) noexcept {
+            if (Expr::MayAlias(rhs, GetData(), GetData() + length)) {
+                return *this += RVector(rhs);
+            }
+            Detail::For<length>([&](const size_t i) { mData[i] += rhs.Eval(i); });
+            return *this;
+        }
+
+        template<Expr::ExpressionOf<ExpressionShape> E>
+        constexpr RVector &operator-=(const E &rhs) noexcept {
+            if (Expr::MayAlias(rhs, GetData(), GetData() + length)) {
+                return *this -= RVector(rhs);
             }
+            Detail::For<length>([&](const size_t i) { mData[i] -= rhs.Eval(i); });
             return *this;
         }
 
         [[nodiscard]] constexpr T *GetData() noexcept {
-            return mData.data();
+            return std::assume_aligned<alignment>(mData.data());
         }
 
         [[nodiscard]] constexpr const T *GetData() const noexcept {
-            return mData.data();
+            return std::assume_aligned<alignment>(mData.data());
         }
 
-        friend constexpr RVector<length, T> operator+<>(const RVector<length, T> &lhs, const RVector<length, T> &rhs) noexcept;
-
-        friend constexpr RVector<length, T> operator-<>(const RVector<length, T> &lhs, const RVector<length, T> &rhs) noexcept;
-
-        friend constexpr RVector<length, T> operator*<>(const RVector<length, T> &lhs, const T scalar);
-
-        friend constexpr RVector<length, T> operator*<>(const T scalar, const RVector<length, T> &rhs);
-
-        friend constexpr T operator*<length>(const RVector<length, T> &lhs, const RVector<length, T> &rhs) noexcept;
-
     private:
         /// the vector data
-        std::array<T, length> mData;
+        alignas(alignment) std::array<T, length> mData;
     };
 
-    template<int length, typename T>
-    [[nodiscard]] constexpr RVector<length, T> operator+(const RVector<length, T> &lhs, const RVector<length, T> &rhs) noexcept {
-        RVector<length, T> out;
-        for (int i = 0; i < length; ++i) {
-            out[i] = lhs[i] + rhs[i];
-        }
-        return out;
-    }
-
-    template<int length, typename T>
-    [[nodiscard]] constexpr RVector<length, T> operator-(const RVector<length, T> &lhs, const RVector<length, T> &rhs) noexcept {
-        RVector<length, T> out;
-        for (int i = 0; i < length; ++i) {
-            out[i] = lhs[i] - rhs[i];
-        }
-        return out;
-    }
-
-    template<int length, typename T>
-    [[nodiscard]] constexpr T operator*(const RVector<length, T> &lhs, const RVector<length, T> &rhs) noexcept {
-        T out = T();
-        for (int i = 0; i < length; ++i) {
-            out += lhs[i] * rhs[i];
-        }
-        return out;
-    }
-
-    template<int length, typename T>
-    [[nodiscard]] constexpr RVector<length, T> operator*(const RVector<length, T> &lhs, const T scalar) {
-        RVector<length, T> out;
-        for (int i = 0; i < length; ++i) {
-            out[i] = lhs[i] * scalar;
-        }
-        return out;
-    }
-
-    template<int length, typename T>
-    [[nodiscard]] constexpr RVector<length, T> operator*(const T scalar, const RVector<length, T> &rhs) {
-        return rhs * scalar;
-    }
+    /**
+     * An RVector padded to a power of two bytes, e.g. 16 for RVector<3>: arrays of them never split
+     * a vector across cache lines and every vector starts on an aligned SIMD boundary
+     */
+    template<int length, typename T = float>
+    using PaddedRVector = RVector<length, T, PaddedAlignment<T, length>()>;
 }
 
 
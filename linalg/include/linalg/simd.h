@@ -0,0 +1,510 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_SIMD_H
+#define DRAWING_SIMD_H
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include "unroll.h"
+
+#if !defined(QS_LINALG_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+#define QS_LINALG_SSE 1
+#include <immintrin.h>
+#if defined(__AVX__)
+#define QS_LINALG_AVX 1
+#endif
+#if defined(__AVX2__)
+#define QS_LINALG_AVX2 1
+#endif
+#if defined(__F16C__)
+#define QS_LINALG_F16C 1
+#endif
+#endif
+
+/**
+ * Fixed length element kernels used by the vector types.
+ *
+ * Kernel<T, length> is specialized with x86 intrinsics for the common float lengths (2, 3, 4, 8 and
+ * 16). Every other combination falls back to the Scalar kernels, which are also used during
+ * constant evaluation and are unrolled into straight-line code up to Detail::kUnrollLimit elements.
+ * Define QS_LINALG_NO_SIMD to force the scalar kernels everywhere.
+ */
+namespace QS::LinAlg::Simd {
+
+    /// independent partial sums the runtime length reductions keep, so each addition need not wait
+    /// for the one before it
+    inline constexpr size_t kAccumulators = 4;
+    static_assert(kAccumulators == 4, "the reductions add up exactly four partial sums");
+
+    namespace Scalar {
+        template<int length, typename T>
+        constexpr void Add(const T *lhs, const T *rhs, T *out) noexcept {
+            LinAlg::Detail::For<length>([&](const size_t i) { out[i] = lhs[i] + rhs[i]; });
+        }
+
+        template<int length, typename T>
+        constexpr void Sub(const T *lhs, const T *rhs, T *out) noexcept {
+            LinAlg::Detail::For<length>([&](const size_t i) { out[i] = lhs[i] - rhs[i]; });
+        }
+
+        template<int length, typename T>
+        constexpr void Scale(const T *lhs, const T scalar, T *out) noexcept {
+            LinAlg::Detail::For<length>([&](const size_t i) { out[i] = lhs[i] * scalar; });
+        }
+
+        template<int length, typename T>
+        constexpr T Dot(const T *lhs, const T *rhs) noexcept {
+            T out = T();
+            LinAlg::Detail::For<length>([&](const size_t i) { out += lhs[i] * rhs[i]; });
+            return out;
+        }
+    }
+
+    /**
+     * Vectorized kernel for a vector of length elements of type T. enabled is false when no
+     * specialization exists.
+     */
+    template<typename T, int length>
+    struct Kernel {
+        static constexpr bool enabled = false;
+    };
+
+#ifdef QS_LINALG_SSE
+    namespace Detail {
+        /**
+         * A register holding width floats. Unused lanes are zero so horizontal sums stay correct.
+         */
+        template<int width>
+        struct Pack;
+
+        template<>
+        struct Pack<2> {
+            using Register = __m128;
+
+            // The pair moves as one 64 bit lane through __m64, which is declared
+            // may_alias; going through double * breaks strict aliasing at -O2.
+            static Register Load(const float *p) noexcept {
+                return _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64 *>(p));
+            }
+
+            static void Store(float *p, Register v) noexcept {
+                _mm_storel_pi(reinterpret_cast<__m64 *>(p), v);
+            }
+
+            static Register Broadcast(float s) noexcept { return _mm_set1_ps(s); }
+        };
+
+        template<>
+        struct Pack<3> {
+            using Register = __m128;
+
+            static Register Load(const float *p) noexcept {
+                return _mm_movelh_ps(Pack<2>::Load(p), _mm_load_ss(p + 2));
+            }
+
+            static void Store(float *p, Register v) noexcept {
+                Pack<2>::Store(p, v);
+                _mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+            }
+
+            static Register Broadcast(float s) noexcept { return _mm_set1_ps(s); }
+        };
+
+        template<>
+        struct Pack<4> {
+            using Register = __m128;
+
+            static Register Load(const float *p) noexcept { return _mm_loadu_ps(p); }
+
+            static void Store(float *p, Register v) noexcept { _mm_storeu_ps(p, v); }
+
+            static Register Broadcast(float s) noexcept { return _mm_set1_ps(s); }
+        };
+
+        inline __m128 Add(__m128 a, __m128 b) noexcept { return _mm_add_ps(a, b); }
+
+        inline __m128 Sub(__m128 a, __m128 b) noexcept { return _mm_sub_ps(a, b); }
+
+        inline __m128 Mul(__m128 a, __m128 b) noexcept { return _mm_mul_ps(a, b); }
+
+        inline __m128 Div(__m128 a, __m128 b) noexcept { return _mm_div_ps(a, b); }
+
+        inline __m128 Sqrt(__m128 a) noexcept { return _mm_sqrt_ps(a); }
+
+        inline float HorizontalSum(__m128 v) noexcept {
+            __m128 shuf = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+            __m128 sums = _mm_add_ps(v, shuf);
+            shuf = _mm_movehl_ps(shuf, sums);
+            sums = _mm_add_ss(sums, shuf);
+            return _mm_cvtss_f32(sums);
+        }
+
+#ifdef QS_LINALG_AVX
+        template<>
+        struct Pack<8> {
+            using Register = __m256;
+
+            static Register Load(const float *p) noexcept { return _mm256_loadu_ps(p); }
+
+            static void Store(float *p, Register v) noexcept { _mm256_storeu_ps(p, v); }
+
+            static Register Broadcast(float s) noexcept { return _mm256_set1_ps(s); }
+        };
+
+        inline __m256 Add(__m256 a, __m256 b) noexcept { return _mm256_add_ps(a, b); }
+
+        inline __m256 Sub(__m256 a, __m256 b) noexcept { return _mm256_sub_ps(a, b); }
+
+        inline __m256 Mul(__m256 a, __m256 b) noexcept { return _mm256_mul_ps(a, b); }
+
+        inline __m256 Div(__m256 a, __m256 b) noexcept { return _mm256_div_ps(a, b); }
+
+        inline __m256 Sqrt(__m256 a) noexcept { return _mm256_sqrt_ps(a); }
+
+        inline float HorizontalSum(__m256 v) noexcept {
+            return HorizontalSum(_mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1)));
+        }
+
+        constexpr int kWideWidth = 8;
+#else
+        constexpr int kWideWidth = 4;
+#endif
+
+        /**
+         * Register width used to walk a vector of the given length
+         */
+        template<int length>
+        constexpr int Width() noexcept {
+            if (length < 4) {
+                return length;
+            }
+            return length % kWideWidth == 0 ? kWideWidth : 4;
+        }
+    }
+
+    template<int length> requires (length == 2 || length == 3 || length == 4 || length == 8 || length == 16)
+    struct Kernel<float, length> {
+        static constexpr bool enabled = true;
+
+        using Pack = Detail::Pack<Detail::Width<length>()>;
+
+        static constexpr int width = Detail::Width<length>();
+
+        static void Add(const float *lhs, const float *rhs, float *out) noexcept {
+            for (int i = 0; i < length; i += width) {
+                Pack::Store(out + i, Detail::Add(Pack::Load(lhs + i), Pack::Load(rhs + i)));
+            }
+        }
+
+        static void Sub(const float *lhs, const float *rhs, float *out) noexcept {
+            for (int i = 0; i < length; i += width) {
+                Pack::Store(out + i, Detail::Sub(Pack::Load(lhs + i), Pack::Load(rhs + i)));
+            }
+        }
+
+        static void Scale(const float *lhs, const float scalar, float *out) noexcept {
+            const typename Pack::Register s = Pack::Broadcast(scalar);
+            for (int i = 0; i < length; i += width) {
+                Pack::Store(out + i, Detail::Mul(Pack::Load(lhs + i), s));
+            }
+        }
+
+        static float Dot(const float *lhs, const float *rhs) noexcept {
+            typename Pack::Register acc = Detail::Mul(Pack::Load(lhs), Pack::Load(rhs));
+            for (int i = width; i < length; i += width) {
+                acc = Detail::Add(acc, Detail::Mul(Pack::Load(lhs + i), Pack::Load(rhs + i)));
+            }
+            return Detail::HorizontalSum(acc);
+        }
+    };
+#endif
+
+    /**
+     * out = lhs + rhs, dispatching to the vectorized kernel outside of constant evaluation
+     */
+    template<int length, typename T>
+    constexpr void Add(const T *lhs, const T *rhs, T *out) noexcept {
+        if constexpr (Kernel<T, length>::enabled) {
+            if (!std::is_constant_evaluated()) {
+                Kernel<T, length>::Add(lhs, rhs, out);
+                return;
+            }
+        }
+        Scalar::Add<length>(lhs, rhs, out);
+    }
+
+    /**
+     * out = lhs - rhs
+     */
+    template<int length, typename T>
+    constexpr void Sub(const T *lhs, const T *rhs, T *out) noexcept {
+        if constexpr (Kernel<T, length>::enabled) {
+            if (!std::is_constant_evaluated()) {
+                Kernel<T, length>::Sub(lhs, rhs, out);
+                return;
+            }
+        }
+        Scalar::Sub<length>(lhs, rhs, out);
+    }
+
+    /**
+     * out = lhs * scalar
+     */
+    template<int length, typename T>
+    constexpr void Scale(const T *lhs, const T scalar, T *out) noexcept {
+        if constexpr (Kernel<T, length>::enabled) {
+            if (!std::is_constant_evaluated()) {
+                Kernel<T, length>::Scale(lhs, scalar, out);
+                return;
+            }
+        }
+        Scalar::Scale<length>(lhs, scalar, out);
+    }
+
+    /**
+     * sum of lhs[i] * rhs[i]
+     */
+    template<int length, typename T>
+    constexpr T Dot(const T *lhs, const T *rhs) noexcept {
+        if constexpr (Kernel<T, length>::enabled) {
+            if (!std::is_constant_evaluated()) {
+                return Kernel<T, length>::Dot(lhs, rhs);
+            }
+        }
+        return Scalar::Dot<length>(lhs, rhs);
+    }
+
+    /**
+     * out[i] = lhs[i] + rhs[i] for the first n elements. out may alias lhs or rhs.
+     */
+    template<typename T>
+    void Add(const T *lhs, const T *rhs, T *out, const size_t n) noexcept {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = lhs[i] + rhs[i];
+        }
+    }
+
+    /**
+     * out[i] = lhs[i] - rhs[i] for the first n elements. out may alias lhs or rhs.
+     */
+    template<typename T>
+    void Sub(const T *lhs, const T *rhs, T *out, const size_t n) noexcept {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = lhs[i] - rhs[i];
+        }
+    }
+
+    /**
+     * out[i] = lhs[i] * scalar for the first n elements. out may alias lhs.
+     */
+    template<typename T>
+    void Scale(const T *lhs, const T scalar, T *out, const size_t n) noexcept {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = lhs[i] * scalar;
+        }
+    }
+
+    /**
+     * out[i] = lhs[i] * rhs[i] for the first n elements. out may alias lhs or rhs.
+     */
+    template<typename T>
+    void Mul(const T *lhs, const T *rhs, T *out, const size_t n) noexcept {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = lhs[i] * rhs[i];
+        }
+    }
+
+    /**
+     * out[i] = lhs[i] / rhs[i] for the first n elements. out may alias lhs or rhs.
+     */
+    template<typename T>
+    void Div(const T *lhs, const T *rhs, T *out, const size_t n) noexcept {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = lhs[i] / rhs[i];
+        }
+    }
+
+    /**
+     * out[i] += lhs[i] * rhs[i] for the first n elements
+     */
+    template<typename T>
+    void MulAdd(const T *lhs, const T *rhs, T *out, const size_t n) noexcept {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] += lhs[i] * rhs[i];
+        }
+    }
+
+    /**
+     * out[i] = sqrt(in[i]) for the first n elements. out may alias in.
+     */
+    template<typename T>
+    void Sqrt(const T *in, T *out, const size_t n) noexcept {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = std::sqrt(in[i]);
+        }
+    }
+
+    /**
+     * y[i] += alpha * x[i] for the first n elements
+     */
+    template<typename T>
+    void Axpy(const T alpha, const T *x, T *y, const size_t n) noexcept {
+        for (size_t i = 0; i < n; ++i) {
+            y[i] += alpha * x[i];
+        }
+    }
+
+    /**
+     * y[i] = alpha * x[i] + beta * y[i] for the first n elements. A beta of zero does not read y.
+     */
+    template<typename T>
+    void Axpby(const T alpha, const T *x, const T beta, T *y, const size_t n) noexcept {
+        if (beta == T()) {
+            for (size_t i = 0; i < n; ++i) {
+                y[i] = alpha * x[i];
+            }
+            return;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            y[i] = alpha * x[i] + beta * y[i];
+        }
+    }
+
+    /**
+     * sum of lhs[i] * rhs[i] over the first n elements, kept in kAccumulators partial sums
+     */
+    template<typename T>
+    T Dot(const T *lhs, const T *rhs, const size_t n) noexcept {
+        T acc[kAccumulators] = {};
+        // the tail loop counts n % kAccumulators so its bound is visible to the optimizer, which
+        // otherwise warns about impossible trip counts once n is known to be small
+        const size_t body = n - n % kAccumulators;
+        for (size_t i = 0; i < body; i += kAccumulators) {
+            for (size_t k = 0; k < kAccumulators; ++k) {
+                acc[k] += lhs[i + k] * rhs[i + k];
+            }
+        }
+        for (size_t k = 0; k < n % kAccumulators; ++k) {
+            acc[0] += lhs[body + k] * rhs[body + k];
+        }
+        return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+    }
+
+    /**
+     * sum of in[i] over the first n elements, kept in kAccumulators partial sums
+     */
+    template<typename T>
+    T Sum(const T *in, const size_t n) noexcept {
+        T acc[kAccumulators] = {};
+        // tail bounded as in Dot
+        const size_t body = n - n % kAccumulators;
+        for (size_t i = 0; i < body; i += kAccumulators) {
+            for (size_t k = 0; k < kAccumulators; ++k) {
+                acc[k] += in[i + k];
+            }
+        }
+        for (size_t k = 0; k < n % kAccumulators; ++k) {
+            acc[0] += in[body + k];
+        }
+        return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+    }
+
+    /**
+     * Running sum that also keeps the rounding error of every addition, found exactly with TwoSum,
+     * and does the same for the sum of those errors (Kahan-Babuska summation of second order). The
+     * result is accurate to about one rounding however many terms there are and whatever their sizes.
+     */
+    template<typename T>
+    class CompensatedSum {
+    public:
+        constexpr void Add(const T term) noexcept {
+            mSecondOrder += TwoSum(mCompensation, TwoSum(mSum, term));
+        }
+
+        [[nodiscard]] constexpr T Get() const noexcept {
+            return mSum + (mCompensation + mSecondOrder);
+        }
+
+        /**
+         * total += term, returning the part of term lost to rounding
+         */
+        static constexpr T TwoSum(T &total, const T term) noexcept {
+            const T next = total + term;
+            const T added = next - total;
+            const T error = (total - (next - added)) + (term - added);
+            total = next;
+            return error;
+        }
+
+    private:
+        T mSum = T();
+        T mCompensation = T();
+        T mSecondOrder = T();
+    };
+
+    /**
+     * Dot with compensated summation. The products themselves are still rounded once each.
+     */
+    template<typename T>
+    T KahanDot(const T *lhs, const T *rhs, const size_t n) noexcept {
+        CompensatedSum<T> out;
+        for (size_t i = 0; i < n; ++i) {
+            out.Add(lhs[i] * rhs[i]);
+        }
+        return out.Get();
+    }
+
+    /**
+     * Sum with compensated summation
+     */
+    template<typename T>
+    T KahanSum(const T *in, const size_t n) noexcept {
+        CompensatedSum<T> out;
+        for (size_t i = 0; i < n; ++i) {
+            out.Add(in[i]);
+        }
+        return out.Get();
+    }
+
+    // vectorized float overloads, defined in simd.cpp. Axpy, Dot, Sum and Gemm pick their instruction
+    // set at run time, see dispatch.h
+    void Add(const float *lhs, const float *rhs, float *out, size_t n) noexcept;
+
+    void Sub(const float *lhs, const float *rhs, float *out, size_t n) noexcept;
+
+    void Scale(const float *lhs, float scalar, float *out, size_t n) noexcept;
+
+    void Mul(const float *lhs, const float *rhs, float *out, size_t n) noexcept;
+
+    void Div(const float *lhs, const float *rhs, float *out, size_t n) noexcept;
+
+    void MulAdd(const float *lhs, const float *rhs, float *out, size_t n) noexcept;
+
+    void Sqrt(const float *in, float *out, size_t n) noexcept;
+
+    void Axpy(float alpha, const float *x, float *y, size_t n) noexcept;
+
+    void Axpby(float alpha, const float *x, float beta, float *y, size_t n) noexcept;
+
+    float Dot(const float *lhs, const float *rhs, size_t n) noexcept;
+
+    float Sum(const float *in, size_t n) noexcept;
+
+    /**
+     * c = alpha * a b + beta * c for an m x k a and a k x n b, with element (i, j) of each matrix x at
+     * x[i * xrs + j * xcs]. A beta of zero does not read c. Blocked like Gemm::Multiply, with the
+     * blocks packed into thread local buffers for the micro kernel of the current tier.
+     */
+    void Gemm(size_t m, size_t n, size_t k, float alpha, const float *a, size_t ars, size_t acs, const float *b,
+              size_t brs, size_t bcs, float beta, float *c, size_t crs, size_t ccs);
+
+    float KahanDot(const float *lhs, const float *rhs, size_t n) noexcept;
+
+    float KahanSum(const float *in, size_t n) noexcept;
+}
+
+#endif //DRAWING_SIMD_H
@@ -0,0 +1,476 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_SPARSE_H
+#define DRAWING_SPARSE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "dmatrix.h"
+#include "dvector.h"
+#include "expression.h"
+#include "parallel.h"
+#include "simd.h"
+#include "thread_pool.h"
+
+namespace QS::LinAlg {
+
+    /**
+     * One entry of a matrix being assembled, see SparseMatrix::FromTriplets
+     */
+    template<typename T = float>
+    struct Triplet {
+        size_t row;
+        size_t col;
+        T value;
+    };
+
+    namespace Detail {
+        /**
+         * sum of values[k] * x[indices[k]] for k in [0, count)
+         */
+        template<typename T>
+        T SparseDot(const T *values, const uint32_t *indices, const size_t count, const T *x) noexcept {
+            T out = T();
+            for (size_t k = 0; k < count; ++k) {
+                out += values[k] * x[indices[k]];
+            }
+            return out;
+        }
+
+        // vectorized, with gathers from AVX2 on, for the tier picked at run time; defined in sparse.cpp
+        float SparseDot(const float *values, const uint32_t *indices, size_t count, const float *x) noexcept;
+
+        /**
+         * Splits the outer slices of a compressed matrix into at most parts ranges holding about the
+         * same number of nonzeros. Range p is [bounds[p], bounds[p + 1]).
+         */
+        inline std::vector<size_t> BalanceNonZeros(const std::vector<size_t> &offsets, const size_t parts) {
+            const size_t outer = offsets.size() - 1;
+            const size_t nonZeros = offsets.back();
+            std::vector<size_t> bounds{0};
+            for (size_t p = 1; p < parts; ++p) {
+                const size_t target = nonZeros / parts * p;
+                const size_t bound = std::upper_bound(offsets.begin(), offsets.end(), target) - offsets.begin() - 1;
+                if (bound > bounds.back() && bound < outer) {
+                    bounds.push_back(bound);
+                }
+            }
+            bounds.push_back(outer);
+            return bounds;
+        }
+    }
+
+    /**
+     * Sparse matrix in compressed form: compressed sparse row (CSR) when layout is RowMajor and
+     * compressed sparse column (CSC) when it is ColumnMajor.
+     *
+     * The matrix is a list of outer slices, rows for CSR and columns for CSC. Slice s holds the
+     * nonzeros at positions [GetOffsets()[s], GetOffsets()[s + 1]) of GetIndices(), the inner
+     * coordinate sorted ascending, and GetValues(). Inner coordinates are 32 bit and the AVX2 gather
+     * reads them as signed, so the inner dimension, columns for CSR and rows for CSC, is at most
+     * kMaxInner; larger matrices throw std::invalid_argument.
+     *
+     * SparseMatrix is move-only; use Clone() for an explicit copy. Products with operands of
+     * mismatched dimensions throw std::invalid_argument.
+     */
+    template<typename T = float, Layout layout = Layout::RowMajor>
+    class SparseMatrix {
+    public:
+        using value_type = T;
+
+        /// outer slices with fewer nonzeros run serially in Multiply and TransposeMultiply
+        static constexpr size_t kMinParallelNonZeros = Parallel::kGrainSize;
+
+        /// largest inner dimension, one past the largest inner coordinate a signed 32 bit gather reaches
+        static constexpr size_t kMaxInner = size_t{1} << 31;
+
+        SparseMatrix() : mOffsets(1, 0) {}
+
+        /**
+         * Produces a rows x cols matrix with no nonzeros
+         */
+        SparseMatrix(const size_t rows, const size_t cols) : mRows{rows}, mCols{cols}, mOffsets(GetOuter() + 1, 0) {
+            CheckInner();
+        }
+
+        /**
+         * Keeps the nonzero elements of a dense matrix
+         */
+        template<Layout other>
+        explicit SparseMatrix(const DMatrix<T, other> &dense) : SparseMatrix(dense.GetRows(), dense.GetCols()) {
+            for (size_t o = 0; o < GetOuter(); ++o) {
+                for (size_t i = 0; i < GetInner(); ++i) {
+                    const T value = layout == Layout::RowMajor ? dense(o, i) : dense(i, o);
+                    if (value != T()) {
+                        mIndices.push_back(static_cast<uint32_t>(i));
+                        mValues.push_back(value);
+                    }
+                }
+                mOffsets[o + 1] = mValues.size();
+            }
+        }
+
+        /**
+         * Keeps the nonzero elements of a fixed size matrix or matrix expression
+         */
+        template<class E> requires Expr::MatrixExpression<E>
+        explicit SparseMatrix(const E &expr) : SparseMatrix(DMatrix<T, layout>(expr)) {}
+
+        /**
+         * Assembles a matrix from (row, col, value) entries in any order. Entries at the same
+         * position are summed, as when adding up element contributions in a finite element mesh.
+         * Throws std::invalid_argument when an entry lies outside the matrix.
+         */
+        [[nodiscard]] static SparseMatrix FromTriplets(const size_t rows, const size_t cols,
+                                                       const std::vector<Triplet<T>> &triplets) {
+            SparseMatrix out(rows, cols);
+            // counting sort on the outer coordinate
+            for (const Triplet<T> &t: triplets) {
+                if (t.row >= rows || t.col >= cols) {
+                    throw std::invalid_argument("triplet lies outside the matrix");
+                }
+                ++out.mOffsets[Outer(t) + 1];
+            }
+            for (size_t o = 0; o < out.GetOuter(); ++o) {
+                out.mOffsets[o + 1] += out.mOffsets[o];
+            }
+            std::vector<size_t> next(out.mOffsets.begin(), out.mOffsets.end() - 1);
+            std::vector<std::pair<uint32_t, T>> entries(triplets.size());
+            for (const Triplet<T> &t: triplets) {
+                entries[next[Outer(t)]++] = { static_cast<uint32_t>(Inner(t)), t.value };
+            }
+
+            // sort every slice on the inner coordinate and merge duplicates
+            out.mIndices.reserve(entries.size());
+            out.mValues.reserve(entries.size());
+            size_t begin = 0;
+            for (size_t o = 0; o < out.GetOuter(); ++o) {
+                const size_t end = out.mOffsets[o + 1];
+                std::sort(entries.begin() + begin, entries.begin() + end,
+                          [](const auto &a, const auto &b) { return a.first < b.first; });
+                for (size_t k = begin; k < end; ++k) {
+                    if (k > begin && entries[k].first == out.mIndices.back()) {
+                        out.mValues.back() += entries[k].second;
+                    } else {
+                        out.mIndices.push_back(entries[k].first);
+                        out.mValues.push_back(entries[k].second);
+                    }
+                }
+                begin = end;
+                out.mOffsets[o + 1] = out.mValues.size();
+            }
+            return out;
+        }
+
+        SparseMatrix(const SparseMatrix &) = delete;
+
+        SparseMatrix &operator=(const SparseMatrix &) = delete;
+
+        SparseMatrix(SparseMatrix &&) noexcept = default;
+
+        SparseMatrix &operator=(SparseMatrix &&) noexcept = default;
+
+        [[nodiscard]] SparseMatrix Clone() const {
+            SparseMatrix out;
+            out.mRows = mRows;
+            out.mCols = mCols;
+            out.mOffsets = mOffsets;
+            out.mIndices = mIndices;
+            out.mValues = mValues;
+            return out;
+        }
+
+        [[nodiscard]] static constexpr Layout GetLayout() noexcept { return layout; }
+
+        [[nodiscard]] size_t GetRows() const noexcept { return mRows; }
+
+        [[nodiscard]] size_t GetCols() const noexcept { return mCols; }
+
+        /// number of stored elements
+        [[nodiscard]] size_t GetNonZeroCount() const noexcept { return mValues.size(); }
+
+        /// number of outer slices, rows for CSR and columns for CSC
+        [[nodiscard]] size_t GetOuter() const noexcept { return layout == Layout::RowMajor ? mRows : mCols; }
+
+        /// length of each outer slice
+        [[nodiscard]] size_t GetInner() const noexcept { return layout == Layout::RowMajor ? mCols : mRows; }
+
+        [[nodiscard]] const size_t *GetOffsets() const noexcept { return mOffsets.data(); }
+
+        [[nodiscard]] const uint32_t *GetIndices() const noexcept { return mIndices.data(); }
+
+        [[nodiscard]] const T *GetValues() const noexcept { return mValues.data(); }
+
+        /**
+         * Stored values, which may be changed in place without changing the sparsity pattern
+         */
+        [[nodiscard]] T *GetValues() noexcept { return mValues.data(); }
+
+        /**
+         * Element at row r and column c, zero when it is not stored. Binary searches the slice.
+         */
+        [[nodiscard]] T operator()(const size_t r, const size_t c) const noexcept {
+            const size_t o = layout == Layout::RowMajor ? r : c;
+            const auto i = static_cast<uint32_t>(layout == Layout::RowMajor ? c : r);
+            const uint32_t *begin = mIndices.data() + mOffsets[o];
+            const uint32_t *end = mIndices.data() + mOffsets[o + 1];
+            const uint32_t *found = std::lower_bound(begin, end, i);
+            return found != end && *found == i ? mValues[found - mIndices.data()] : T();
+        }
+
+        /**
+         * The transpose, which has the same arrays in the other layout: the CSR form of A is the CSC
+         * form of A^T. The arrays are copied; transposing an rvalue moves them instead.
+         */
+        [[nodiscard]] auto Transpose() const & {
+            constexpr Layout other = layout == Layout::RowMajor ? Layout::ColumnMajor : Layout::RowMajor;
+            return SparseMatrix<T, other>::FromArrays(mCols, mRows, mOffsets, mIndices, mValues);
+        }
+
+        [[nodiscard]] auto Transpose() && {
+            constexpr Layout other = layout == Layout::RowMajor ? Layout::ColumnMajor : Layout::RowMajor;
+            return SparseMatrix<T, other>::FromArrays(mCols, mRows, std::move(mOffsets), std::move(mIndices),
+                                                      std::move(mValues));
+        }
+
+        /**
+         * The same matrix in the other compressed layout
+         */
+        template<Layout other>
+        [[nodiscard]] SparseMatrix<T, other> ToLayout() const {
+            if constexpr (other == layout) {
+                return Clone();
+            } else {
+                // a transpose by counting sort leaves every slice sorted
+                std::vector<size_t> offsets(GetInner() + 1, 0);
+                for (const uint32_t i: mIndices) {
+                    ++offsets[i + 1];
+                }
+                for (size_t i = 0; i < GetInner(); ++i) {
+                    offsets[i + 1] += offsets[i];
+                }
+                std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+                std::vector<uint32_t> indices(mIndices.size());
+                std::vector<T> values(mValues.size());
+                for (size_t o = 0; o < GetOuter(); ++o) {
+                    for (size_t k = mOffsets[o]; k < mOffsets[o + 1]; ++k) {
+                        const size_t at = next[mIndices[k]]++;
+                        indices[at] = static_cast<uint32_t>(o);
+                        values[at] = mValues[k];
+                    }
+                }
+                return SparseMatrix<T, other>::FromArrays(mRows, mCols, std::move(offsets), std::move(indices),
+                                                          std::move(values));
+            }
+        }
+
+        template<Layout other = layout>
+        [[nodiscard]] DMatrix<T, other> ToDense() const {
+            DMatrix<T, other> out(mRows, mCols);
+            for (size_t o = 0; o < GetOuter(); ++o) {
+                for (size_t k = mOffsets[o]; k < mOffsets[o + 1]; ++k) {
+                    if constexpr (layout == Layout::RowMajor) {
+                        out(o, mIndices[k]) = mValues[k];
+                    } else {
+                        out(mIndices[k], o) = mValues[k];
+                    }
+                }
+            }
+            return out;
+        }
+
+        /**
+         * y = A x. x holds GetCols() and y GetRows() elements; they must not overlap.
+         */
+        void Multiply(const T *x, T *y) const {
+            if constexpr (layout == Layout::RowMajor) {
+                Gather(x, y);
+            } else {
+                Scatter(x, y, mRows);
+            }
+        }
+
+        /**
+         * y = A^T x without forming the transpose. x holds GetRows() and y GetCols() elements; they
+         * must not overlap.
+         */
+        void TransposeMultiply(const T *x, T *y) const {
+            if constexpr (layout == Layout::RowMajor) {
+                Scatter(x, y, mCols);
+            } else {
+                Gather(x, y);
+            }
+        }
+
+        /**
+         * Builds a matrix from compressed arrays that already satisfy the invariants above. Throws
+         * std::invalid_argument when the inner dimension exceeds kMaxInner.
+         */
+        [[nodiscard]] static SparseMatrix FromArrays(const size_t rows, const size_t cols, std::vector<size_t> offsets,
+                                                     std::vector<uint32_t> indices, std::vector<T> values) {
+            SparseMatrix out;
+            out.mRows = rows;
+            out.mCols = cols;
+            out.mOffsets = std::move(offsets);
+            out.mIndices = std::move(indices);
+            out.mValues = std::move(values);
+            out.CheckInner();
+            return out;
+        }
+
+    private:
+        void CheckInner() const {
+            if (GetInner() > kMaxInner) {
+                throw std::invalid_argument("sparse matrix inner dimension exceeds 2^31");
+            }
+        }
+
+        [[nodiscard]] static size_t Outer(const Triplet<T> &t) noexcept {
+            return layout == Layout::RowMajor ? t.row : t.col;
+        }
+
+        [[nodiscard]] static size_t Inner(const Triplet<T> &t) noexcept {
+            return layout == Layout::RowMajor ? t.col : t.row;
+        }
+
+        /**
+         * Runs f(begin, end) over ranges of outer slices, in parallel when there are enough nonzeros
+         */
+        template<typename F>
+        void ForEachRange(F &&f) const {
+            ThreadPool &pool = GetThreadPool();
+            if (GetNonZeroCount() < Parallel::GetElementCutoff() || pool.GetThreadCount() == 1) {
+                f(size_t{0}, GetOuter(), size_t{0});
+                return;
+            }
+            const size_t parts = std::min(pool.GetThreadCount() * 4, GetNonZeroCount() / kMinParallelNonZeros + 1);
+            const std::vector<size_t> bounds = Detail::BalanceNonZeros(mOffsets, parts);
+            pool.ParallelFor(bounds.size() - 1, [&](size_t p) { f(bounds[p], bounds[p + 1], p); });
+        }
+
+        /**
+         * y[o] = dot(slice o, x): every output is written by one task
+         */
+        void Gather(const T *x, T *y) const {
+            ForEachRange([&](size_t begin, size_t end, size_t) {
+                for (size_t o = begin; o < end; ++o) {
+                    const size_t k = mOffsets[o];
+                    y[o] = Detail::SparseDot(mValues.data() + k, mIndices.data() + k, mOffsets[o + 1] - k, x);
+                }
+            });
+        }
+
+        /**
+         * out[inner] += slice o * x[o] for the outer slices [begin, end)
+         */
+        void ScatterRange(const T *x, T *out, const size_t begin, const size_t end) const noexcept {
+            for (size_t o = begin; o < end; ++o) {
+                const T scale = x[o];
+                for (size_t k = mOffsets[o]; k < mOffsets[o + 1]; ++k) {
+                    out[mIndices[k]] += mValues[k] * scale;
+                }
+            }
+        }
+
+        /**
+         * y[inner] += slice o * x[o]. Tasks write overlapping outputs, so there is one task per thread:
+         * the first sums straight into y and every other into its own scratch vector, which are then
+         * added into y in a single pass over it. The scratch vectors belong to the calling thread and
+         * are reused by its next product.
+         */
+        void Scatter(const T *x, T *y, const size_t n) const {
+            std::fill(y, y + n, T());
+            ThreadPool &pool = GetThreadPool();
+            if (GetNonZeroCount() < Parallel::GetElementCutoff() || pool.GetThreadCount() == 1) {
+                ScatterRange(x, y, 0, GetOuter());
+                return;
+            }
+            const size_t parts = std::min(pool.GetThreadCount(), GetNonZeroCount() / kMinParallelNonZeros + 1);
+            const std::vector<size_t> bounds = Detail::BalanceNonZeros(mOffsets, parts);
+            const size_t tasks = bounds.size() - 1;
+
+            // a product started by a task of this one while the thread waits gets scratch of its own
+            thread_local std::vector<T> cached;
+            thread_local bool busy = false;
+            std::vector<T> nested;
+            const bool reuse = !busy;
+            std::vector<T> &scratch = reuse ? cached : nested;
+            if (scratch.size() < (tasks - 1) * n) {
+                scratch.resize((tasks - 1) * n);
+            }
+            busy = true;
+            pool.ParallelFor(tasks, [&](size_t p) {
+                T *out = y;
+                if (p != 0) {
+                    out = scratch.data() + (p - 1) * n;
+                    std::fill(out, out + n, T());
+                }
+                ScatterRange(x, out, bounds[p], bounds[p + 1]);
+            });
+            if (tasks > 1) {
+                Parallel::Apply(n, [&](size_t begin, size_t end) {
+                    for (size_t p = 1; p < tasks; ++p) {
+                        const T *partial = scratch.data() + (p - 1) * n;
+                        Simd::Add(y + begin, partial + begin, y + begin, end - begin);
+                    }
+                }, tasks - 1);
+            }
+            if (reuse) {
+                busy = false;
+            }
+        }
+
+        size_t mRows = 0;
+
+        size_t mCols = 0;
+
+        /// start of every outer slice in mIndices and mValues, followed by the nonzero count
+        std::vector<size_t> mOffsets;
+
+        /// inner coordinate of every nonzero
+        std::vector<uint32_t> mIndices;
+
+        std::vector<T> mValues;
+    };
+
+    template<typename T = float>
+    using CsrMatrix = SparseMatrix<T, Layout::RowMajor>;
+
+    template<typename T = float>
+    using CscMatrix = SparseMatrix<T, Layout::ColumnMajor>;
+
+    /**
+     * Sparse matrix vector product
+     */
+    template<typename T, Layout layout>
+    [[nodiscard]] DVector<T> operator*(const SparseMatrix<T, layout> &lhs, const DVector<T> &rhs) {
+        if (lhs.GetCols() != rhs.GetSize()) {
+            throw std::invalid_argument("lhs matrix columns != rhs vector length");
+        }
+        DVector<T> out(lhs.GetRows());
+        lhs.Multiply(rhs.GetData(), out.GetData());
+        return out;
+    }
+
+    /**
+     * lhs^T * rhs without forming the transpose
+     */
+    template<typename T, Layout layout>
+    [[nodiscard]] DVector<T> TransposeMultiply(const SparseMatrix<T, layout> &lhs, const DVector<T> &rhs) {
+        if (lhs.GetRows() != rhs.GetSize()) {
+            throw std::invalid_argument("lhs matrix rows != rhs vector length");
+        }
+        DVector<T> out(lhs.GetCols());
+        lhs.TransposeMultiply(rhs.GetData(), out.GetData());
+        return out;
+    }
+}
+
+#endif //DRAWING_SPARSE_H
@@ -0,0 +1,106 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_THREAD_POOL_H
+#define DRAWING_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace QS::LinAlg {
+
+    /**
+     * Work-stealing thread pool.
+     *
+     * Every worker owns a task queue. A worker takes work from the back of its own queue and, when
+     * that is empty, steals from the front of the other queues. The thread calling ParallelFor
+     * executes tasks while it waits, so nested calls from inside a task cannot deadlock.
+     */
+    class ThreadPool {
+    public:
+        /**
+         * \param threads total threads taking part in a ParallelFor, including the calling thread.
+         * 0 uses std::thread::hardware_concurrency(). 1 runs everything on the calling thread.
+         */
+        explicit ThreadPool(size_t threads = 0);
+
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool &) = delete;
+
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        /**
+         * number of threads that execute tasks, including the calling thread
+         */
+        [[nodiscard]] size_t GetThreadCount() const noexcept { return mQueues.size() + 1; }
+
+        /**
+         * Calls body(i) for every i in [0, count) across the pool and returns once all calls have
+         * finished. The first exception thrown by body is rethrown here.
+         */
+        void ParallelFor(size_t count, const std::function<void(size_t)> &body);
+
+    private:
+        using Task = std::function<void()>;
+
+        struct Queue {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        void Push(size_t queue, Task task);
+
+        bool TryPop(size_t queue, Task &task);
+
+        bool TrySteal(size_t thief, Task &task);
+
+        /**
+         * runs one queued task, preferring the queue at home
+         * \returns false if every queue was empty
+         */
+        bool RunOne(size_t home);
+
+        void WorkerLoop(size_t index);
+
+        /// one queue per worker thread
+        std::vector<std::unique_ptr<Queue>> mQueues;
+
+        /// worker threads
+        std::vector<std::thread> mThreads;
+
+        /// tasks queued but not yet taken
+        std::atomic<size_t> mPending{0};
+
+        /// set when the pool shuts down
+        bool mStop = false;
+
+        /// guards mStop and the sleep of idle workers
+        std::mutex mWakeMutex;
+
+        /// idle workers sleep here
+        std::condition_variable mWake;
+    };
+
+    /**
+     * The pool used by the parallel linalg kernels
+     */
+    ThreadPool &GetThreadPool();
+
+    /**
+     * Replaces the pool used by the parallel linalg kernels. Must not be called while a parallel
+     * kernel is running.
+     * \param threads see ThreadPool::ThreadPool
+     */
+    void SetThreadCount(size_t threads);
+}
+
+#endif //DRAWING_THREAD_POOL_H
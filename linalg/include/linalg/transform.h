@@ -0,0 +1,66 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_TRANSFORM_H
+#define DRAWING_TRANSFORM_H
+
+#include <cstddef>
+
+#include "cmatrix.h"
+
+/**
+ * Batch transforms of vertex streams by a 4x4 matrix.
+ *
+ * A stream is count vertices in one float buffer with stride floats from the start of one vertex
+ * to the next, e.g. Geometry<length>::GetVerticesPointer() with stride length. Only the leading
+ * components of each vertex are read and written; the remaining attributes are left untouched.
+ * The work is vectorized across four vertices at a time, eight on AVX2 machines (see dispatch.h),
+ * and split across the thread pool for large streams.
+ *
+ * out may be the same buffer as in when both strides are equal. Any other overlap is undefined.
+ */
+namespace QS::LinAlg {
+
+    /**
+     * Transforms the points (x, y, z, 1) and writes x, y, z. The w of the result is dropped, so m
+     * should be affine.
+     */
+    void TransformPositions(const CMatrix<4, 4> &m, const float *in, size_t inStride, float *out, size_t outStride,
+                            size_t count);
+
+    /**
+     * Transforms the positions of a stream in place
+     */
+    inline void TransformPositions(const CMatrix<4, 4> &m, float *data, const size_t stride, const size_t count) {
+        TransformPositions(m, data, stride, data, stride, count);
+    }
+
+    /**
+     * Transforms the directions (x, y, z, 0) and writes x, y, z. Translation is ignored.
+     */
+    void TransformDirections(const CMatrix<4, 4> &m, const float *in, size_t inStride, float *out, size_t outStride,
+                             size_t count);
+
+    /**
+     * Transforms the directions of a stream in place
+     */
+    inline void TransformDirections(const CMatrix<4, 4> &m, float *data, const size_t stride, const size_t count) {
+        TransformDirections(m, data, stride, data, stride, count);
+    }
+
+    /**
+     * Transforms the homogeneous vectors (x, y, z, w) and writes all four components
+     */
+    void TransformHomogeneous(const CMatrix<4, 4> &m, const float *in, size_t inStride, float *out, size_t outStride,
+                              size_t count);
+
+    /**
+     * Transforms the homogeneous vectors of a stream in place
+     */
+    inline void TransformHomogeneous(const CMatrix<4, 4> &m, float *data, const size_t stride, const size_t count) {
+        TransformHomogeneous(m, data, stride, data, stride, count);
+    }
+}
+
+#endif //DRAWING_TRANSFORM_H
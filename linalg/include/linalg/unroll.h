@@ -0,0 +1,50 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_UNROLL_H
+#define DRAWING_UNROLL_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace QS::LinAlg::Detail {
+
+    /// longest fixed length loop generated as straight-line code by For
+    inline constexpr size_t kUnrollLimit = 16;
+
+    template<size_t offset, typename F, size_t... i>
+    constexpr void UnrollSequence(F &&f, std::index_sequence<i...>) {
+        (f(std::integral_constant<size_t, offset + i>{}), ...);
+    }
+
+    /**
+     * Calls f(std::integral_constant<size_t, i>{}) for i in [begin, end) as straight-line code. The
+     * index is a constant expression inside f, so loops nested in it can be unrolled in turn.
+     */
+    template<size_t begin, size_t end, typename F>
+    constexpr void Unroll(F &&f) {
+        if constexpr (begin < end) {
+            UnrollSequence<begin>(f, std::make_index_sequence<end - begin>{});
+        }
+    }
+
+    /**
+     * Calls f(i) for i in [0, n) in order, unrolled as Unroll does up to kUnrollLimit iterations and
+     * as an ordinary loop above it, so large fixed sizes do not bloat the code. f receives either a
+     * std::integral_constant or a size_t and should take its index as size_t.
+     */
+    template<size_t n, typename F>
+    constexpr void For(F &&f) {
+        if constexpr (n <= kUnrollLimit) {
+            Unroll<0, n>(f);
+        } else {
+            for (size_t i = 0; i < n; ++i) {
+                f(i);
+            }
+        }
+    }
+}
+
+#endif //DRAWING_UNROLL_H
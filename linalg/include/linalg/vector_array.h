@@ -0,0 +1,377 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_VECTOR_ARRAY_H
+#define DRAWING_VECTOR_ARRAY_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "aligned_buffer.h"
+#include "dvector.h"
+#include "rvector.h"
+#include "simd.h"
+
+namespace QS::LinAlg {
+
+    /**
+     * Array of length component vectors stored as a structure of arrays: component c of every
+     * vector lives in its own cache line aligned lane, GetLane(c). Bulk operations walk the lanes
+     * with the span kernels in simd.h, so a register holds the same component of 4 or 8 vectors
+     * instead of one whole vector.
+     *
+     * Element access goes through a proxy that converts to and from RVector<length, T>.
+     * VectorArray is move-only; use Clone() for an explicit copy. Operations on arrays of different
+     * sizes throw std::invalid_argument.
+     */
+    template<int length, typename T = float>
+    class VectorArray {
+    public:
+        using value_type = T;
+
+        using Vector = RVector<length, T>;
+
+        /**
+         * Proxy for the vector at one index
+         */
+        class Reference {
+        public:
+            Reference(VectorArray &array, const size_t idx) noexcept : mArray{array}, mIdx{idx} {}
+
+            [[nodiscard]] T &operator[](const size_t component) const noexcept {
+                return mArray.GetLane(component)[mIdx];
+            }
+
+            operator Vector() const noexcept { return std::as_const(mArray).Get(mIdx); }
+
+            Reference &operator=(const Vector &vec) noexcept {
+                mArray.Set(mIdx, vec);
+                return *this;
+            }
+
+            Reference &operator=(const Reference &other) noexcept {
+                return *this = static_cast<Vector>(other);
+            }
+
+            Reference &operator+=(const Vector &vec) noexcept {
+                for (size_t c = 0; c < length; ++c) {
+                    (*this)[c] += vec[c];
+                }
+                return *this;
+            }
+
+            Reference &operator-=(const Vector &vec) noexcept {
+                for (size_t c = 0; c < length; ++c) {
+                    (*this)[c] -= vec[c];
+                }
+                return *this;
+            }
+
+        private:
+            VectorArray &mArray;
+
+            size_t mIdx;
+        };
+
+        VectorArray() noexcept = default;
+
+        /**
+         * Produces size zero vectors
+         */
+        explicit VectorArray(const size_t size) {
+            Resize(size);
+        }
+
+        VectorArray(std::initializer_list<Vector> list) : VectorArray(list.size()) {
+            size_t i = 0;
+            for (const Vector &vec: list) {
+                Set(i++, vec);
+            }
+        }
+
+        VectorArray(const VectorArray &) = delete;
+
+        VectorArray &operator=(const VectorArray &) = delete;
+
+        VectorArray(VectorArray &&other) noexcept
+                : mSize{std::exchange(other.mSize, 0)}, mLaneStride{std::exchange(other.mLaneStride, 0)},
+                  mData{std::move(other.mData)} {}
+
+        VectorArray &operator=(VectorArray &&other) noexcept {
+            mSize = std::exchange(other.mSize, 0);
+            mLaneStride = std::exchange(other.mLaneStride, 0);
+            mData = std::move(other.mData);
+            return *this;
+        }
+
+        [[nodiscard]] VectorArray Clone() const {
+            VectorArray out;
+            out.Reserve(mSize);
+            out.mSize = mSize;
+            out.CopyLanes(*this);
+            return out;
+        }
+
+        /**
+         * Gathers count vectors from an interleaved stream, e.g. the positions of
+         * Geometry::GetVerticesPointer(), where consecutive vectors start stride values apart
+         */
+        [[nodiscard]] static VectorArray Load(const T *data, const size_t stride, const size_t count) {
+            VectorArray out(count);
+            for (size_t c = 0; c < length; ++c) {
+                T *lane = out.GetLane(c);
+                for (size_t i = 0; i < count; ++i) {
+                    lane[i] = data[i * stride + c];
+                }
+            }
+            return out;
+        }
+
+        /**
+         * Scatters the vectors back into an interleaved stream, leaving the other values untouched
+         */
+        void Store(T *data, const size_t stride) const noexcept {
+            for (size_t c = 0; c < length; ++c) {
+                const T *lane = GetLane(c);
+                for (size_t i = 0; i < mSize; ++i) {
+                    data[i * stride + c] = lane[i];
+                }
+            }
+        }
+
+        [[nodiscard]] size_t GetSize() const noexcept { return mSize; }
+
+        /**
+         * number of vectors that fit before the lanes are reallocated
+         */
+        [[nodiscard]] size_t GetCapacity() const noexcept { return mLaneStride; }
+
+        /**
+         * component c of every vector, aligned to kCacheLineSize
+         */
+        [[nodiscard]] T *GetLane(const size_t c) noexcept { return mData.GetData() + c * mLaneStride; }
+
+        [[nodiscard]] const T *GetLane(const size_t c) const noexcept { return mData.GetData() + c * mLaneStride; }
+
+        [[nodiscard]] Reference operator[](const size_t idx) noexcept { return Reference(*this, idx); }
+
+        [[nodiscard]] Vector operator[](const size_t idx) const noexcept { return Get(idx); }
+
+        [[nodiscard]] Vector Get(const size_t idx) const noexcept {
+            Vector out;
+            for (size_t c = 0; c < length; ++c) {
+                out[c] = GetLane(c)[idx];
+            }
+            return out;
+        }
+
+        void Set(const size_t idx, const Vector &vec) noexcept {
+            for (size_t c = 0; c < length; ++c) {
+                GetLane(c)[idx] = vec[c];
+            }
+        }
+
+        void Reserve(const size_t capacity) {
+            if (capacity <= mLaneStride) {
+                return;
+            }
+            // round every lane up to whole cache lines so each lane starts aligned
+            constexpr size_t perLine = kCacheLineSize / sizeof(T) > 0 ? kCacheLineSize / sizeof(T) : 1;
+            VectorArray grown;
+            grown.mLaneStride = (capacity + perLine - 1) / perLine * perLine;
+            grown.mData = AlignedBuffer<T>(grown.mLaneStride * length);
+            grown.mSize = mSize;
+            grown.CopyLanes(*this);
+            *this = std::move(grown);
+        }
+
+        /**
+         * Grows or shrinks the array. New vectors are zero.
+         */
+        void Resize(const size_t size) {
+            if (size > mSize) {
+                Reserve(size);
+            }
+            for (size_t c = 0; c < length && size < mSize; ++c) {
+                T *lane = GetLane(c);
+                for (size_t i = size; i < mSize; ++i) {
+                    lane[i] = T();
+                }
+            }
+            mSize = size;
+        }
+
+        void PushBack(const Vector &vec) {
+            if (mSize == mLaneStride) {
+                Reserve(mSize > 0 ? mSize * 2 : 1);
+            }
+            Set(mSize++, vec);
+        }
+
+        void Clear() noexcept { Resize(0); }
+
+        VectorArray &operator+=(const VectorArray &rhs) {
+            CheckSameSize(rhs);
+            for (size_t c = 0; c < length; ++c) {
+                Simd::Add(GetLane(c), rhs.GetLane(c), GetLane(c), mSize);
+            }
+            return *this;
+        }
+
+        VectorArray &operator-=(const VectorArray &rhs) {
+            CheckSameSize(rhs);
+            for (size_t c = 0; c < length; ++c) {
+                Simd::Sub(GetLane(c), rhs.GetLane(c), GetLane(c), mSize);
+            }
+            return *this;
+        }
+
+        /**
+         * Adds vec to every vector
+         */
+        VectorArray &operator+=(const Vector &vec) noexcept {
+            for (size_t c = 0; c < length; ++c) {
+                T *lane = GetLane(c);
+                for (size_t i = 0; i < mSize; ++i) {
+                    lane[i] += vec[c];
+                }
+            }
+            return *this;
+        }
+
+        VectorArray &operator*=(const T scalar) noexcept {
+            for (size_t c = 0; c < length; ++c) {
+                Simd::Scale(GetLane(c), scalar, GetLane(c), mSize);
+            }
+            return *this;
+        }
+
+        /**
+         * Scales each vector by its own factor
+         * \param scalars GetSize() factors
+         */
+        VectorArray &Scale(const T *scalars) noexcept {
+            for (size_t c = 0; c < length; ++c) {
+                Simd::Mul(GetLane(c), scalars, GetLane(c), mSize);
+            }
+            return *this;
+        }
+
+        /**
+         * Adds x * scalar to every vector, e.g. position += velocity * dt
+         */
+        VectorArray &MultiplyAdd(const VectorArray &x, const T scalar) {
+            CheckSameSize(x);
+            for (size_t c = 0; c < length; ++c) {
+                Simd::Axpy(scalar, x.GetLane(c), GetLane(c), mSize);
+            }
+            return *this;
+        }
+
+        /**
+         * Divides every vector by its length. Zero vectors produce NaN.
+         */
+        VectorArray &Normalize() {
+            DVector<T> lengths = Length(*this);
+            for (size_t c = 0; c < length; ++c) {
+                Simd::Div(GetLane(c), lengths.GetData(), GetLane(c), mSize);
+            }
+            return *this;
+        }
+
+        /**
+         * throws std::invalid_argument when rhs holds a different number of vectors
+         */
+        void CheckSameSize(const VectorArray &rhs) const {
+            if (rhs.GetSize() != mSize) {
+                throw std::invalid_argument("rhs and lhs arrays have differing sizes");
+            }
+        }
+
+        /**
+         * Dot product of every pair of vectors
+         */
+        [[nodiscard]] friend DVector<T> Dot(const VectorArray &lhs, const VectorArray &rhs) {
+            lhs.CheckSameSize(rhs);
+            DVector<T> out(lhs.GetSize());
+            for (size_t c = 0; c < length; ++c) {
+                Simd::MulAdd(lhs.GetLane(c), rhs.GetLane(c), out.GetData(), out.GetSize());
+            }
+            return out;
+        }
+
+        /**
+         * Euclidean length of every vector
+         */
+        [[nodiscard]] friend DVector<T> Length(const VectorArray &array) {
+            DVector<T> out = Dot(array, array);
+            Simd::Sqrt(out.GetData(), out.GetData(), out.GetSize());
+            return out;
+        }
+
+    private:
+        /**
+         * copies the first mSize vectors of other, which may have a different lane stride
+         */
+        void CopyLanes(const VectorArray &other) noexcept {
+            for (size_t c = 0; c < length; ++c) {
+                std::copy_n(other.GetLane(c), mSize, GetLane(c));
+            }
+        }
+
+        /// number of vectors
+        size_t mSize = 0;
+
+        /// distance in elements between the starts of two lanes, the capacity
+        size_t mLaneStride = 0;
+
+        /// lanes stored one after another
+        AlignedBuffer<T> mData;
+    };
+
+    template<int length, typename T>
+    [[nodiscard]] VectorArray<length, T> operator+(const VectorArray<length, T> &lhs, const VectorArray<length, T> &rhs) {
+        VectorArray<length, T> out = lhs.Clone();
+        out += rhs;
+        return out;
+    }
+
+    template<int length, typename T>
+    [[nodiscard]] VectorArray<length, T> operator+(VectorArray<length, T> &&lhs, const VectorArray<length, T> &rhs) {
+        lhs += rhs;
+        return std::move(lhs);
+    }
+
+    template<int length, typename T>
+    [[nodiscard]] VectorArray<length, T> operator-(const VectorArray<length, T> &lhs, const VectorArray<length, T> &rhs) {
+        VectorArray<length, T> out = lhs.Clone();
+        out -= rhs;
+        return out;
+    }
+
+    template<int length, typename T>
+    [[nodiscard]] VectorArray<length, T> operator-(VectorArray<length, T> &&lhs, const VectorArray<length, T> &rhs) {
+        lhs -= rhs;
+        return std::move(lhs);
+    }
+
+    template<int length, typename T>
+    [[nodiscard]] VectorArray<length, T> operator*(const VectorArray<length, T> &lhs, const std::type_identity_t<T> scalar) {
+        VectorArray<length, T> out = lhs.Clone();
+        out *= scalar;
+        return out;
+    }
+
+    template<int length, typename T>
+    [[nodiscard]] VectorArray<length, T> operator*(VectorArray<length, T> &&lhs, const std::type_identity_t<T> scalar) {
+        lhs *= scalar;
+        return std::move(lhs);
+    }
+}
+
+#endif //DRAWING_VECTOR_ARRAY_H
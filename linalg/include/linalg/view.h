@@ -0,0 +1,585 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#ifndef DRAWING_VIEW_H
+#define DRAWING_VIEW_H
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "cmatrix.h"
+#include "expression.h"
+#include "rmatrix.h"
+
+/**
+ * Non-owning views of the fixed size vectors and matrices.
+ *
+ * Transpose(m) and AsColumnMajor(m) / AsRowMajor(m) relabel a matrix expression without touching
+ * its elements. The row major data of an RMatrix<r, c> is the column major data of its transpose,
+ * so Transpose(rmatrix) is a CMatrix<r, c> shaped expression over the very same memory and still
+ * reaches the SIMD kernels. AsColumnMajor keeps the matrix and swaps the indexing instead, which
+ * makes it strided.
+ *
+ * Row(m, r), Column(m, c), Block<rows, cols>(m, r0, c0) and Segment<n>(v, offset) refer to part of
+ * an RVector, CVector, RMatrix, CMatrix or of another view by pointer and compile time strides. They
+ * are writable when the viewed object is, and assigning to a view writes through to it.
+ *
+ * A stride of kDynamicStride is given at run time instead, for views of memory laid out by someone
+ * else; see map.h.
+ *
+ * All views are expressions: they combine with +, - and scalar *, take part in the dot and matrix
+ * products and construct or assign the storage types. Views do not extend the lifetime of what they
+ * view, and indices are not checked, as with operator[] on the storage types.
+ *
+ * A view may read the very memory an assignment writes, as in m = AsRowMajor(Transpose(m)) or
+ * Block<2, 2>(m, 0, 0) = Block<2, 2>(m, 1, 1). Assignment to the storage types and to views checks for that with
+ * Expr::MayAlias and then evaluates into a temporary before writing. The check compares addresses
+ * only: a view counts as aliasing whenever it overlaps the destination, a stored operand only when
+ * it is read reordered. Expressions saved with auto and evaluated later by hand get no such check.
+ */
+namespace QS::LinAlg {
+
+    /// stride template argument of a view whose stride is only known at run time
+    inline constexpr size_t kDynamicStride = std::numeric_limits<size_t>::max();
+
+    template<class Shape, typename T, size_t stride>
+    class VectorView;
+
+    template<class Shape, typename T, size_t outerStride, size_t innerStride>
+    class MatrixView;
+
+    namespace Detail {
+        /**
+         * A view stride: empty when known at compile time, a member when kDynamicStride
+         */
+        template<size_t value>
+        struct Stride {
+            constexpr Stride() noexcept = default;
+
+            [[nodiscard]] static constexpr size_t Get() noexcept { return value; }
+        };
+
+        template<>
+        struct Stride<kDynamicStride> {
+            constexpr explicit Stride(const size_t value) noexcept : mValue{value} {}
+
+            [[nodiscard]] constexpr size_t Get() const noexcept { return mValue; }
+
+            size_t mValue;
+        };
+
+        /// shape of one m[outer] of a matrix with the given shape
+        template<class Shape>
+        using SliceShape = std::conditional_t<Expr::IsRowMajor<Shape>::value,
+                Expr::RowVector<Shape::inner>, Expr::ColumnVector<Shape::inner>>;
+
+        /// first element of a storage type or view
+        template<class M>
+        constexpr auto *OriginOf(M &m) noexcept {
+            if constexpr (requires { m.GetOrigin(); }) {
+                return m.GetOrigin();
+            } else {
+                return m.GetData();
+            }
+        }
+
+        /// distance between consecutive m[outer] of a storage type or matrix view, or kDynamicStride
+        template<class M>
+        constexpr size_t kOuterStrideOf = [] {
+            if constexpr (requires { std::remove_cvref_t<M>::kOuterStride; }) {
+                return std::remove_cvref_t<M>::kOuterStride;
+            } else {
+                return static_cast<size_t>(Expr::ShapeOf<M>::inner);
+            }
+        }();
+
+        /// distance between consecutive elements of a vector or of one m[outer], or kDynamicStride
+        template<class M>
+        constexpr size_t kInnerStrideOf = [] {
+            if constexpr (requires { std::remove_cvref_t<M>::kInnerStride; }) {
+                return std::remove_cvref_t<M>::kInnerStride;
+            } else {
+                return size_t(1);
+            }
+        }();
+
+        template<class M>
+        constexpr size_t OuterStrideOf(const M &m) noexcept {
+            if constexpr (kOuterStrideOf<M> == kDynamicStride) {
+                return m.GetOuterStride();
+            } else {
+                return kOuterStrideOf<M>;
+            }
+        }
+
+        template<class M>
+        constexpr size_t InnerStrideOf(const M &m) noexcept {
+            if constexpr (kInnerStrideOf<M> == kDynamicStride) {
+                return m.GetInnerStride();
+            } else {
+                return kInnerStrideOf<M>;
+            }
+        }
+
+        /// a vector view at data, passing the stride on when it is dynamic
+        template<class Shape, typename T, size_t stride>
+        constexpr VectorView<Shape, T, stride> MakeVectorView(T *data, const size_t runtime) noexcept {
+            if constexpr (stride == kDynamicStride) {
+                return VectorView<Shape, T, stride>(data, runtime);
+            } else {
+                return VectorView<Shape, T, stride>(data);
+            }
+        }
+
+        /// a matrix view at data, passing on the strides that are dynamic
+        template<class Shape, typename T, size_t outerStride, size_t innerStride>
+        constexpr MatrixView<Shape, T, outerStride, innerStride>
+        MakeMatrixView(T *data, const size_t outer, const size_t inner) noexcept {
+            if constexpr (innerStride == kDynamicStride) {
+                return MatrixView<Shape, T, outerStride, innerStride>(data, outer, inner);
+            } else if constexpr (outerStride == kDynamicStride) {
+                return MatrixView<Shape, T, outerStride, innerStride>(data, outer);
+            } else {
+                return MatrixView<Shape, T, outerStride, innerStride>(data);
+            }
+        }
+
+        template<class M>
+        using ElementOf = std::remove_pointer_t<decltype(OriginOf(std::declval<M &>()))>;
+
+        /// the storage type of a shape, which holds an expression before it is written through a view
+        template<class Shape, typename T>
+        struct StorageOf;
+
+        template<int n, typename T>
+        struct StorageOf<Expr::RowVector<n>, T> {
+            using type = RVector<n, T>;
+        };
+
+        template<int n, typename T>
+        struct StorageOf<Expr::ColumnVector<n>, T> {
+            using type = CVector<n, T>;
+        };
+
+        template<int row, int col, typename T>
+        struct StorageOf<Expr::RowMajor<row, col>, T> {
+            using type = RMatrix<row, col, T>;
+        };
+
+        template<int col, int row, typename T>
+        struct StorageOf<Expr::ColumnMajor<col, row>, T> {
+            using type = CMatrix<col, row, T>;
+        };
+    }
+
+    /**
+     * length elements at data, data + stride, ... viewed as an RVector (Shape RowVector) or CVector
+     * (Shape ColumnVector). T is const for a read only view. Only a stride of 1 fixed at compile
+     * time makes the view Expr::Dense.
+     */
+    template<class Shape, typename T, size_t stride>
+    class VectorView {
+    public:
+        using ExpressionShape = Shape;
+
+        using value_type = std::remove_const_t<T>;
+
+        static constexpr bool kAddressable = true;
+
+        static constexpr size_t kInnerStride = stride;
+
+        constexpr explicit VectorView(T *data) noexcept requires (stride != kDynamicStride) : mData{data} {}
+
+        constexpr VectorView(T *data, const size_t runtime) noexcept requires (stride == kDynamicStride)
+                : mData{data}, mStride{runtime} {}
+
+        constexpr VectorView(const VectorView &) noexcept = default;
+
+        /**
+         * Copies the elements of rhs, not the pointer
+         */
+        constexpr VectorView &operator=(const VectorView &rhs) requires (!std::is_const_v<T>) {
+            return Update<void>(rhs);
+        }
+
+        template<Expr::ExpressionOf<Shape> E> requires (!std::is_const_v<T>)
+        constexpr VectorView &operator=(const E &expr) {
+            return Update<void>(expr);
+        }
+
+        template<Expr::ExpressionOf<Shape> E> requires (!std::is_const_v<T>)
+        constexpr VectorView &operator+=(const E &rhs) {
+            return Update<Expr::Add>(rhs);
+        }
+
+        template<Expr::ExpressionOf<Shape> E> requires (!std::is_const_v<T>)
+        constexpr VectorView &operator-=(const E &rhs) {
+            return Update<Expr::Sub>(rhs);
+        }
+
+        [[nodiscard]] constexpr T &operator[](const size_t idx) const noexcept {
+            return mData[idx * mStride.Get()];
+        }
+
+        [[nodiscard]] constexpr value_type Eval(const size_t idx) const noexcept {
+            return mData[idx * mStride.Get()];
+        }
+
+        [[nodiscard]] constexpr size_t GetSize() const noexcept { return Shape::length; }
+
+        [[nodiscard]] constexpr T *GetOrigin() const noexcept { return mData; }
+
+        [[nodiscard]] constexpr size_t GetInnerStride() const noexcept { return mStride.Get(); }
+
+        /**
+         * Contiguous views are Expr::Dense and reach the SIMD kernels
+         */
+        [[nodiscard]] constexpr const value_type *GetData() const noexcept requires (stride == 1) {
+            return mData;
+        }
+
+        [[nodiscard]] constexpr bool MayAlias(const void *begin, const void *end, bool) const noexcept {
+            return Expr::Overlaps(mData, End(), begin, end);
+        }
+
+    private:
+        using Storage = typename Detail::StorageOf<Shape, value_type>::type;
+
+        /// one past the last element
+        [[nodiscard]] constexpr T *End() const noexcept {
+            return mData + (Shape::length - 1) * mStride.Get() + 1;
+        }
+
+        /// writes expr, or this Op expr with Op void for plain assignment, through a copy when needed
+        template<class Op, class E>
+        constexpr VectorView &Update(const E &expr) {
+            // any overlap counts: this view may lay the memory out differently from a stored operand
+            if (Expr::MayAlias(expr, mData, End(), true)) {
+                return Write<Op>(Storage(expr));
+            }
+            return Write<Op>(expr);
+        }
+
+        template<class Op, class E>
+        constexpr VectorView &Write(const E &expr) {
+            if constexpr (std::is_void_v<Op> && stride == 1) {
+                Expr::Evaluate<Shape::length>(expr, mData);
+            } else {
+                for (size_t i = 0; i < Shape::length; ++i) {
+                    if constexpr (std::is_void_v<Op>) {
+                        (*this)[i] = expr.Eval(i);
+                    } else {
+                        (*this)[i] = Op::Apply((*this)[i], expr.Eval(i));
+                    }
+                }
+            }
+            return *this;
+        }
+
+        T *mData;
+        [[no_unique_address]] Detail::Stride<stride> mStride;
+    };
+
+    /**
+     * A matrix of the given shape whose element m[outer][inner] is data[outer * outerStride + inner
+     * * innerStride]. T is const for a read only view. A dynamic inner stride requires a dynamic
+     * outer stride as well.
+     */
+    template<class Shape, typename T, size_t outerStride, size_t innerStride>
+    class MatrixView {
+    public:
+        static_assert(innerStride != kDynamicStride || outerStride == kDynamicStride,
+                      "a dynamic inner stride needs a dynamic outer stride");
+
+        using ExpressionShape = Shape;
+
+        using value_type = std::remove_const_t<T>;
+
+        static constexpr bool kAddressable = true;
+
+        static constexpr size_t kOuterStride = outerStride;
+
+        static constexpr size_t kInnerStride = innerStride;
+
+        constexpr explicit MatrixView(T *data) noexcept requires (outerStride != kDynamicStride)
+                : mData{data} {}
+
+        constexpr MatrixView(T *data, const size_t outer) noexcept
+        requires (outerStride == kDynamicStride && innerStride != kDynamicStride)
+                : mData{data}, mOuterStride{outer} {}
+
+        constexpr MatrixView(T *data, const size_t outer, const size_t inner) noexcept
+        requires (innerStride == kDynamicStride)
+                : mData{data}, mOuterStride{outer}, mInnerStride{inner} {}
+
+        constexpr MatrixView(const MatrixView &) noexcept = default;
+
+        /**
+         * Copies the elements of rhs, not the pointer
+         */
+        constexpr MatrixView &operator=(const MatrixView &rhs) requires (!std::is_const_v<T>) {
+            return Update<void>(rhs);
+        }
+
+        template<Expr::ExpressionOf<Shape> E> requires (!std::is_const_v<T>)
+        constexpr MatrixView &operator=(const E &expr) {
+            return Update<void>(expr);
+        }
+
+        template<Expr::ExpressionOf<Shape> E> requires (!std::is_const_v<T>)
+        constexpr MatrixView &operator+=(const E &rhs) {
+            return Update<Expr::Add>(rhs);
+        }
+
+        template<Expr::ExpressionOf<Shape> E> requires (!std::is_const_v<T>)
+        constexpr MatrixView &operator-=(const E &rhs) {
+            return Update<Expr::Sub>(rhs);
+        }
+
+        /**
+         * A row of a row major view or a column of a column major one, as on the storage types
+         */
+        [[nodiscard]] constexpr VectorView<Detail::SliceShape<Shape>, T, innerStride>
+        operator[](const size_t idx) const noexcept {
+            return Detail::MakeVectorView<Detail::SliceShape<Shape>, T, innerStride>(
+                    mData + idx * mOuterStride.Get(), mInnerStride.Get());
+        }
+
+        [[nodiscard]] constexpr value_type Eval(const size_t i, const size_t j) const noexcept {
+            return mData[i * mOuterStride.Get() + j * mInnerStride.Get()];
+        }
+
+        [[nodiscard]] constexpr T *GetOrigin() const noexcept { return mData; }
+
+        [[nodiscard]] constexpr size_t GetOuterStride() const noexcept { return mOuterStride.Get(); }
+
+        [[nodiscard]] constexpr size_t GetInnerStride() const noexcept { return mInnerStride.Get(); }
+
+        /**
+         * Views without gaps between rows (columns) are Expr::Dense and reach the SIMD kernels
+         */
+        [[nodiscard]] constexpr const value_type *GetData() const noexcept
+        requires (innerStride == 1 && outerStride == Shape::inner) {
+            return mData;
+        }
+
+        [[nodiscard]] constexpr bool MayAlias(const void *begin, const void *end, bool) const noexcept {
+            return Expr::Overlaps(mData, End(), begin, end);
+        }
+
+    private:
+        using Storage = typename Detail::StorageOf<Shape, value_type>::type;
+
+        /// one past the last element
+        [[nodiscard]] constexpr T *End() const noexcept {
+            return mData + (Shape::outer - 1) * mOuterStride.Get() + (Shape::inner - 1) * mInnerStride.Get() + 1;
+        }
+
+        /// as VectorView::Update
+        template<class Op, class E>
+        constexpr MatrixView &Update(const E &expr) {
+            if (Expr::MayAlias(expr, mData, End(), true)) {
+                return Write<Op>(Storage(expr));
+            }
+            return Write<Op>(expr);
+        }
+
+        template<class Op, class E>
+        constexpr MatrixView &Write(const E &expr) {
+            for (size_t i = 0; i < Shape::outer; ++i) {
+                for (size_t j = 0; j < Shape::inner; ++j) {
+                    if constexpr (std::is_void_v<Op>) {
+                        (*this)[i][j] = expr.Eval(i, j);
+                    } else {
+                        (*this)[i][j] = Op::Apply((*this)[i][j], expr.Eval(i, j));
+                    }
+                }
+            }
+            return *this;
+        }
+
+        T *mData;
+        [[no_unique_address]] Detail::Stride<outerStride> mOuterStride;
+        [[no_unique_address]] Detail::Stride<innerStride> mInnerStride;
+    };
+
+    namespace Expr {
+        template<class Shape>
+        struct TransposeOf;
+
+        template<int row, int col>
+        struct TransposeOf<RowMajor<row, col>> {
+            using type = ColumnMajor<row, col>;
+        };
+
+        template<int col, int row>
+        struct TransposeOf<ColumnMajor<col, row>> {
+            using type = RowMajor<col, row>;
+        };
+
+        template<class Shape>
+        struct ReorderOf;
+
+        template<int row, int col>
+        struct ReorderOf<RowMajor<row, col>> {
+            using type = ColumnMajor<col, row>;
+        };
+
+        template<int col, int row>
+        struct ReorderOf<ColumnMajor<col, row>> {
+            using type = RowMajor<row, col>;
+        };
+
+        /**
+         * The transpose of a matrix expression. Only the shape changes: the outer index of the
+         * operand is the outer index of the result, so elements are read in the same order and a
+         * Dense operand gives a Dense result.
+         */
+        template<class E>
+        class Transposed : public Node<Transposed<E>> {
+        public:
+            using ExpressionShape = typename TransposeOf<ShapeOf<E>>::type;
+
+            using value_type = ValueOf<E>;
+
+            static constexpr bool kAddressable = Addressable<E>;
+
+            constexpr explicit Transposed(E &&expr) : mExpr(std::forward<E>(expr)) {}
+
+            [[nodiscard]] constexpr value_type Eval(const size_t i, const size_t j) const {
+                return mExpr.Eval(i, j);
+            }
+
+            [[nodiscard]] constexpr const value_type *GetData() const noexcept requires Dense<E> {
+                return mExpr.GetData();
+            }
+
+            /// elements are read in the order of the operand, so only the operand can alias
+            [[nodiscard]] constexpr bool MayAlias(const void *begin, const void *end,
+                                                  const bool reordered) const noexcept {
+                return Expr::MayAlias(mExpr, begin, end, reordered);
+            }
+
+        private:
+            Stored<E> mExpr;
+        };
+
+        /**
+         * The same matrix indexed in the other storage order, m[row][col] for a column major
+         * operand and m[col][row] for a row major one
+         */
+        template<class E>
+        class Reordered : public Node<Reordered<E>> {
+        public:
+            using ExpressionShape = typename ReorderOf<ShapeOf<E>>::type;
+
+            using value_type = ValueOf<E>;
+
+            static constexpr bool kAddressable = Addressable<E>;
+
+            constexpr explicit Reordered(E &&expr) : mExpr(std::forward<E>(expr)) {}
+
+            [[nodiscard]] constexpr value_type Eval(const size_t i, const size_t j) const {
+                return mExpr.Eval(j, i);
+            }
+
+            /// reads the operand at swapped indices, so any overlap with the destination aliases
+            [[nodiscard]] constexpr bool MayAlias(const void *begin, const void *end, bool) const noexcept {
+                return Expr::MayAlias(mExpr, begin, end, true);
+            }
+
+        private:
+            Stored<E> mExpr;
+        };
+    }
+
+    template<class E> requires Expr::MatrixExpression<E>
+    [[nodiscard]] constexpr auto Transpose(E &&m) {
+        return Expr::Transposed<E>(std::forward<E>(m));
+    }
+
+    /**
+     * A row major matrix read as column major, e.g. to pass an RMatrix where a CMatrix is expected
+     */
+    template<class E> requires Expr::RowMajorExpression<E>
+    [[nodiscard]] constexpr auto AsColumnMajor(E &&m) {
+        return Expr::Reordered<E>(std::forward<E>(m));
+    }
+
+    template<class E> requires Expr::ColumnMajorExpression<E>
+    [[nodiscard]] constexpr auto AsRowMajor(E &&m) {
+        return Expr::Reordered<E>(std::forward<E>(m));
+    }
+
+    /**
+     * Row r of an RMatrix, CMatrix or matrix view
+     */
+    template<class M> requires Expr::MatrixExpression<M>
+    [[nodiscard]] constexpr auto Row(M &m, const size_t r) noexcept {
+        using Shape = Expr::ShapeOf<M>;
+        using T = Detail::ElementOf<M>;
+        using Slice = Expr::RowVector<Shape::cols>;
+        const size_t outer = Detail::OuterStrideOf(m);
+        const size_t inner = Detail::InnerStrideOf(m);
+        if constexpr (Expr::IsRowMajor<Shape>::value) {
+            return Detail::MakeVectorView<Slice, T, Detail::kInnerStrideOf<M>>(Detail::OriginOf(m) + r * outer, inner);
+        } else {
+            return Detail::MakeVectorView<Slice, T, Detail::kOuterStrideOf<M>>(Detail::OriginOf(m) + r * inner, outer);
+        }
+    }
+
+    /**
+     * Column c of an RMatrix, CMatrix or matrix view
+     */
+    template<class M> requires Expr::MatrixExpression<M>
+    [[nodiscard]] constexpr auto Column(M &m, const size_t c) noexcept {
+        using Shape = Expr::ShapeOf<M>;
+        using T = Detail::ElementOf<M>;
+        using Slice = Expr::ColumnVector<Shape::rows>;
+        const size_t outer = Detail::OuterStrideOf(m);
+        const size_t inner = Detail::InnerStrideOf(m);
+        if constexpr (Expr::IsRowMajor<Shape>::value) {
+            return Detail::MakeVectorView<Slice, T, Detail::kOuterStrideOf<M>>(Detail::OriginOf(m) + c * inner, outer);
+        } else {
+            return Detail::MakeVectorView<Slice, T, Detail::kInnerStrideOf<M>>(Detail::OriginOf(m) + c * outer, inner);
+        }
+    }
+
+    /**
+     * The rows x cols submatrix of an RMatrix, CMatrix or matrix view whose top left element is at
+     * row r0 and column c0. The view keeps the storage order of m.
+     */
+    template<int rows, int cols, class M> requires Expr::MatrixExpression<M>
+    [[nodiscard]] constexpr auto Block(M &m, const size_t r0, const size_t c0) noexcept {
+        using Shape = Expr::ShapeOf<M>;
+        static_assert(rows <= Shape::rows && cols <= Shape::cols, "block is larger than the matrix");
+        using T = Detail::ElementOf<M>;
+        using BlockShape = std::conditional_t<Expr::IsRowMajor<Shape>::value,
+                Expr::RowMajor<rows, cols>, Expr::ColumnMajor<cols, rows>>;
+        const size_t outer = Detail::OuterStrideOf(m);
+        const size_t inner = Detail::InnerStrideOf(m);
+        const size_t offset = Expr::IsRowMajor<Shape>::value ? r0 * outer + c0 * inner : c0 * outer + r0 * inner;
+        return Detail::MakeMatrixView<BlockShape, T, Detail::kOuterStrideOf<M>, Detail::kInnerStrideOf<M>>(
+                Detail::OriginOf(m) + offset, outer, inner);
+    }
+
+    /**
+     * n consecutive elements of an RVector, CVector or vector view starting at offset
+     */
+    template<int n, class V> requires Expr::VectorExpression<V>
+    [[nodiscard]] constexpr auto Segment(V &v, const size_t offset) noexcept {
+        using Shape = Expr::ShapeOf<V>;
+        static_assert(n <= Shape::length, "segment is longer than the vector");
+        using T = Detail::ElementOf<V>;
+        using SegmentShape = std::conditional_t<Expr::IsColumnVector<Shape>::value,
+                Expr::ColumnVector<n>, Expr::RowVector<n>>;
+        const size_t stride = Detail::InnerStrideOf(v);
+        return Detail::MakeVectorView<SegmentShape, T, Detail::kInnerStrideOf<V>>(Detail::OriginOf(v) + offset * stride,
+                                                                                 stride);
+    }
+}
+
+#endif //DRAWING_VIEW_H
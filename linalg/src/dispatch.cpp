@@ -0,0 +1,699 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include "linalg/dispatch.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <stdexcept>
+
+#if defined(QS_LINALG_DISPATCH) && defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+// compiles one function for an instruction set above the build's target flags. MSVC needs no
+// annotation to emit any intrinsic.
+#if defined(__GNUC__)
+#define QS_LINALG_TARGET(isa) __attribute__((target(isa)))
+#else
+#define QS_LINALG_TARGET(isa)
+#endif
+
+namespace QS::LinAlg::Dispatch {
+
+    namespace {
+        float ScalarDot(const float *lhs, const float *rhs, const size_t n) noexcept {
+            return Simd::Dot<float>(lhs, rhs, n);
+        }
+
+        float ScalarSum(const float *in, const size_t n) noexcept {
+            return Simd::Sum<float>(in, n);
+        }
+
+        void ScalarAxpy(const float alpha, const float *x, float *y, const size_t n) noexcept {
+            Simd::Axpy<float>(alpha, x, y, n);
+        }
+
+        /**
+         * Transforms vertices [begin, end) one at a time. The first components values of each vertex
+         * are read, a missing w is taken as w, and the first components values of the result are
+         * written. Also finishes the vertices the vector tiers leave over.
+         */
+        template<int components>
+        void ScalarTransform(const float *m, const float w, const float *in, const size_t inStride, float *out,
+                             const size_t outStride, size_t begin, const size_t end) noexcept {
+            // m is column major: element (row r, col c) is m[c * 4 + r]
+            for (; begin < end; ++begin) {
+                const float *v = in + begin * inStride;
+                const float vw = components == 4 ? v[3] : w;
+                float result[components];
+                for (int r = 0; r < components; ++r) {
+                    result[r] = m[r] * v[0] + m[4 + r] * v[1] + m[8 + r] * v[2] + m[12 + r] * vw;
+                }
+                for (int r = 0; r < components; ++r) {
+                    out[begin * outStride + r] = result[r];
+                }
+            }
+        }
+
+        void ScalarTransform3(const float *m, const float w, const float *in, const size_t inStride, float *out,
+                              const size_t outStride, const size_t begin, const size_t end) noexcept {
+            ScalarTransform<3>(m, w, in, inStride, out, outStride, begin, end);
+        }
+
+        void ScalarTransform4(const float *m, const float *in, const size_t inStride, float *out,
+                              const size_t outStride, const size_t begin, const size_t end) noexcept {
+            ScalarTransform<4>(m, 0.0f, in, inStride, out, outStride, begin, end);
+        }
+
+        /**
+         * The gemm micro kernel for a rows x cols tile, one multiply add at a time
+         */
+        template<size_t rows, size_t cols>
+        void ScalarGemm(const size_t k, const float *a, const float *b, float *tile) noexcept {
+            float acc[rows][cols] = {};
+            for (size_t p = 0; p < k; ++p, a += rows, b += cols) {
+                for (size_t r = 0; r < rows; ++r) {
+                    for (size_t s = 0; s < cols; ++s) {
+                        acc[r][s] += a[r] * b[s];
+                    }
+                }
+            }
+            for (size_t r = 0; r < rows; ++r) {
+                for (size_t s = 0; s < cols; ++s) {
+                    tile[r * cols + s] = acc[r][s];
+                }
+            }
+        }
+
+        float ScalarSparseDot(const float *values, const uint32_t *indices, const size_t count,
+                              const float *x) noexcept {
+            float out = 0.0f;
+            for (size_t k = 0; k < count; ++k) {
+                out += values[k] * x[indices[k]];
+            }
+            return out;
+        }
+
+        constexpr Kernels kScalar = {Tier::Scalar, ScalarDot, ScalarSum, ScalarAxpy, ScalarTransform3,
+                                     ScalarTransform4, 4, 4, ScalarGemm<4, 4>, ScalarSparseDot};
+
+#ifdef QS_LINALG_DISPATCH
+        // SSE, the x86-64 baseline
+
+        // the reductions keep Simd::kAccumulators registers of partial sums, so successive adds do not
+        // wait on each other, and fold them together once at the end
+
+        float SseDot(const float *lhs, const float *rhs, const size_t n) noexcept {
+            __m128 acc0 = _mm_setzero_ps(), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(lhs + i), _mm_loadu_ps(rhs + i)));
+                acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(lhs + i + 4), _mm_loadu_ps(rhs + i + 4)));
+                acc2 = _mm_add_ps(acc2, _mm_mul_ps(_mm_loadu_ps(lhs + i + 8), _mm_loadu_ps(rhs + i + 8)));
+                acc3 = _mm_add_ps(acc3, _mm_mul_ps(_mm_loadu_ps(lhs + i + 12), _mm_loadu_ps(rhs + i + 12)));
+            }
+            for (; i + 4 <= n; i += 4) {
+                acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(lhs + i), _mm_loadu_ps(rhs + i)));
+            }
+            float out = Simd::Detail::HorizontalSum(_mm_add_ps(_mm_add_ps(acc0, acc1), _mm_add_ps(acc2, acc3)));
+            for (; i < n; ++i) {
+                out += lhs[i] * rhs[i];
+            }
+            return out;
+        }
+
+        float SseSum(const float *in, const size_t n) noexcept {
+            __m128 acc0 = _mm_setzero_ps(), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                acc0 = _mm_add_ps(acc0, _mm_loadu_ps(in + i));
+                acc1 = _mm_add_ps(acc1, _mm_loadu_ps(in + i + 4));
+                acc2 = _mm_add_ps(acc2, _mm_loadu_ps(in + i + 8));
+                acc3 = _mm_add_ps(acc3, _mm_loadu_ps(in + i + 12));
+            }
+            for (; i + 4 <= n; i += 4) {
+                acc0 = _mm_add_ps(acc0, _mm_loadu_ps(in + i));
+            }
+            float out = Simd::Detail::HorizontalSum(_mm_add_ps(_mm_add_ps(acc0, acc1), _mm_add_ps(acc2, acc3)));
+            for (; i < n; ++i) {
+                out += in[i];
+            }
+            return out;
+        }
+
+        void SseAxpy(const float alpha, const float *x, float *y, const size_t n) noexcept {
+            const __m128 a = _mm_set1_ps(alpha);
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(a, _mm_loadu_ps(x + i))));
+            }
+            for (; i < n; ++i) {
+                y[i] += alpha * x[i];
+            }
+        }
+
+        /**
+         * Reads four vertices starting at v into lanes, one component per register
+         */
+        inline void LoadLanes(const float *v, const size_t stride, __m128 lanes[4]) noexcept {
+            const float *v0 = v;
+            const float *v1 = v0 + stride;
+            const float *v2 = v1 + stride;
+            const float *v3 = v2 + stride;
+            if (stride >= 4) {
+                lanes[0] = _mm_loadu_ps(v0);
+                lanes[1] = _mm_loadu_ps(v1);
+                lanes[2] = _mm_loadu_ps(v2);
+                lanes[3] = _mm_loadu_ps(v3);
+                _MM_TRANSPOSE4_PS(lanes[0], lanes[1], lanes[2], lanes[3]);
+            } else {
+                for (int c = 0; c < 3; ++c) {
+                    lanes[c] = _mm_setr_ps(v0[c], v1[c], v2[c], v3[c]);
+                }
+                lanes[3] = _mm_setzero_ps();
+            }
+        }
+
+        /**
+         * Writes the first components registers of result to four vertices starting at o. Whole
+         * vertices are stored when all four components are written, the rest one value at a time
+         * so the attributes after them are left alone.
+         */
+        template<int components>
+        void StoreLanes(__m128 result[4], float *o, const size_t stride) noexcept {
+            if constexpr (components == 4) {
+                if (stride >= 4) {
+                    _MM_TRANSPOSE4_PS(result[0], result[1], result[2], result[3]);
+                    for (int k = 0; k < 4; ++k) {
+                        _mm_storeu_ps(o + k * stride, result[k]);
+                    }
+                    return;
+                }
+            }
+            alignas(16) float values[components][4];
+            for (int r = 0; r < components; ++r) {
+                _mm_store_ps(values[r], result[r]);
+            }
+            for (int k = 0; k < 4; ++k) {
+                for (int r = 0; r < components; ++r) {
+                    o[k * stride + r] = values[r][k];
+                }
+            }
+        }
+
+        /**
+         * ScalarTransform four vertices at a time
+         */
+        template<int components>
+        void SseTransform(const float *m, const float w, const float *in, const size_t inStride, float *out,
+                          const size_t outStride, size_t begin, const size_t end) noexcept {
+            __m128 col[4][4];
+            for (int c = 0; c < 4; ++c) {
+                for (int r = 0; r < 4; ++r) {
+                    col[c][r] = _mm_set1_ps(m[c * 4 + r]);
+                }
+            }
+            for (; begin + 4 <= end; begin += 4) {
+                __m128 lanes[4];
+                LoadLanes(in + begin * inStride, inStride, lanes);
+                if constexpr (components == 3) {
+                    lanes[3] = _mm_set1_ps(w);
+                }
+                __m128 result[4];
+                for (int r = 0; r < components; ++r) {
+                    __m128 acc = _mm_mul_ps(col[0][r], lanes[0]);
+                    acc = _mm_add_ps(acc, _mm_mul_ps(col[1][r], lanes[1]));
+                    acc = _mm_add_ps(acc, _mm_mul_ps(col[2][r], lanes[2]));
+                    acc = _mm_add_ps(acc, _mm_mul_ps(col[3][r], lanes[3]));
+                    result[r] = acc;
+                }
+                StoreLanes<components>(result, out + begin * outStride, outStride);
+            }
+            ScalarTransform<components>(m, w, in, inStride, out, outStride, begin, end);
+        }
+
+        void SseTransform3(const float *m, const float w, const float *in, const size_t inStride, float *out,
+                           const size_t outStride, const size_t begin, const size_t end) noexcept {
+            SseTransform<3>(m, w, in, inStride, out, outStride, begin, end);
+        }
+
+        void SseTransform4(const float *m, const float *in, const size_t inStride, float *out,
+                           const size_t outStride, const size_t begin, const size_t end) noexcept {
+            SseTransform<4>(m, 0.0f, in, inStride, out, outStride, begin, end);
+        }
+
+        // the gemm micro kernels hold a 4 row tile of two registers per row, eight independent sums,
+        // and broadcast one element of a against a row of b per multiply
+
+        void SseGemm(const size_t k, const float *a, const float *b, float *tile) noexcept {
+            __m128 acc[4][2];
+            for (int r = 0; r < 4; ++r) {
+                acc[r][0] = acc[r][1] = _mm_setzero_ps();
+            }
+            for (size_t p = 0; p < k; ++p, a += 4, b += 8) {
+                const __m128 b0 = _mm_loadu_ps(b);
+                const __m128 b1 = _mm_loadu_ps(b + 4);
+                for (int r = 0; r < 4; ++r) {
+                    const __m128 ar = _mm_set1_ps(a[r]);
+                    acc[r][0] = _mm_add_ps(acc[r][0], _mm_mul_ps(ar, b0));
+                    acc[r][1] = _mm_add_ps(acc[r][1], _mm_mul_ps(ar, b1));
+                }
+            }
+            for (int r = 0; r < 4; ++r) {
+                _mm_storeu_ps(tile + r * 8, acc[r][0]);
+                _mm_storeu_ps(tile + r * 8 + 4, acc[r][1]);
+            }
+        }
+
+        // the sparse dot products load x through the 32 bit indices, which the gathers of the wider
+        // tiers read as signed, hence SparseMatrix::kMaxInner
+
+        float SseSparseDot(const float *values, const uint32_t *indices, const size_t count, const float *x) noexcept {
+            // without a gather instruction the loads stay scalar, but the products still fill a register
+            __m128 sum = _mm_setzero_ps();
+            size_t k = 0;
+            for (; k + 4 <= count; k += 4) {
+                const __m128 gathered = _mm_setr_ps(x[indices[k]], x[indices[k + 1]], x[indices[k + 2]],
+                                                    x[indices[k + 3]]);
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(values + k), gathered));
+            }
+            float out = Simd::Detail::HorizontalSum(sum);
+            for (; k < count; ++k) {
+                out += values[k] * x[indices[k]];
+            }
+            return out;
+        }
+
+        constexpr Kernels kSse = {Tier::Sse, SseDot, SseSum, SseAxpy, SseTransform3, SseTransform4, 4, 8, SseGemm,
+                                  SseSparseDot};
+
+        // AVX2 and FMA
+
+        QS_LINALG_TARGET("avx2,fma")
+        float HorizontalSum(const __m256 v) noexcept {
+            return Simd::Detail::HorizontalSum(_mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1)));
+        }
+
+        QS_LINALG_TARGET("avx2,fma")
+        float Avx2Dot(const float *lhs, const float *rhs, const size_t n) noexcept {
+            __m256 acc0 = _mm256_setzero_ps(), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+            size_t i = 0;
+            for (; i + 32 <= n; i += 32) {
+                acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(lhs + i), _mm256_loadu_ps(rhs + i), acc0);
+                acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(lhs + i + 8), _mm256_loadu_ps(rhs + i + 8), acc1);
+                acc2 = _mm256_fmadd_ps(_mm256_loadu_ps(lhs + i + 16), _mm256_loadu_ps(rhs + i + 16), acc2);
+                acc3 = _mm256_fmadd_ps(_mm256_loadu_ps(lhs + i + 24), _mm256_loadu_ps(rhs + i + 24), acc3);
+            }
+            for (; i + 8 <= n; i += 8) {
+                acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(lhs + i), _mm256_loadu_ps(rhs + i), acc0);
+            }
+            float out = HorizontalSum(_mm256_add_ps(_mm256_add_ps(acc0, acc1), _mm256_add_ps(acc2, acc3)));
+            for (; i < n; ++i) {
+                out += lhs[i] * rhs[i];
+            }
+            return out;
+        }
+
+        QS_LINALG_TARGET("avx2,fma")
+        float Avx2Sum(const float *in, const size_t n) noexcept {
+            __m256 acc0 = _mm256_setzero_ps(), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+            size_t i = 0;
+            for (; i + 32 <= n; i += 32) {
+                acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(in + i));
+                acc1 = _mm256_add_ps(acc1, _mm256_loadu_ps(in + i + 8));
+                acc2 = _mm256_add_ps(acc2, _mm256_loadu_ps(in + i + 16));
+                acc3 = _mm256_add_ps(acc3, _mm256_loadu_ps(in + i + 24));
+            }
+            for (; i + 8 <= n; i += 8) {
+                acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(in + i));
+            }
+            float out = HorizontalSum(_mm256_add_ps(_mm256_add_ps(acc0, acc1), _mm256_add_ps(acc2, acc3)));
+            for (; i < n; ++i) {
+                out += in[i];
+            }
+            return out;
+        }
+
+        QS_LINALG_TARGET("avx2,fma")
+        void Avx2Axpy(const float alpha, const float *x, float *y, const size_t n) noexcept {
+            const __m256 a = _mm256_set1_ps(alpha);
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                _mm256_storeu_ps(y + i, _mm256_fmadd_ps(a, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i)));
+            }
+            for (; i < n; ++i) {
+                y[i] += alpha * x[i];
+            }
+        }
+
+        /**
+         * SseTransform eight vertices at a time, loaded and stored as two groups of four
+         */
+        template<int components>
+        QS_LINALG_TARGET("avx2,fma")
+        void Avx2Transform(const float *m, const float w, const float *in, const size_t inStride, float *out,
+                           const size_t outStride, size_t begin, const size_t end) noexcept {
+            __m256 col[4][4];
+            for (int c = 0; c < 4; ++c) {
+                for (int r = 0; r < 4; ++r) {
+                    col[c][r] = _mm256_set1_ps(m[c * 4 + r]);
+                }
+            }
+            for (; begin + 8 <= end; begin += 8) {
+                __m128 low[4];
+                __m128 high[4];
+                LoadLanes(in + begin * inStride, inStride, low);
+                LoadLanes(in + (begin + 4) * inStride, inStride, high);
+                __m256 lanes[4];
+                for (int c = 0; c < 4; ++c) {
+                    lanes[c] = _mm256_insertf128_ps(_mm256_castps128_ps256(low[c]), high[c], 1);
+                }
+                if constexpr (components == 3) {
+                    lanes[3] = _mm256_set1_ps(w);
+                }
+                for (int r = 0; r < components; ++r) {
+                    __m256 acc = _mm256_mul_ps(col[0][r], lanes[0]);
+                    acc = _mm256_fmadd_ps(col[1][r], lanes[1], acc);
+                    acc = _mm256_fmadd_ps(col[2][r], lanes[2], acc);
+                    acc = _mm256_fmadd_ps(col[3][r], lanes[3], acc);
+                    low[r] = _mm256_castps256_ps128(acc);
+                    high[r] = _mm256_extractf128_ps(acc, 1);
+                }
+                StoreLanes<components>(low, out + begin * outStride, outStride);
+                StoreLanes<components>(high, out + (begin + 4) * outStride, outStride);
+            }
+            SseTransform<components>(m, w, in, inStride, out, outStride, begin, end);
+        }
+
+        void Avx2Transform3(const float *m, const float w, const float *in, const size_t inStride, float *out,
+                            const size_t outStride, const size_t begin, const size_t end) noexcept {
+            Avx2Transform<3>(m, w, in, inStride, out, outStride, begin, end);
+        }
+
+        void Avx2Transform4(const float *m, const float *in, const size_t inStride, float *out,
+                            const size_t outStride, const size_t begin, const size_t end) noexcept {
+            Avx2Transform<4>(m, 0.0f, in, inStride, out, outStride, begin, end);
+        }
+
+        QS_LINALG_TARGET("avx2,fma")
+        void Avx2Gemm(const size_t k, const float *a, const float *b, float *tile) noexcept {
+            __m256 acc[4][2];
+            for (int r = 0; r < 4; ++r) {
+                acc[r][0] = acc[r][1] = _mm256_setzero_ps();
+            }
+            for (size_t p = 0; p < k; ++p, a += 4, b += 16) {
+                const __m256 b0 = _mm256_loadu_ps(b);
+                const __m256 b1 = _mm256_loadu_ps(b + 8);
+                for (int r = 0; r < 4; ++r) {
+                    const __m256 ar = _mm256_set1_ps(a[r]);
+                    acc[r][0] = _mm256_fmadd_ps(ar, b0, acc[r][0]);
+                    acc[r][1] = _mm256_fmadd_ps(ar, b1, acc[r][1]);
+                }
+            }
+            for (int r = 0; r < 4; ++r) {
+                _mm256_storeu_ps(tile + r * 16, acc[r][0]);
+                _mm256_storeu_ps(tile + r * 16 + 8, acc[r][1]);
+            }
+        }
+
+        QS_LINALG_TARGET("avx2,fma")
+        float Avx2SparseDot(const float *values, const uint32_t *indices, const size_t count,
+                            const float *x) noexcept {
+            // two independent accumulators hide the latency of the gathers
+            __m256 sum0 = _mm256_setzero_ps();
+            __m256 sum1 = _mm256_setzero_ps();
+            size_t k = 0;
+            for (; k + 16 <= count; k += 16) {
+                const __m256i i0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices + k));
+                const __m256i i1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices + k + 8));
+                sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(values + k), _mm256_i32gather_ps(x, i0, 4), sum0);
+                sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(values + k + 8), _mm256_i32gather_ps(x, i1, 4), sum1);
+            }
+            for (; k + 8 <= count; k += 8) {
+                const __m256i i0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices + k));
+                sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(values + k), _mm256_i32gather_ps(x, i0, 4), sum0);
+            }
+            float out = HorizontalSum(_mm256_add_ps(sum0, sum1));
+            for (; k < count; ++k) {
+                out += values[k] * x[indices[k]];
+            }
+            return out;
+        }
+
+        constexpr Kernels kAvx2 = {Tier::Avx2, Avx2Dot, Avx2Sum, Avx2Axpy, Avx2Transform3, Avx2Transform4, 4, 16,
+                                   Avx2Gemm, Avx2SparseDot};
+
+        // AVX-512, whose masked loads and stores also handle the remainder
+
+        QS_LINALG_TARGET("avx512f")
+        __mmask16 TailMask(const size_t remaining) noexcept {
+            return static_cast<__mmask16>((1u << remaining) - 1u);
+        }
+
+        /**
+         * Sum of the lanes of v. _mm512_reduce_add_ps and the casts to a 256 bit half leave the upper
+         * half of an intermediate undefined, which GCC reports as an uninitialized read, and the
+         * 32 bit lane extract needs AVX-512 DQ, so the halves are taken as doubles.
+         */
+        QS_LINALG_TARGET("avx512f")
+        float HorizontalSum(const __m512 v) noexcept {
+            const __m512d d = _mm512_castps_pd(v);
+            return HorizontalSum(_mm256_add_ps(_mm256_castpd_ps(_mm512_maskz_extractf64x4_pd(0xF, d, 0)),
+                                               _mm256_castpd_ps(_mm512_maskz_extractf64x4_pd(0xF, d, 1))));
+        }
+
+        QS_LINALG_TARGET("avx512f")
+        float Avx512Dot(const float *lhs, const float *rhs, const size_t n) noexcept {
+            __m512 acc0 = _mm512_setzero_ps(), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+            size_t i = 0;
+            for (; i + 64 <= n; i += 64) {
+                acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(lhs + i), _mm512_loadu_ps(rhs + i), acc0);
+                acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(lhs + i + 16), _mm512_loadu_ps(rhs + i + 16), acc1);
+                acc2 = _mm512_fmadd_ps(_mm512_loadu_ps(lhs + i + 32), _mm512_loadu_ps(rhs + i + 32), acc2);
+                acc3 = _mm512_fmadd_ps(_mm512_loadu_ps(lhs + i + 48), _mm512_loadu_ps(rhs + i + 48), acc3);
+            }
+            for (; i + 16 <= n; i += 16) {
+                acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(lhs + i), _mm512_loadu_ps(rhs + i), acc0);
+            }
+            if (i < n) {
+                const __mmask16 mask = TailMask(n - i);
+                acc1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, lhs + i), _mm512_maskz_loadu_ps(mask, rhs + i),
+                                       acc1);
+            }
+            return HorizontalSum(_mm512_add_ps(_mm512_add_ps(acc0, acc1), _mm512_add_ps(acc2, acc3)));
+        }
+
+        QS_LINALG_TARGET("avx512f")
+        float Avx512Sum(const float *in, const size_t n) noexcept {
+            __m512 acc0 = _mm512_setzero_ps(), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+            size_t i = 0;
+            for (; i + 64 <= n; i += 64) {
+                acc0 = _mm512_add_ps(acc0, _mm512_loadu_ps(in + i));
+                acc1 = _mm512_add_ps(acc1, _mm512_loadu_ps(in + i + 16));
+                acc2 = _mm512_add_ps(acc2, _mm512_loadu_ps(in + i + 32));
+                acc3 = _mm512_add_ps(acc3, _mm512_loadu_ps(in + i + 48));
+            }
+            for (; i + 16 <= n; i += 16) {
+                acc0 = _mm512_add_ps(acc0, _mm512_loadu_ps(in + i));
+            }
+            if (i < n) {
+                acc1 = _mm512_add_ps(acc1, _mm512_maskz_loadu_ps(TailMask(n - i), in + i));
+            }
+            return HorizontalSum(_mm512_add_ps(_mm512_add_ps(acc0, acc1), _mm512_add_ps(acc2, acc3)));
+        }
+
+        QS_LINALG_TARGET("avx512f")
+        void Avx512Axpy(const float alpha, const float *x, float *y, const size_t n) noexcept {
+            const __m512 a = _mm512_set1_ps(alpha);
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                _mm512_storeu_ps(y + i, _mm512_fmadd_ps(a, _mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i)));
+            }
+            if (i < n) {
+                const __mmask16 mask = TailMask(n - i);
+                _mm512_mask_storeu_ps(y + i, mask, _mm512_fmadd_ps(a, _mm512_maskz_loadu_ps(mask, x + i),
+                                                                   _mm512_maskz_loadu_ps(mask, y + i)));
+            }
+        }
+
+        QS_LINALG_TARGET("avx512f")
+        void Avx512Gemm(const size_t k, const float *a, const float *b, float *tile) noexcept {
+            __m512 acc[4][2];
+            for (int r = 0; r < 4; ++r) {
+                acc[r][0] = acc[r][1] = _mm512_setzero_ps();
+            }
+            for (size_t p = 0; p < k; ++p, a += 4, b += 32) {
+                const __m512 b0 = _mm512_loadu_ps(b);
+                const __m512 b1 = _mm512_loadu_ps(b + 16);
+                for (int r = 0; r < 4; ++r) {
+                    const __m512 ar = _mm512_set1_ps(a[r]);
+                    acc[r][0] = _mm512_fmadd_ps(ar, b0, acc[r][0]);
+                    acc[r][1] = _mm512_fmadd_ps(ar, b1, acc[r][1]);
+                }
+            }
+            for (int r = 0; r < 4; ++r) {
+                _mm512_storeu_ps(tile + r * 32, acc[r][0]);
+                _mm512_storeu_ps(tile + r * 32 + 16, acc[r][1]);
+            }
+        }
+
+        /**
+         * x[indices[l]] in every lane l of mask and zero in the others. The unmasked gather starts from
+         * an undefined register, which GCC reports like _mm512_reduce_add_ps.
+         */
+        QS_LINALG_TARGET("avx512f")
+        __m512 Gather(const __mmask16 mask, const __m512i indices, const float *x) noexcept {
+            return _mm512_mask_i32gather_ps(_mm512_setzero_ps(), mask, indices, x, 4);
+        }
+
+        QS_LINALG_TARGET("avx512f")
+        float Avx512SparseDot(const float *values, const uint32_t *indices, const size_t count,
+                              const float *x) noexcept {
+            constexpr __mmask16 all = 0xFFFF;
+            __m512 sum0 = _mm512_setzero_ps();
+            __m512 sum1 = _mm512_setzero_ps();
+            size_t k = 0;
+            for (; k + 32 <= count; k += 32) {
+                const __m512i i0 = _mm512_loadu_si512(indices + k);
+                const __m512i i1 = _mm512_loadu_si512(indices + k + 16);
+                sum0 = _mm512_fmadd_ps(_mm512_loadu_ps(values + k), Gather(all, i0, x), sum0);
+                sum1 = _mm512_fmadd_ps(_mm512_loadu_ps(values + k + 16), Gather(all, i1, x), sum1);
+            }
+            for (; k + 16 <= count; k += 16) {
+                const __m512i i0 = _mm512_loadu_si512(indices + k);
+                sum0 = _mm512_fmadd_ps(_mm512_loadu_ps(values + k), Gather(all, i0, x), sum0);
+            }
+            if (k < count) {
+                // masked off lanes neither load an index nor gather
+                const __mmask16 mask = TailMask(count - k);
+                const __m512i i1 = _mm512_maskz_loadu_epi32(mask, indices + k);
+                sum1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, values + k), Gather(mask, i1, x), sum1);
+            }
+            return HorizontalSum(_mm512_add_ps(sum0, sum1));
+        }
+
+        // the transforms are bound by their shuffles, which AVX-512 does not make cheaper
+        constexpr Kernels kAvx512 = {Tier::Avx512, Avx512Dot, Avx512Sum, Avx512Axpy, Avx2Transform3, Avx2Transform4,
+                                     4, 32, Avx512Gemm, Avx512SparseDot};
+#endif
+
+        Tier Detect() noexcept {
+#if !defined(QS_LINALG_DISPATCH)
+            return Tier::Scalar;
+#elif defined(__GNUC__)
+            // also checks that the operating system saves the wider registers
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f")) {
+                return Tier::Avx512;
+            }
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+                return Tier::Avx2;
+            }
+            return Tier::Sse;
+#else
+            int info[4];
+            __cpuid(info, 0);
+            const int leaves = info[0];
+            __cpuid(info, 1);
+            const bool fma = (info[2] & (1 << 12)) != 0;
+            const bool osxsave = (info[2] & (1 << 27)) != 0;
+            if (!osxsave || leaves < 7) {
+                return Tier::Sse;
+            }
+            // the operating system saves the ymm (bits 1, 2) and zmm (bits 5 to 7) state
+            const unsigned long long xcr0 = _xgetbv(0);
+            __cpuidex(info, 7, 0);
+            const bool avx2 = (info[1] & (1 << 5)) != 0;
+            const bool avx512 = (info[1] & (1 << 16)) != 0;
+            if (avx512 && (xcr0 & 0xe6) == 0xe6) {
+                return Tier::Avx512;
+            }
+            if (avx2 && fma && (xcr0 & 0x6) == 0x6) {
+                return Tier::Avx2;
+            }
+            return Tier::Sse;
+#endif
+        }
+
+        const Kernels &KernelsFor(const Tier tier) noexcept {
+            switch (tier) {
+#ifdef QS_LINALG_DISPATCH
+                case Tier::Sse:
+                    return kSse;
+                case Tier::Avx2:
+                    return kAvx2;
+                case Tier::Avx512:
+                    return kAvx512;
+#endif
+                default:
+                    return kScalar;
+            }
+        }
+
+        /**
+         * The detected tier, lowered by QS_LINALG_TIER
+         */
+        Tier InitialTier() noexcept {
+            const Tier supported = GetSupportedTier();
+            if (const char *value = std::getenv(kTierVariable)) {
+                if (const std::optional<Tier> forced = ParseTier(value)) {
+                    return *forced < supported ? *forced : supported;
+                }
+            }
+            return supported;
+        }
+
+        std::atomic<const Kernels *> &Active() noexcept {
+            static std::atomic<const Kernels *> active{&KernelsFor(InitialTier())};
+            return active;
+        }
+
+        // detect during static initialization rather than inside the first timed kernel
+        [[maybe_unused]] const bool kDetected = Active().load() != nullptr;
+    }
+
+    Tier GetSupportedTier() noexcept {
+        static const Tier supported = Detect();
+        return supported;
+    }
+
+    Tier GetTier() noexcept {
+        return GetKernels().tier;
+    }
+
+    void SetTier(const Tier tier) {
+        if (tier > GetSupportedTier()) {
+            throw std::invalid_argument("instruction set tier not supported by this cpu or build");
+        }
+        Active().store(&KernelsFor(tier), std::memory_order_release);
+    }
+
+    const Kernels &GetKernels() noexcept {
+        return *Active().load(std::memory_order_acquire);
+    }
+
+    const char *GetTierName(const Tier tier) noexcept {
+        switch (tier) {
+            case Tier::Scalar:
+                return "scalar";
+            case Tier::Sse:
+                return "sse";
+            case Tier::Avx2:
+                return "avx2";
+            case Tier::Avx512:
+                return "avx512";
+        }
+        return "unknown";
+    }
+
+    std::optional<Tier> ParseTier(const std::string_view name) noexcept {
+        for (const Tier tier: {Tier::Scalar, Tier::Sse, Tier::Avx2, Tier::Avx512}) {
+            if (name == GetTierName(tier)) {
+                return tier;
+            }
+        }
+        return std::nullopt;
+    }
+}
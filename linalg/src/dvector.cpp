@@ -0,0 +1,5 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include "linalg/dvector.h"
@@ -0,0 +1,151 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include "linalg/eigen.h"
+
+#include "linalg/simd.h"
+
+namespace QS::LinAlg {
+
+    namespace {
+#ifdef QS_LINALG_SSE
+        /**
+         * Four floats, one per matrix, with the lane operations the 3x3 kernels use. Comparisons
+         * return all-ones masks for Select.
+         */
+        struct Lanes {
+            Lanes() noexcept : v{_mm_setzero_ps()} {}
+
+            Lanes(const __m128 value) noexcept : v{value} {}
+
+            Lanes(const float value) noexcept : v{_mm_set1_ps(value)} {}
+
+            __m128 v;
+        };
+
+        inline Lanes operator+(const Lanes a, const Lanes b) noexcept { return _mm_add_ps(a.v, b.v); }
+
+        inline Lanes operator-(const Lanes a, const Lanes b) noexcept { return _mm_sub_ps(a.v, b.v); }
+
+        inline Lanes operator*(const Lanes a, const Lanes b) noexcept { return _mm_mul_ps(a.v, b.v); }
+
+        inline Lanes operator/(const Lanes a, const Lanes b) noexcept { return _mm_div_ps(a.v, b.v); }
+
+        inline Lanes operator-(const Lanes a) noexcept { return _mm_xor_ps(a.v, _mm_set1_ps(-0.0f)); }
+
+        inline Lanes operator<(const Lanes a, const Lanes b) noexcept { return _mm_cmplt_ps(a.v, b.v); }
+
+        inline Lanes operator==(const Lanes a, const Lanes b) noexcept { return _mm_cmpeq_ps(a.v, b.v); }
+
+        inline Lanes Select(const Lanes mask, const Lanes a, const Lanes b) noexcept {
+            return _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v));
+        }
+
+        inline Lanes Sqrt(const Lanes a) noexcept { return _mm_sqrt_ps(a.v); }
+
+        inline Lanes Abs(const Lanes a) noexcept { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a.v); }
+
+        template<int length>
+        void LoadLanes(const VectorArray<length, float> &array, const size_t i, Lanes *out) noexcept {
+            for (size_t c = 0; c < length; ++c) {
+                out[c] = _mm_loadu_ps(array.GetLane(c) + i);
+            }
+        }
+
+        template<int length>
+        void StoreLanes(const Lanes *in, VectorArray<length, float> &array, const size_t i) noexcept {
+            for (size_t c = 0; c < length; ++c) {
+                _mm_storeu_ps(array.GetLane(c) + i, in[c].v);
+            }
+        }
+#endif
+
+        /// matrices per SIMD step
+#ifdef QS_LINALG_SSE
+        constexpr size_t kWidth = 4;
+#else
+        constexpr size_t kWidth = 1;
+#endif
+
+        /**
+         * Runs step(i) for every multiple i of kWidth up to count and scalar(i) for the rest, across
+         * the pool for large batches
+         */
+        template<typename Step, typename Scalar>
+        void ForEachMatrix(const size_t count, Step &&step, Scalar &&scalar) {
+            const size_t vectorized = count / kWidth;
+            Parallel::Apply(vectorized, [&](size_t begin, size_t end) {
+                for (size_t block = begin; block < end; ++block) {
+                    step(block * kWidth);
+                }
+            });
+            for (size_t i = vectorized * kWidth; i < count; ++i) {
+                scalar(i);
+            }
+        }
+    }
+
+    void BatchSymmetricEigen(const VectorArray<6, float> &matrices, VectorArray<3, float> &values,
+                             VectorArray<9, float> &vectors) {
+        values.Resize(matrices.GetSize());
+        vectors.Resize(matrices.GetSize());
+        const auto scalar = [&](size_t i) {
+            float a[6], l[3], v[9];
+            for (size_t c = 0; c < 6; ++c) {
+                a[c] = matrices.GetLane(c)[i];
+            }
+            Detail::SymmetricEigen3(a, l, v);
+            for (size_t c = 0; c < 3; ++c) {
+                values.GetLane(c)[i] = l[c];
+            }
+            for (size_t c = 0; c < 9; ++c) {
+                vectors.GetLane(c)[i] = v[c];
+            }
+        };
+#ifdef QS_LINALG_SSE
+        ForEachMatrix(matrices.GetSize(), [&](size_t i) {
+            Lanes a[6], l[3], v[9];
+            LoadLanes(matrices, i, a);
+            Detail::SymmetricEigen3(a, l, v);
+            StoreLanes(l, values, i);
+            StoreLanes(v, vectors, i);
+        }, scalar);
+#else
+        ForEachMatrix(matrices.GetSize(), scalar, scalar);
+#endif
+    }
+
+    void BatchSvd(const VectorArray<9, float> &matrices, VectorArray<9, float> &u, VectorArray<3, float> &sigma,
+                  VectorArray<9, float> &v) {
+        u.Resize(matrices.GetSize());
+        sigma.Resize(matrices.GetSize());
+        v.Resize(matrices.GetSize());
+        const auto scalar = [&](size_t i) {
+            float m[9], mu[9], s[3], mv[9];
+            for (size_t c = 0; c < 9; ++c) {
+                m[c] = matrices.GetLane(c)[i];
+            }
+            Detail::Svd3(m, mu, s, mv);
+            for (size_t c = 0; c < 9; ++c) {
+                u.GetLane(c)[i] = mu[c];
+                v.GetLane(c)[i] = mv[c];
+            }
+            for (size_t c = 0; c < 3; ++c) {
+                sigma.GetLane(c)[i] = s[c];
+            }
+        };
+#ifdef QS_LINALG_SSE
+        ForEachMatrix(matrices.GetSize(), [&](size_t i) {
+            Lanes m[9], mu[9], s[3], mv[9];
+            LoadLanes(matrices, i, m);
+            Detail::Svd3(m, mu, s, mv);
+            StoreLanes(mu, u, i);
+            StoreLanes(s, sigma, i);
+            StoreLanes(mv, v, i);
+        }, scalar);
+#else
+        ForEachMatrix(matrices.GetSize(), scalar, scalar);
+#endif
+    }
+}
@@ -0,0 +1,190 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include "linalg/packed.h"
+
+#include "linalg/simd.h"
+
+namespace QS::LinAlg {
+
+#ifdef QS_LINALG_SSE
+    namespace {
+        inline __m128i Select(const __m128i mask, const __m128i a, const __m128i b) noexcept {
+            return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+        }
+
+        /**
+         * Packs the low 16 bits of each 32 bit lane of a and b into one register, without the
+         * signed saturation of _mm_packs_epi32
+         */
+        inline __m128i Narrow(const __m128i a, const __m128i b) noexcept {
+            return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+        }
+
+#ifndef QS_LINALG_F16C
+        /**
+         * Detail::FloatToHalf on four lanes, the results in the low 16 bits of each 32 bit lane
+         */
+        __m128i FloatToHalf(const __m128 value) noexcept {
+            const __m128i bits = _mm_castps_si128(value);
+            const __m128i sign = _mm_and_si128(bits, _mm_set1_epi32(static_cast<int>(0x80000000u)));
+            const __m128i magnitude = _mm_xor_si128(bits, sign);
+
+            const __m128i isNan = _mm_cmpgt_epi32(magnitude, _mm_set1_epi32(255 << 23));
+            const __m128i isInfinite = _mm_cmpgt_epi32(magnitude, _mm_set1_epi32(((127 + 16) << 23) - 1));
+            const __m128i infinite = _mm_or_si128(_mm_set1_epi32(0x7c00), _mm_and_si128(isNan, _mm_set1_epi32(0x200)));
+
+            const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23));
+            const __m128i subnormal = _mm_sub_epi32(
+                    _mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(magnitude), magic)), _mm_castps_si128(magic));
+
+            const __m128i odd = _mm_and_si128(_mm_srli_epi32(magnitude, 13), _mm_set1_epi32(1));
+            __m128i normal = _mm_add_epi32(magnitude, _mm_set1_epi32(((15 - 127) << 23) + 0xfff));
+            normal = _mm_srli_epi32(_mm_add_epi32(normal, odd), 13);
+
+            const __m128i isSubnormal = _mm_cmplt_epi32(magnitude, _mm_set1_epi32(113 << 23));
+            __m128i out = Select(isSubnormal, subnormal, normal);
+            out = Select(isInfinite, infinite, out);
+            return _mm_or_si128(out, _mm_srli_epi32(sign, 16));
+        }
+
+        /**
+         * Detail::HalfToFloat on four halves zero extended to 32 bit lanes
+         */
+        __m128 HalfToFloat(const __m128i half) noexcept {
+            const __m128i exponentMantissa = _mm_and_si128(half, _mm_set1_epi32(0x7fff));
+            const __m128i sign = _mm_slli_epi32(_mm_xor_si128(half, exponentMantissa), 16);
+            // shifting into place and scaling by 2^112 rebiases the exponent, and handles subnormals
+            const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(exponentMantissa, 13)),
+                                             _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+            const __m128i isInfNan = _mm_cmpgt_epi32(exponentMantissa, _mm_set1_epi32(0x7bff));
+            const __m128i infNanExponent = _mm_and_si128(isInfNan, _mm_set1_epi32(255 << 23));
+            return _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(sign, infNanExponent)));
+        }
+#endif
+
+        /**
+         * Detail::FloatToUNorm on four lanes, the results in 32 bit lanes. _mm_max_ps returns its
+         * second operand for NaN, which maps NaN to 0.
+         */
+        inline __m128i FloatToUNorm(const __m128 value, const __m128 max) noexcept {
+            const __m128 clamped = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+            return _mm_cvtps_epi32(_mm_mul_ps(clamped, max));
+        }
+
+        inline __m128 UNormToFloat(const __m128i value, const __m128 max) noexcept {
+            return _mm_div_ps(_mm_cvtepi32_ps(value), max);
+        }
+    }
+#endif
+
+    void Pack(const float *in, Half *out, const size_t n) noexcept {
+        size_t i = 0;
+#if defined(QS_LINALG_F16C)
+        for (; i + 8 <= n; i += 8) {
+            const __m128i lo = _mm_cvtps_ph(_mm_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT);
+            const __m128i hi = _mm_cvtps_ph(_mm_loadu_ps(in + i + 4), _MM_FROUND_TO_NEAREST_INT);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_unpacklo_epi64(lo, hi));
+        }
+#elif defined(QS_LINALG_SSE)
+        for (; i + 8 <= n; i += 8) {
+            const __m128i lo = FloatToHalf(_mm_loadu_ps(in + i));
+            const __m128i hi = FloatToHalf(_mm_loadu_ps(in + i + 4));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), Narrow(lo, hi));
+        }
+#endif
+        for (; i < n; ++i) {
+            out[i] = in[i];
+        }
+    }
+
+    void Unpack(const Half *in, float *out, const size_t n) noexcept {
+        size_t i = 0;
+#if defined(QS_LINALG_F16C)
+        for (; i + 8 <= n; i += 8) {
+            const __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+            _mm_storeu_ps(out + i, _mm_cvtph_ps(halves));
+            _mm_storeu_ps(out + i + 4, _mm_cvtph_ps(_mm_unpackhi_epi64(halves, halves)));
+        }
+#elif defined(QS_LINALG_SSE)
+        for (; i + 8 <= n; i += 8) {
+            const __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+            _mm_storeu_ps(out + i, HalfToFloat(_mm_unpacklo_epi16(halves, _mm_setzero_si128())));
+            _mm_storeu_ps(out + i + 4, HalfToFloat(_mm_unpackhi_epi16(halves, _mm_setzero_si128())));
+        }
+#endif
+        for (; i < n; ++i) {
+            out[i] = in[i];
+        }
+    }
+
+    void Pack(const float *in, UNorm8 *out, const size_t n) noexcept {
+        size_t i = 0;
+#ifdef QS_LINALG_SSE
+        const __m128 max = _mm_set1_ps(255.0f);
+        for (; i + 16 <= n; i += 16) {
+            const __m128i a = FloatToUNorm(_mm_loadu_ps(in + i), max);
+            const __m128i b = FloatToUNorm(_mm_loadu_ps(in + i + 4), max);
+            const __m128i c = FloatToUNorm(_mm_loadu_ps(in + i + 8), max);
+            const __m128i d = FloatToUNorm(_mm_loadu_ps(in + i + 12), max);
+            const __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), bytes);
+        }
+#endif
+        for (; i < n; ++i) {
+            out[i] = in[i];
+        }
+    }
+
+    void Unpack(const UNorm8 *in, float *out, const size_t n) noexcept {
+        size_t i = 0;
+#ifdef QS_LINALG_SSE
+        const __m128 max = _mm_set1_ps(255.0f);
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 16 <= n; i += 16) {
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+            const __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+            const __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+            _mm_storeu_ps(out + i, UNormToFloat(_mm_unpacklo_epi16(lo, zero), max));
+            _mm_storeu_ps(out + i + 4, UNormToFloat(_mm_unpackhi_epi16(lo, zero), max));
+            _mm_storeu_ps(out + i + 8, UNormToFloat(_mm_unpacklo_epi16(hi, zero), max));
+            _mm_storeu_ps(out + i + 12, UNormToFloat(_mm_unpackhi_epi16(hi, zero), max));
+        }
+#endif
+        for (; i < n; ++i) {
+            out[i] = in[i];
+        }
+    }
+
+    void Pack(const float *in, UNorm16 *out, const size_t n) noexcept {
+        size_t i = 0;
+#ifdef QS_LINALG_SSE
+        const __m128 max = _mm_set1_ps(65535.0f);
+        for (; i + 8 <= n; i += 8) {
+            const __m128i lo = FloatToUNorm(_mm_loadu_ps(in + i), max);
+            const __m128i hi = FloatToUNorm(_mm_loadu_ps(in + i + 4), max);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), Narrow(lo, hi));
+        }
+#endif
+        for (; i < n; ++i) {
+            out[i] = in[i];
+        }
+    }
+
+    void Unpack(const UNorm16 *in, float *out, const size_t n) noexcept {
+        size_t i = 0;
+#ifdef QS_LINALG_SSE
+        const __m128 max = _mm_set1_ps(65535.0f);
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 8 <= n; i += 8) {
+            const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+            _mm_storeu_ps(out + i, UNormToFloat(_mm_unpacklo_epi16(values, zero), max));
+            _mm_storeu_ps(out + i + 4, UNormToFloat(_mm_unpackhi_epi16(values, zero), max));
+        }
+#endif
+        for (; i < n; ++i) {
+            out[i] = in[i];
+        }
+    }
+}
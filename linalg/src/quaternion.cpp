@@ -0,0 +1,157 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include "linalg/quaternion.h"
+
+#include "linalg/simd.h"
+
+namespace QS::LinAlg {
+
+    namespace {
+        // D. Eberly, A Fast and Accurate Algorithm for Computing SLERP. sin(t * angle) / sin(angle)
+        // is a series in cos(angle) - 1; kTerms terms with the last one scaled by kMu to correct for
+        // the truncation keep the error below float precision.
+        constexpr int kTerms = 16;
+
+        constexpr float kMu = 1.90110745351730037f;
+
+        struct Coefficients {
+            float u[kTerms];
+            float v[kTerms];
+        };
+
+        constexpr Coefficients MakeCoefficients() {
+            Coefficients out{};
+            for (int i = 0; i < kTerms; ++i) {
+                const double scale = i == kTerms - 1 ? kMu : 1.0;
+                out.u[i] = static_cast<float>(scale / ((i + 1) * (2 * i + 3)));
+                out.v[i] = static_cast<float>(scale * (i + 1) / (2 * i + 3));
+            }
+            return out;
+        }
+
+        constexpr Coefficients kSeries = MakeCoefficients();
+
+        /**
+         * sin(t * angle) / sin(angle) where cos(angle) - 1 = xm1
+         */
+        float SlerpWeight(const float t, const float xm1) noexcept {
+            const float sqrT = t * t;
+            float c = 1.0f;
+            for (int k = kTerms - 1; k >= 0; --k) {
+                c = 1.0f + (kSeries.u[k] * sqrT - kSeries.v[k]) * xm1 * c;
+            }
+            return t * c;
+        }
+
+        Quaternion<float> SlerpApproximate(const Quaternion<float> &from, const Quaternion<float> &to,
+                                           const float t) noexcept {
+            float cosine = from.Dot(to);
+            const float sign = cosine < 0.0f ? -1.0f : 1.0f;
+            cosine *= sign;
+            const float xm1 = cosine - 1.0f;
+            return from * SlerpWeight(1.0f - t, xm1) + to * (sign * SlerpWeight(t, xm1));
+        }
+
+#ifdef QS_LINALG_SSE
+        /**
+         * Loads four quaternions as x, y, z and w lanes
+         */
+        void LoadLanes(const Quaternion<float> *q, __m128 lanes[4]) noexcept {
+            for (int k = 0; k < 4; ++k) {
+                lanes[k] = _mm_loadu_ps(q[k].GetData());
+            }
+            _MM_TRANSPOSE4_PS(lanes[0], lanes[1], lanes[2], lanes[3]);
+        }
+
+        void StoreLanes(__m128 lanes[4], Quaternion<float> *q) noexcept {
+            _MM_TRANSPOSE4_PS(lanes[0], lanes[1], lanes[2], lanes[3]);
+            for (int k = 0; k < 4; ++k) {
+                _mm_storeu_ps(q[k].GetData(), lanes[k]);
+            }
+        }
+
+        __m128 Dot(const __m128 a[4], const __m128 b[4]) noexcept {
+            __m128 out = _mm_mul_ps(a[0], b[0]);
+            for (int k = 1; k < 4; ++k) {
+                out = _mm_add_ps(out, _mm_mul_ps(a[k], b[k]));
+            }
+            return out;
+        }
+
+        /**
+         * Flips b onto the hemisphere of a and returns |a . b|
+         */
+        __m128 AlignHemisphere(const __m128 a[4], __m128 b[4]) noexcept {
+            const __m128 dot = Dot(a, b);
+            const __m128 sign = _mm_and_ps(dot, _mm_set1_ps(-0.0f));
+            for (int k = 0; k < 4; ++k) {
+                b[k] = _mm_xor_ps(b[k], sign);
+            }
+            return _mm_xor_ps(dot, sign);
+        }
+
+        __m128 SlerpWeight(const __m128 t, const __m128 xm1) noexcept {
+            const __m128 one = _mm_set1_ps(1.0f);
+            const __m128 sqrT = _mm_mul_ps(t, t);
+            __m128 c = one;
+            for (int k = kTerms - 1; k >= 0; --k) {
+                const __m128 term = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(kSeries.u[k]), sqrT), _mm_set1_ps(kSeries.v[k]));
+                const __m128 b = _mm_mul_ps(term, xm1);
+                c = _mm_add_ps(one, _mm_mul_ps(b, c));
+            }
+            return _mm_mul_ps(t, c);
+        }
+#endif
+    }
+
+    void Nlerp(const Quaternion<float> *from, const Quaternion<float> *to, const float *t, Quaternion<float> *out,
+               const size_t count) noexcept {
+        size_t i = 0;
+#ifdef QS_LINALG_SSE
+        for (; i + 4 <= count; i += 4) {
+            __m128 a[4], b[4], r[4];
+            LoadLanes(from + i, a);
+            LoadLanes(to + i, b);
+            AlignHemisphere(a, b);
+            const __m128 wt = _mm_loadu_ps(t + i);
+            const __m128 wf = _mm_sub_ps(_mm_set1_ps(1.0f), wt);
+            for (int k = 0; k < 4; ++k) {
+                r[k] = _mm_add_ps(_mm_mul_ps(a[k], wf), _mm_mul_ps(b[k], wt));
+            }
+            const __m128 inverseNorm = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(Dot(r, r)));
+            for (auto &lane: r) {
+                lane = _mm_mul_ps(lane, inverseNorm);
+            }
+            StoreLanes(r, out + i);
+        }
+#endif
+        for (; i < count; ++i) {
+            out[i] = Nlerp(from[i], to[i], t[i]);
+        }
+    }
+
+    void Slerp(const Quaternion<float> *from, const Quaternion<float> *to, const float *t, Quaternion<float> *out,
+               const size_t count) noexcept {
+        size_t i = 0;
+#ifdef QS_LINALG_SSE
+        for (; i + 4 <= count; i += 4) {
+            __m128 a[4], b[4];
+            LoadLanes(from + i, a);
+            LoadLanes(to + i, b);
+            const __m128 xm1 = _mm_sub_ps(AlignHemisphere(a, b), _mm_set1_ps(1.0f));
+            const __m128 wt = _mm_loadu_ps(t + i);
+            const __m128 cT = SlerpWeight(wt, xm1);
+            const __m128 cF = SlerpWeight(_mm_sub_ps(_mm_set1_ps(1.0f), wt), xm1);
+            for (int k = 0; k < 4; ++k) {
+                a[k] = _mm_add_ps(_mm_mul_ps(a[k], cF), _mm_mul_ps(b[k], cT));
+            }
+            StoreLanes(a, out + i);
+        }
+#endif
+        for (; i < count; ++i) {
+            out[i] = SlerpApproximate(from[i], to[i], t[i]);
+        }
+    }
+}
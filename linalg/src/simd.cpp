@@ -0,0 +1,298 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include "linalg/simd.h"
+
+#include <vector>
+
+#include "linalg/dispatch.h"
+#include "linalg/gemm.h"
+
+namespace QS::LinAlg::Simd {
+
+#ifdef QS_LINALG_SSE
+    namespace {
+#ifdef QS_LINALG_AVX
+        using Wide = Detail::Pack<8>;
+#else
+        using Wide = Detail::Pack<4>;
+#endif
+        constexpr size_t kWidth = Detail::kWideWidth;
+
+        /**
+         * Applies op to whole registers and finishes the remainder with scalar
+         */
+        template<typename VectorOp, typename ScalarOp>
+        void ForEach(const float *lhs, const float *rhs, float *out, const size_t n, VectorOp vop, ScalarOp sop) {
+            size_t i = 0;
+            for (; i + kWidth <= n; i += kWidth) {
+                Wide::Store(out + i, vop(Wide::Load(lhs + i), Wide::Load(rhs + i)));
+            }
+            for (; i < n; ++i) {
+                out[i] = sop(lhs[i], rhs[i]);
+            }
+        }
+
+        /**
+         * Wide::Register version of CompensatedSum::TwoSum
+         */
+        Wide::Register TwoSum(Wide::Register &total, const Wide::Register term) noexcept {
+            const Wide::Register next = Detail::Add(total, term);
+            const Wide::Register added = Detail::Sub(next, total);
+            const Wide::Register error = Detail::Add(Detail::Sub(total, Detail::Sub(next, added)),
+                                                     Detail::Sub(term, added));
+            total = next;
+            return error;
+        }
+
+        /**
+         * CompensatedSum of vterm(i) in every lane of a register. The lanes and the remainder, given by
+         * sterm(i), are then added up with a scalar CompensatedSum.
+         */
+        template<typename VectorTerm, typename ScalarTerm>
+        float CompensatedLanes(const size_t n, VectorTerm vterm, ScalarTerm sterm) noexcept {
+            Wide::Register sum = Wide::Broadcast(0.0f);
+            Wide::Register compensation = sum;
+            Wide::Register secondOrder = sum;
+            size_t i = 0;
+            for (; i + kWidth <= n; i += kWidth) {
+                secondOrder = Detail::Add(secondOrder, TwoSum(compensation, TwoSum(sum, vterm(i))));
+            }
+            float lanes[3][kWidth];
+            Wide::Store(lanes[0], sum);
+            Wide::Store(lanes[1], compensation);
+            Wide::Store(lanes[2], secondOrder);
+            CompensatedSum<float> out;
+            for (const float *lane: lanes) {
+                for (size_t k = 0; k < kWidth; ++k) {
+                    out.Add(lane[k]);
+                }
+            }
+            for (; i < n; ++i) {
+                out.Add(sterm(i));
+            }
+            return out.Get();
+        }
+    }
+
+    void Add(const float *lhs, const float *rhs, float *out, const size_t n) noexcept {
+        ForEach(lhs, rhs, out, n,
+                [](auto a, auto b) { return Detail::Add(a, b); },
+                [](float a, float b) { return a + b; });
+    }
+
+    void Sub(const float *lhs, const float *rhs, float *out, const size_t n) noexcept {
+        ForEach(lhs, rhs, out, n,
+                [](auto a, auto b) { return Detail::Sub(a, b); },
+                [](float a, float b) { return a - b; });
+    }
+
+    void Mul(const float *lhs, const float *rhs, float *out, const size_t n) noexcept {
+        ForEach(lhs, rhs, out, n,
+                [](auto a, auto b) { return Detail::Mul(a, b); },
+                [](float a, float b) { return a * b; });
+    }
+
+    void Div(const float *lhs, const float *rhs, float *out, const size_t n) noexcept {
+        ForEach(lhs, rhs, out, n,
+                [](auto a, auto b) { return Detail::Div(a, b); },
+                [](float a, float b) { return a / b; });
+    }
+
+    void MulAdd(const float *lhs, const float *rhs, float *out, const size_t n) noexcept {
+        size_t i = 0;
+        for (; i + kWidth <= n; i += kWidth) {
+            const auto product = Detail::Mul(Wide::Load(lhs + i), Wide::Load(rhs + i));
+            Wide::Store(out + i, Detail::Add(Wide::Load(out + i), product));
+        }
+        for (; i < n; ++i) {
+            out[i] += lhs[i] * rhs[i];
+        }
+    }
+
+    void Sqrt(const float *in, float *out, const size_t n) noexcept {
+        size_t i = 0;
+        for (; i + kWidth <= n; i += kWidth) {
+            Wide::Store(out + i, Detail::Sqrt(Wide::Load(in + i)));
+        }
+        for (; i < n; ++i) {
+            out[i] = std::sqrt(in[i]);
+        }
+    }
+
+    void Scale(const float *lhs, const float scalar, float *out, const size_t n) noexcept {
+        const Wide::Register s = Wide::Broadcast(scalar);
+        size_t i = 0;
+        for (; i + kWidth <= n; i += kWidth) {
+            Wide::Store(out + i, Detail::Mul(Wide::Load(lhs + i), s));
+        }
+        for (; i < n; ++i) {
+            out[i] = lhs[i] * scalar;
+        }
+    }
+
+    void Axpby(const float alpha, const float *x, const float beta, float *y, const size_t n) noexcept {
+        if (beta == 0.0f) {
+            Scale(x, alpha, y, n);
+            return;
+        }
+        const Wide::Register a = Wide::Broadcast(alpha);
+        const Wide::Register b = Wide::Broadcast(beta);
+        size_t i = 0;
+        for (; i + kWidth <= n; i += kWidth) {
+            Wide::Store(y + i, Detail::Add(Detail::Mul(a, Wide::Load(x + i)), Detail::Mul(b, Wide::Load(y + i))));
+        }
+        for (; i < n; ++i) {
+            y[i] = alpha * x[i] + beta * y[i];
+        }
+    }
+
+    float KahanDot(const float *lhs, const float *rhs, const size_t n) noexcept {
+        return CompensatedLanes(n,
+                                [lhs, rhs](size_t i) { return Detail::Mul(Wide::Load(lhs + i), Wide::Load(rhs + i)); },
+                                [lhs, rhs](size_t i) { return lhs[i] * rhs[i]; });
+    }
+
+    float KahanSum(const float *in, const size_t n) noexcept {
+        return CompensatedLanes(n,
+                                [in](size_t i) { return Wide::Load(in + i); },
+                                [in](size_t i) { return in[i]; });
+    }
+#else
+    void Add(const float *lhs, const float *rhs, float *out, const size_t n) noexcept {
+        Add<float>(lhs, rhs, out, n);
+    }
+
+    void Sub(const float *lhs, const float *rhs, float *out, const size_t n) noexcept {
+        Sub<float>(lhs, rhs, out, n);
+    }
+
+    void Scale(const float *lhs, const float scalar, float *out, const size_t n) noexcept {
+        Scale<float>(lhs, scalar, out, n);
+    }
+
+    void Mul(const float *lhs, const float *rhs, float *out, const size_t n) noexcept {
+        Mul<float>(lhs, rhs, out, n);
+    }
+
+    void Div(const float *lhs, const float *rhs, float *out, const size_t n) noexcept {
+        Div<float>(lhs, rhs, out, n);
+    }
+
+    void MulAdd(const float *lhs, const float *rhs, float *out, const size_t n) noexcept {
+        MulAdd<float>(lhs, rhs, out, n);
+    }
+
+    void Sqrt(const float *in, float *out, const size_t n) noexcept {
+        Sqrt<float>(in, out, n);
+    }
+
+    void Axpby(const float alpha, const float *x, const float beta, float *y, const size_t n) noexcept {
+        Axpby<float>(alpha, x, beta, y, n);
+    }
+
+    float KahanDot(const float *lhs, const float *rhs, const size_t n) noexcept {
+        return KahanDot<float>(lhs, rhs, n);
+    }
+
+    float KahanSum(const float *in, const size_t n) noexcept {
+        return KahanSum<float>(in, n);
+    }
+#endif
+
+    // chosen at run time, see dispatch.h
+
+    void Axpy(const float alpha, const float *x, float *y, const size_t n) noexcept {
+        Dispatch::GetKernels().axpy(alpha, x, y, n);
+    }
+
+    float Dot(const float *lhs, const float *rhs, const size_t n) noexcept {
+        return Dispatch::GetKernels().dot(lhs, rhs, n);
+    }
+
+    float Sum(const float *in, const size_t n) noexcept {
+        return Dispatch::GetKernels().sum(in, n);
+    }
+
+    namespace {
+        /**
+         * Copies the rows x depth block of a into panels of panelRows rows, each stored column after
+         * column and the last one padded with zeros
+         */
+        void PackRows(const float *a, const size_t rs, const size_t cs, const size_t rows, const size_t depth,
+                      const size_t panelRows, float *out) noexcept {
+            for (size_t i = 0; i < rows; i += panelRows) {
+                const size_t valid = rows - i < panelRows ? rows - i : panelRows;
+                for (size_t p = 0; p < depth; ++p) {
+                    for (size_t r = 0; r < panelRows; ++r) {
+                        *out++ = r < valid ? a[(i + r) * rs + p * cs] : 0.0f;
+                    }
+                }
+            }
+        }
+
+        /**
+         * Copies the depth x cols block of b into panels of panelCols columns, each stored row after
+         * row and the last one padded with zeros
+         */
+        void PackCols(const float *b, const size_t rs, const size_t cs, const size_t depth, const size_t cols,
+                      const size_t panelCols, float *out) noexcept {
+            for (size_t j = 0; j < cols; j += panelCols) {
+                const size_t valid = cols - j < panelCols ? cols - j : panelCols;
+                for (size_t p = 0; p < depth; ++p) {
+                    for (size_t s = 0; s < panelCols; ++s) {
+                        *out++ = s < valid ? b[p * rs + (j + s) * cs] : 0.0f;
+                    }
+                }
+            }
+        }
+    }
+
+    void Gemm(const size_t m, const size_t n, const size_t k, const float alpha, const float *a, const size_t ars,
+              const size_t acs, const float *b, const size_t brs, const size_t bcs, const float beta, float *c,
+              const size_t crs, const size_t ccs) {
+        using LinAlg::Gemm::kBlockCols, LinAlg::Gemm::kBlockDepth, LinAlg::Gemm::kBlockRows;
+        using LinAlg::Gemm::Detail::Store;
+        if (k == 0) {
+            for (size_t i = 0; i < m; ++i) {
+                for (size_t j = 0; j < n; ++j) {
+                    Store<true>(c[i * crs + j * ccs], 0.0f, alpha, beta, false);
+                }
+            }
+            return;
+        }
+        const Dispatch::Kernels &kernels = Dispatch::GetKernels();
+        const size_t mr = kernels.gemmRows, nr = kernels.gemmCols;
+        // one block of each operand, its last panel padded to a whole one
+        thread_local std::vector<float> packedA, packedB;
+        packedA.resize((kBlockRows + mr - 1) / mr * mr * kBlockDepth);
+        packedB.resize((kBlockCols + nr - 1) / nr * nr * kBlockDepth);
+        float tile[Dispatch::kMaxGemmTile];
+        for (size_t jc = 0; jc < n; jc += kBlockCols) {
+            const size_t nc = n - jc < kBlockCols ? n - jc : kBlockCols;
+            for (size_t pc = 0; pc < k; pc += kBlockDepth) {
+                const size_t kc = k - pc < kBlockDepth ? k - pc : kBlockDepth;
+                const bool accumulate = pc != 0;
+                PackCols(b + pc * brs + jc * bcs, brs, bcs, kc, nc, nr, packedB.data());
+                for (size_t ic = 0; ic < m; ic += kBlockRows) {
+                    const size_t mc = m - ic < kBlockRows ? m - ic : kBlockRows;
+                    PackRows(a + ic * ars + pc * acs, ars, acs, mc, kc, mr, packedA.data());
+                    for (size_t j = 0; j < nc; j += nr) {
+                        const size_t cols = nc - j < nr ? nc - j : nr;
+                        for (size_t i = 0; i < mc; i += mr) {
+                            const size_t rows = mc - i < mr ? mc - i : mr;
+                            kernels.gemm(kc, packedA.data() + i * kc, packedB.data() + j * kc, tile);
+                            float *out = c + (ic + i) * crs + (jc + j) * ccs;
+                            for (size_t r = 0; r < rows; ++r) {
+                                for (size_t s = 0; s < cols; ++s) {
+                                    Store<true>(out[r * crs + s * ccs], tile[r * nr + s], alpha, beta, accumulate);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,16 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include "linalg/sparse.h"
+
+#include "linalg/dispatch.h"
+
+namespace QS::LinAlg::Detail {
+
+    // chosen at run time, see dispatch.h
+
+    float SparseDot(const float *values, const uint32_t *indices, const size_t count, const float *x) noexcept {
+        return Dispatch::GetKernels().sparseDot(values, indices, count, x);
+    }
+}
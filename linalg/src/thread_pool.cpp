@@ -0,0 +1,164 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include "linalg/thread_pool.h"
+
+#include <exception>
+
+namespace QS::LinAlg {
+
+    namespace {
+        /// pool owning the current thread, null outside of worker threads
+        thread_local ThreadPool *tCurrentPool = nullptr;
+
+        /// queue index of the current worker thread
+        thread_local size_t tCurrentQueue = 0;
+
+        std::mutex gDefaultPoolMutex;
+
+        std::unique_ptr<ThreadPool> gDefaultPool;
+    }
+
+    ThreadPool::ThreadPool(size_t threads) {
+        if (threads == 0) {
+            threads = std::thread::hardware_concurrency();
+        }
+        const size_t workers = threads > 1 ? threads - 1 : 0;
+        for (size_t i = 0; i < workers; ++i) {
+            mQueues.emplace_back(std::make_unique<Queue>());
+        }
+        for (size_t i = 0; i < workers; ++i) {
+            mThreads.emplace_back([this, i] { WorkerLoop(i); });
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mWakeMutex);
+            mStop = true;
+        }
+        mWake.notify_all();
+        for (auto &thread: mThreads) {
+            thread.join();
+        }
+    }
+
+    void ThreadPool::ParallelFor(const size_t count, const std::function<void(size_t)> &body) {
+        if (mQueues.empty() || count <= 1) {
+            for (size_t i = 0; i < count; ++i) {
+                body(i);
+            }
+            return;
+        }
+
+        struct Group {
+            std::atomic<size_t> remaining;
+            std::mutex errorMutex;
+            std::exception_ptr error;
+        };
+        auto group = std::make_shared<Group>();
+        group->remaining = count;
+
+        const bool onWorker = tCurrentPool == this;
+        const size_t first = onWorker ? tCurrentQueue : 0;
+        for (size_t i = 0; i < count; ++i) {
+            Push((first + i) % mQueues.size(), [group, &body, i] {
+                try {
+                    body(i);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(group->errorMutex);
+                    if (!group->error) {
+                        group->error = std::current_exception();
+                    }
+                }
+                group->remaining.fetch_sub(1, std::memory_order_acq_rel);
+            });
+        }
+
+        // help with the queued work instead of blocking
+        while (group->remaining.load(std::memory_order_acquire) != 0) {
+            if (!RunOne(first)) {
+                std::this_thread::yield();
+            }
+        }
+
+        if (group->error) {
+            std::rethrow_exception(group->error);
+        }
+    }
+
+    void ThreadPool::Push(const size_t queue, Task task) {
+        {
+            std::lock_guard<std::mutex> lock(mQueues[queue]->mutex);
+            mQueues[queue]->tasks.emplace_back(std::move(task));
+        }
+        {
+            std::lock_guard<std::mutex> lock(mWakeMutex);
+            mPending.fetch_add(1, std::memory_order_release);
+        }
+        mWake.notify_one();
+    }
+
+    bool ThreadPool::TryPop(const size_t queue, Task &task) {
+        std::lock_guard<std::mutex> lock(mQueues[queue]->mutex);
+        if (mQueues[queue]->tasks.empty()) {
+            return false;
+        }
+        task = std::move(mQueues[queue]->tasks.back());
+        mQueues[queue]->tasks.pop_back();
+        mPending.fetch_sub(1, std::memory_order_acq_rel);
+        return true;
+    }
+
+    bool ThreadPool::TrySteal(const size_t thief, Task &task) {
+        for (size_t offset = 1; offset <= mQueues.size(); ++offset) {
+            auto &victim = *mQueues[(thief + offset) % mQueues.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                mPending.fetch_sub(1, std::memory_order_acq_rel);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool ThreadPool::RunOne(const size_t home) {
+        Task task;
+        if (TryPop(home, task) || TrySteal(home, task)) {
+            task();
+            return true;
+        }
+        return false;
+    }
+
+    void ThreadPool::WorkerLoop(const size_t index) {
+        tCurrentPool = this;
+        tCurrentQueue = index;
+        while (true) {
+            if (RunOne(index)) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(mWakeMutex);
+            mWake.wait(lock, [this] { return mStop || mPending.load(std::memory_order_acquire) != 0; });
+            if (mStop) {
+                return;
+            }
+        }
+    }
+
+    ThreadPool &GetThreadPool() {
+        std::lock_guard<std::mutex> lock(gDefaultPoolMutex);
+        if (!gDefaultPool) {
+            gDefaultPool = std::make_unique<ThreadPool>();
+        }
+        return *gDefaultPool;
+    }
+
+    void SetThreadCount(const size_t threads) {
+        std::lock_guard<std::mutex> lock(gDefaultPoolMutex);
+        gDefaultPool = std::make_unique<ThreadPool>(threads);
+    }
+}
@@ -0,0 +1,42 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include "linalg/transform.h"
+
+#include "linalg/dispatch.h"
+#include "linalg/parallel.h"
+
+namespace QS::LinAlg {
+
+    namespace {
+        template<int components>
+        void Transform(const CMatrix<4, 4> &m, const float w, const float *in, const size_t inStride, float *out,
+                       const size_t outStride, const size_t count) {
+            const float *data = m.GetData();
+            const Dispatch::Kernels &kernels = Dispatch::GetKernels();
+            Parallel::Apply(count, [=, &kernels](size_t begin, size_t end) {
+                if constexpr (components == 3) {
+                    kernels.transform3(data, w, in, inStride, out, outStride, begin, end);
+                } else {
+                    kernels.transform4(data, in, inStride, out, outStride, begin, end);
+                }
+            });
+        }
+    }
+
+    void TransformPositions(const CMatrix<4, 4> &m, const float *in, const size_t inStride, float *out,
+                            const size_t outStride, const size_t count) {
+        Transform<3>(m, 1.0f, in, inStride, out, outStride, count);
+    }
+
+    void TransformDirections(const CMatrix<4, 4> &m, const float *in, const size_t inStride, float *out,
+                             const size_t outStride, const size_t count) {
+        Transform<3>(m, 0.0f, in, inStride, out, outStride, count);
+    }
+
+    void TransformHomogeneous(const CMatrix<4, 4> &m, const float *in, const size_t inStride, float *out,
+                              const size_t outStride, const size_t count) {
+        Transform<4>(m, 0.0f, in, inStride, out, outStride, count);
+    }
+}
@@ -0,0 +1,77 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <cstdint>
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "linalg/aligned_buffer.h"
+#include "linalg/rvector.h"
+
+using namespace QS::LinAlg;
+
+TEST(AlignedBuffer, Empty)
+{
+    AlignedBuffer<float> buffer;
+    ASSERT_EQ(buffer.GetSize(), 0);
+    ASSERT_EQ(buffer.GetData(), nullptr);
+}
+
+TEST(AlignedBuffer, AlignedAndZeroed)
+{
+    for (size_t size: { 1, 3, 17, 1000 }) {
+        AlignedBuffer<float> buffer(size);
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(buffer.GetData()) % kCacheLineSize, 0);
+        for (size_t i = 0; i < size; ++i) {
+            ASSERT_FLOAT_EQ(buffer[i], 0.0f);
+        }
+    }
+}
+
+TEST(AlignedBuffer, Move)
+{
+    AlignedBuffer<double> a(4);
+    a[2] = 3.0;
+    const double *data = a.GetData();
+
+    AlignedBuffer<double> b = std::move(a);
+    ASSERT_EQ(b.GetData(), data);
+    ASSERT_EQ(b.GetSize(), 4);
+    ASSERT_DOUBLE_EQ(b[2], 3.0);
+    ASSERT_EQ(a.GetData(), nullptr);
+    ASSERT_EQ(a.GetSize(), 0);
+
+    a = std::move(b);
+    ASSERT_EQ(a.GetData(), data);
+}
+
+TEST(AlignedBuffer, PaddedAlignment)
+{
+    static_assert(PaddedAlignment<float, 1>() == 4);
+    static_assert(PaddedAlignment<float, 3>() == 16);
+    static_assert(PaddedAlignment<float, 4>() == 16);
+    static_assert(PaddedAlignment<float, 9>() == 64);
+    static_assert(PaddedAlignment<double, 16>() == kCacheLineSize);
+
+    // padding keeps every element of an array inside one cache line
+    static_assert(sizeof(PaddedRVector<3>) == 16 && alignof(PaddedRVector<3>) == 16);
+    static_assert(sizeof(PaddedRVector<9>) == 64);
+    static_assert(sizeof(RVector<3>) == 12);
+}
+
+TEST(AlignedBuffer, Allocator)
+{
+    AlignedVector<float> floats(37, 1.0f);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(floats.data()) % kCacheLineSize, 0);
+    floats.resize(1000);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(floats.data()) % kCacheLineSize, 0);
+    ASSERT_FLOAT_EQ(floats[36], 1.0f);
+
+    AlignedVector<PaddedRVector<3>, 16> vectors(5, PaddedRVector<3>{ 1.0f, 2.0f, 3.0f });
+    for (const auto &v: vectors) {
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(v.GetData()) % 16, 0);
+    }
+    ASSERT_FLOAT_EQ(vectors[4][2], 3.0f);
+    static_assert(AlignedAllocator<PaddedRVector<16>, 16>::kAlignment == 64);
+}
@@ -0,0 +1,265 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+#include "linalg/blas.h"
+#include "linalg/map.h"
+
+using namespace QS::LinAlg;
+
+TEST(Blas, LevelOne)
+{
+    RVector<4> y = { 1.0f, 2.0f, 3.0f, 4.0f };
+    const RVector<4> x = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+    Blas::Axpy(2.0f, x, y);
+    ASSERT_EQ(y[0], 3.0f);
+    ASSERT_EQ(y[3], 6.0f);
+
+    Blas::Axpby(1.0f, x, 0.5f, y);
+    ASSERT_EQ(y[0], 2.5f);
+    ASSERT_EQ(y[3], 4.0f);
+
+    // any expression as input, a view as output
+    CMatrix<3, 3> m = Identity<3>();
+    Blas::Axpy(1.0f, CVector<3>{ 1.0f, 2.0f, 3.0f } * 2.0f, Column(m, 1));
+    ASSERT_EQ(m[1][0], 2.0f);
+    ASSERT_EQ(m[1][1], 5.0f);
+    ASSERT_EQ(m[1][2], 6.0f);
+
+    Blas::Scal(2.0f, Row(m, 0));
+    ASSERT_EQ(m[0][0], 2.0f);
+    ASSERT_EQ(m[1][0], 4.0f);
+
+    // matrices are level one operands too
+    Blas::Scal(0.5f, m);
+    ASSERT_EQ(m[1][1], 2.5f);
+
+    CVector<4> column;
+    Blas::Copy(y, column);
+    ASSERT_EQ(column[0], 2.5f);
+    ASSERT_EQ(Blas::Dot(y, column), 2.5f * 2.5f + 3.0f * 3.0f + 3.5f * 3.5f + 4.0f * 4.0f);
+
+    RVector<4> z = { 0.0f, 0.0f, 0.0f, 1.0f };
+    Blas::Swap(y, z);
+    ASSERT_EQ(y[3], 1.0f);
+    ASSERT_EQ(z[0], 2.5f);
+}
+
+TEST(Blas, BetaZeroIgnoresOutput)
+{
+    constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+    const RMatrix<2, 3> a = { { 1.0f, 2.0f, 3.0f },
+                              { 4.0f, 5.0f, 6.0f } };
+    const CVector<3> x = { 1.0f, 0.0f, -1.0f };
+
+    CVector<2> y = { nan, nan };
+    Blas::Gemv(2.0f, a, x, 0.0f, y);
+    ASSERT_EQ(y[0], -4.0f);
+    ASSERT_EQ(y[1], -4.0f);
+
+    CMatrix<2, 2> c = { { nan, nan }, { nan, nan } };
+    Blas::Gemm(1.0f, a, Transpose(a), 0.0f, c);
+    ASSERT_EQ(c[0][0], 14.0f);
+    ASSERT_EQ(c[1][0], 32.0f);
+    ASSERT_EQ(c[1][1], 77.0f);
+}
+
+TEST(Blas, FixedLevelTwoAndThree)
+{
+    const RMatrix<2, 3> a = { { 1.0f, 2.0f, 3.0f },
+                              { 4.0f, 5.0f, 6.0f } };
+    const RVector<3> x = { 1.0f, 1.0f, 2.0f };
+
+    // y = 0.5 a x + 2 y, written into a strided view
+    RMatrix<2, 2> target = { { 1.0f, 0.0f },
+                             { 2.0f, 0.0f } };
+    Blas::Gemv(0.5f, a, x, 2.0f, Column(target, 0));
+    ASSERT_EQ(target[0][0], 0.5f * 9.0f + 2.0f);
+    ASSERT_EQ(target[1][0], 0.5f * 21.0f + 4.0f);
+    ASSERT_EQ(target[0][1], 0.0f);
+
+    RMatrix<2, 3> outer = a;
+    Blas::Ger(2.0f, CVector<2>{ 1.0f, -1.0f }, x, outer);
+    ASSERT_EQ(outer[0][2], 3.0f + 4.0f);
+    ASSERT_EQ(outer[1][0], 4.0f - 2.0f);
+
+    // c = 2 a^T a - c
+    CMatrix<3, 3> c = Identity<3>();
+    Blas::Gemm(2.0f, Transpose(a), a, -1.0f, c);
+    for (size_t r = 0; r < 3; ++r) {
+        for (size_t col = 0; col < 3; ++col) {
+            const float expected = a[0][r] * a[0][col] + a[1][r] * a[1][col];
+            ASSERT_EQ(c[col][r], 2.0f * expected - (r == col ? 1.0f : 0.0f));
+        }
+    }
+
+    // the upper left block of a mapped buffer
+    float buffer[9] = {};
+    Map<RMatrix<3, 3>> mapped(buffer);
+    Blas::Gemm(1.0f, a, Transpose(a), 0.0f, Block<2, 2>(mapped, 0, 0));
+    ASSERT_EQ(buffer[0], 14.0f);
+    ASSERT_EQ(buffer[1], 32.0f);
+    ASSERT_EQ(buffer[4], 77.0f);
+    ASSERT_EQ(buffer[2], 0.0f);
+}
+
+template<Layout aLayout, Layout bLayout, Layout cLayout>
+static void CheckRuntimeGemm(const size_t m, const size_t n, const size_t k)
+{
+    DMatrix<double, aLayout> a(m, k);
+    DMatrix<double, bLayout> b(k, n);
+    DMatrix<double, cLayout> c(m, n);
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t p = 0; p < k; ++p) {
+            a(i, p) = static_cast<double>((i + 2 * p) % 7) - 3.0;
+        }
+    }
+    for (size_t p = 0; p < k; ++p) {
+        for (size_t j = 0; j < n; ++j) {
+            b(p, j) = static_cast<double>((3 * p + j) % 5) * 0.5;
+        }
+    }
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            c(i, j) = static_cast<double>(i) - static_cast<double>(j);
+        }
+    }
+
+    const DMatrix<double, aLayout> product = a * b;
+    const DMatrix<double, cLayout> before = c.Clone();
+    Blas::Gemm(1.5, a, b, -0.5, c);
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            ASSERT_DOUBLE_EQ(c(i, j), 1.5 * product(i, j) - 0.5 * before(i, j)) << i << ", " << j;
+        }
+    }
+}
+
+TEST(Blas, RuntimeGemm)
+{
+    CheckRuntimeGemm<Layout::RowMajor, Layout::RowMajor, Layout::RowMajor>(5, 7, 3);
+    CheckRuntimeGemm<Layout::ColumnMajor, Layout::RowMajor, Layout::ColumnMajor>(Gemm::kBlockRows + 3, 9,
+                                                                                  Gemm::kBlockDepth + 5);
+    CheckRuntimeGemm<Layout::RowMajor, Layout::ColumnMajor, Layout::ColumnMajor>(130, 140, 70);
+    CheckRuntimeGemm<Layout::RowMajor, Layout::RowMajor, Layout::RowMajor>(4, 4, 0);
+
+    DMatrix<double> a(2, 3), b(2, 3), c(2, 3);
+    ASSERT_THROW(Blas::Gemm(1.0, a, b, 0.0, c), std::invalid_argument);
+}
+
+template<Layout layout>
+static void CheckRuntimeLevelTwo()
+{
+    DMatrix<float, layout> a = { { 1.0f, 2.0f },
+                                 { 3.0f, 4.0f },
+                                 { 5.0f, 6.0f } };
+    DVector<float> x(2);
+    x[0] = 1.0f;
+    x[1] = -1.0f;
+    DVector<float> y(3);
+    y[0] = 1.0f;
+    y[1] = 2.0f;
+    y[2] = 3.0f;
+
+    Blas::Gemv(2.0f, a, x, 1.0f, y);
+    ASSERT_EQ(y[0], -1.0f);
+    ASSERT_EQ(y[1], 0.0f);
+    ASSERT_EQ(y[2], 1.0f);
+
+    y[1] = std::numeric_limits<float>::quiet_NaN();
+    Blas::Gemv(1.0f, a, x, 0.0f, y);
+    ASSERT_EQ(y[1], -1.0f);
+
+    Blas::Ger(1.0f, y, x, a);
+    ASSERT_EQ(a(0, 0), 0.0f);
+    ASSERT_EQ(a(2, 1), 7.0f);
+
+    ASSERT_THROW(Blas::Gemv(1.0f, a, y, 0.0f, y), std::invalid_argument);
+}
+
+TEST(Blas, RuntimeLevelTwo)
+{
+    CheckRuntimeLevelTwo<Layout::RowMajor>();
+    CheckRuntimeLevelTwo<Layout::ColumnMajor>();
+}
+
+template<Layout layout>
+static void CheckParallelLevelTwo(const size_t rows, const size_t cols)
+{
+    DMatrix<float, layout> a(rows, cols);
+    DVector<float> x(cols), y(rows);
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < cols; ++j) {
+            a(i, j) = static_cast<float>((i + 2 * j) % 5) - 2.0f;
+        }
+        y[i] = static_cast<float>(i % 3);
+    }
+    for (size_t j = 0; j < cols; ++j) {
+        x[j] = static_cast<float>(j % 4);
+    }
+    // small integers, so every summation order is exact
+    DVector<float> expected(rows);
+    for (size_t i = 0; i < rows; ++i) {
+        float sum = 0.0f;
+        for (size_t j = 0; j < cols; ++j) {
+            sum += a(i, j) * x[j];
+        }
+        expected[i] = 2.0f * sum - y[i];
+    }
+    Blas::Gemv(2.0f, a, x, -1.0f, y);
+    for (size_t i = 0; i < rows; ++i) {
+        ASSERT_EQ(y[i], expected[i]);
+    }
+
+    const DMatrix<float, layout> before = a.Clone();
+    Blas::Ger(3.0f, y, x, a);
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < cols; ++j) {
+            ASSERT_EQ(a(i, j), before(i, j) + 3.0f * y[i] * x[j]);
+        }
+    }
+}
+
+TEST(Blas, RuntimeLevelTwoParallel)
+{
+    const size_t cutoff = Parallel::GetElementCutoff();
+    SetThreadCount(4);
+    Parallel::SetElementCutoff(0);
+    CheckParallelLevelTwo<Layout::RowMajor>(300, 70);
+    CheckParallelLevelTwo<Layout::ColumnMajor>(300, 70);
+    CheckParallelLevelTwo<Layout::ColumnMajor>(20, 1000);
+    Parallel::SetElementCutoff(cutoff);
+    SetThreadCount(0);
+}
+
+TEST(Blas, RuntimeLevelOne)
+{
+    DVector<float> x(100), y(100);
+    for (size_t i = 0; i < 100; ++i) {
+        x[i] = static_cast<float>(i);
+        y[i] = 1.0f;
+    }
+    Blas::Axpby(2.0f, x, 3.0f, y);
+    ASSERT_EQ(y[10], 23.0f);
+    Blas::Axpy(-2.0f, x, y);
+    ASSERT_EQ(y[99], 3.0f);
+    Blas::Scal(0.5f, y);
+    ASSERT_EQ(Blas::Dot(y, y), 100.0f * 1.5f * 1.5f);
+
+    DMatrix<float> r(2, 2);
+    DMatrix<float, Layout::ColumnMajor> c(2, 2);
+    r(0, 1) = 1.0f;
+    c(1, 0) = 2.0f;
+    Blas::Axpy(3.0f, c, r);
+    ASSERT_EQ(r(1, 0), 6.0f);
+    ASSERT_EQ(r(0, 1), 1.0f);
+
+    DVector<float> shorter(3);
+    ASSERT_THROW(Blas::Axpy(1.0f, shorter, y), std::invalid_argument);
+}
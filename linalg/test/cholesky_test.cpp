@@ -0,0 +1,160 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "linalg/cholesky.h"
+#include "linalg/cmatrix.h"
+#include "linalg/rmatrix.h"
+
+using namespace QS::LinAlg;
+
+namespace {
+    constexpr RMatrix<3, 3> kSpd = { { 4, 2, -2 },
+                                     { 2, 10, 2 },
+                                     { -2, 2, 5 } };
+
+    /**
+     * B * B^T + n * I, which is symmetric positive definite
+     */
+    template<Layout layout>
+    DMatrix<double, layout> RandomSpd(const size_t n, const unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> value(-1.0, 1.0);
+        DMatrix<double> b(n, n);
+        for (size_t i = 0; i < b.GetSize(); ++i) {
+            b.GetData()[i] = value(rng);
+        }
+        DMatrix<double, layout> out(n, n);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < n; ++j) {
+                double sum = i == j ? static_cast<double>(n) : 0.0;
+                for (size_t k = 0; k < n; ++k) {
+                    sum += b(i, k) * b(j, k);
+                }
+                out(i, j) = sum;
+            }
+        }
+        return out;
+    }
+
+    template<Layout layout>
+    void ExpectSolves(const DMatrix<double, layout> &a, const DVector<double> &x) {
+        const DVector<double> ax = a * x;
+        for (size_t i = 0; i < x.GetSize(); ++i) {
+            ASSERT_NEAR(ax[i], static_cast<double>(i % 5), 1e-9) << i;
+        }
+    }
+}
+
+static_assert(LDLT<RMatrix<3, 3>>(kSpd).Determinant() == 108.0f);
+static_assert(Detail::Abs(LDLT<RMatrix<3, 3>>(kSpd).Solve(RVector<3>{ 4, 14, 5 })[0] - 1.0f) < 1e-5f);
+
+TEST(Cholesky, Fixed)
+{
+    const Cholesky<RMatrix<3, 3>> cholesky(kSpd);
+    ASSERT_TRUE(cholesky.IsPositiveDefinite());
+    ASSERT_NEAR(cholesky.Determinant(), 108.0f, 1e-3f);
+
+    const RMatrix<3, 3> &l = cholesky.GetLower();
+    ASSERT_FLOAT_EQ(l[0][0], 2.0f);
+    ASSERT_FLOAT_EQ(l[0][1], 0.0f);
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            float sum = 0.0f;
+            for (size_t k = 0; k < 3; ++k) {
+                sum += l[i][k] * l[j][k];
+            }
+            ASSERT_NEAR(sum, kSpd[i][j], 1e-5f);
+        }
+    }
+
+    // x = (1, 1, 1)
+    const RVector<3> x = cholesky.Solve(RVector<3>{ 4, 14, 5 });
+    for (size_t i = 0; i < 3; ++i) {
+        ASSERT_NEAR(x[i], 1.0f, 1e-5f);
+    }
+    const RMatrix<3, 3> identity = kSpd * cholesky.Inverse();
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            ASSERT_NEAR(identity[i][j], i == j ? 1.0f : 0.0f, 1e-5f);
+        }
+    }
+}
+
+TEST(Cholesky, ColumnMajorAndLDLT)
+{
+    // symmetric, so the columns read like the rows of kSpd
+    const CMatrix<3, 3, double> a = { { 4, 2, -2 },
+                                      { 2, 10, 2 },
+                                      { -2, 2, 5 } };
+    const CVector<3, double> b = { 4.0, 14.0, 5.0 };
+
+    const CVector<3, double> fromCholesky = Cholesky<CMatrix<3, 3, double>>(a).Solve(b);
+    const LDLT<CMatrix<3, 3, double>> ldlt(a);
+    const CVector<3, double> fromLdlt = ldlt.Solve(b);
+
+    for (size_t i = 0; i < 3; ++i) {
+        ASSERT_NEAR(fromCholesky[i], 1.0, 1e-12);
+        ASSERT_NEAR(fromLdlt[i], 1.0, 1e-12);
+    }
+    ASSERT_DOUBLE_EQ(ldlt.GetDiagonal()[0], 4.0);
+    ASSERT_DOUBLE_EQ(ldlt.GetLower()[0][1], 0.5);
+}
+
+TEST(Cholesky, Indefinite)
+{
+    const RMatrix<2, 2> a = { { 1, 2 },
+                              { 2, 1 } };
+    const Cholesky<RMatrix<2, 2>> cholesky(a);
+    const LDLT<RMatrix<2, 2>> ldlt(a);
+
+    ASSERT_FALSE(cholesky.IsPositiveDefinite());
+    ASSERT_THROW((void)cholesky.Solve(RVector<2>{ 1, 1 }), std::invalid_argument);
+    // LDL^T handles indefinite matrices: x = (1/3, 1/3)
+    ASSERT_FALSE(ldlt.IsSingular());
+    ASSERT_NEAR(ldlt.Solve(RVector<2>{ 1, 1 })[0], 1.0f / 3.0f, 1e-6f);
+    ASSERT_TRUE((LDLT<RMatrix<2, 2>>(RMatrix<2, 2>{ { 0, 1 }, { 1, 0 } }).IsSingular()));
+}
+
+TEST(Cholesky, Blocked)
+{
+    // several panels and a partial last one
+    const DMatrix<double> a = RandomSpd<Layout::RowMajor>(150, 3);
+    const DMatrix<double, Layout::ColumnMajor> c = RandomSpd<Layout::ColumnMajor>(150, 3);
+    DVector<double> b(150);
+    for (size_t i = 0; i < 150; ++i) {
+        b[i] = static_cast<double>(i % 5);
+    }
+
+    const Cholesky<DMatrix<double>> cholesky(a);
+    const LDLT<DMatrix<double, Layout::ColumnMajor>> ldlt(c);
+
+    ASSERT_TRUE(cholesky.IsPositiveDefinite());
+    ASSERT_FALSE(ldlt.IsSingular());
+    ExpectSolves(a, cholesky.Solve(b));
+    ExpectSolves(c, ldlt.Solve(b));
+    ASSERT_EQ(cholesky.GetLower()(0, 1), 0.0);
+
+    const double lu = Determinant(a.Clone() * 0.1);
+    ASSERT_NEAR(Cholesky<DMatrix<double>>(a * 0.1).Determinant() / lu, 1.0, 1e-9);
+    ASSERT_NEAR(LDLT<DMatrix<double>>(a * 0.1).Determinant() / lu, 1.0, 1e-9);
+
+    ASSERT_FALSE(Cholesky<DMatrix<>>(DMatrix<>{ { 1, 2 }, { 2, 1 } }).IsPositiveDefinite());
+    ASSERT_THROW((void)Cholesky<DMatrix<>>(DMatrix<>(2, 3)), std::invalid_argument);
+}
+
+TEST(Cholesky, Batch)
+{
+    std::vector<RMatrix<3, 3>> a(1000, kSpd);
+    a[7] = RMatrix<3, 3>{ { 1, 2, 0 }, { 2, 1, 0 }, { 0, 0, 1 } };
+    std::vector<RVector<3>> b(1000, RVector<3>{ 4, 14, 5 });
+    std::vector<RVector<3>> x(1000);
+
+    ASSERT_EQ(BatchCholeskySolve(a.data(), b.data(), x.data(), a.size()), 1u);
+    ASSERT_EQ(x[7][0], 0.0f);
+    ASSERT_NEAR(x[999][2], 1.0f, 1e-5f);
+}
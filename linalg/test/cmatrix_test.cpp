@@ -1,8 +1,11 @@
 //
 // Created by Quinton Schwagle on 7/30/22.
 //
+#include <type_traits>
+
 #include "gtest/gtest.h"
 #include "linalg/cmatrix.h"
+#include "linalg/inverse.h"
 
 using namespace QS::LinAlg;
 
@@ -89,3 +92,133 @@ TEST(CMatrix, OverloadSubtraction) {
     ASSERT_FLOAT_EQ(res[1][0], 2.0f);
     ASSERT_FLOAT_EQ(res[1][1], 4.0f);
 }
+
+TEST(CMatrix, OverloadMultiplication)
+{
+    // two columns, three rows
+    const CMatrix<2,3> a = { { 1, 4, 7 },
+                             { 2, 5, 8 } };
+    // three columns, two rows
+    const CMatrix<3,2> b = { { 1, 2 },
+                             { 3, 4 },
+                             { 5, 6 } };
+
+    const CMatrix<3,3> res = a * b;
+
+    // column 0 of the result is a * (1, 2)
+    ASSERT_FLOAT_EQ(res[0][0], 5.0f);
+    ASSERT_FLOAT_EQ(res[0][1], 14.0f);
+    ASSERT_FLOAT_EQ(res[0][2], 23.0f);
+    ASSERT_FLOAT_EQ(res[2][0], 17.0f);
+    ASSERT_FLOAT_EQ(res[2][2], 83.0f);
+}
+
+TEST(CMatrix, OverloadMultiplicationIdentity)
+{
+    const CMatrix<4,4> proj = OrthographicProjection(0.0f, 800.0f, 600.0f, 0.0f, 1.0f, 0.0f);
+
+    const CMatrix<4,4> res = Identity<4>() * proj;
+    const CMatrix<4,4> res2 = proj * Identity<4>();
+
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            ASSERT_FLOAT_EQ(res[i][j], proj[i][j]);
+            ASSERT_FLOAT_EQ(res2[i][j], proj[i][j]);
+        }
+    }
+}
+
+TEST(CMatrix, OverloadMultiplication4x4)
+{
+    CMatrix<4,4> a;
+    CMatrix<4,4> b;
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            a[i][j] = static_cast<float>(i * 4 + j);
+            b[i][j] = static_cast<float>(j - i) * 0.5f;
+        }
+    }
+
+    const CMatrix<4,4> res = a * b;
+
+    for (int c = 0; c < 4; ++c) {
+        for (int r = 0; r < 4; ++r) {
+            float expected = 0.0f;
+            for (int k = 0; k < 4; ++k) {
+                expected += a[k][r] * b[c][k];
+            }
+            ASSERT_FLOAT_EQ(res[c][r], expected);
+        }
+    }
+}
+
+TEST(CMatrix, OverloadVectorMultiplication)
+{
+    const CMatrix<4,4> proj = OrthographicProjection(0.0f, 800.0f, 600.0f, 0.0f, 1.0f, 0.0f);
+    const CVector<4> top_right = { 800.0f, 600.0f, 0.0f, 1.0f };
+
+    const CVector<4> res = proj * top_right;
+
+    ASSERT_FLOAT_EQ(res[0], 1.0f);
+    ASSERT_FLOAT_EQ(res[1], 1.0f);
+    ASSERT_FLOAT_EQ(res[3], 1.0f);
+
+    const CMatrix<2,3> a = { { 1, 4, 7 },
+                             { 2, 5, 8 } };
+    const CVector<3> res2 = a * CVector<2>{ 1, 2 };
+
+    ASSERT_FLOAT_EQ(res2[0], 5.0f);
+    ASSERT_FLOAT_EQ(res2[1], 14.0f);
+    ASSERT_FLOAT_EQ(res2[2], 23.0f);
+}
+
+TEST(CMatrix, DoubleElements)
+{
+    const CMatrix<2,2,double> a = { { 1.0, 3.0 },
+                                    { 2.0, 4.0 } };
+    const CMatrix<2,2,double> b = Identity<2, double>() * 2.0;
+
+    const CMatrix<2,2,double> res = a * b + a;
+    const CVector<2,double> v = a * CVector<2,double>{ 1.0, 1.0 };
+
+    ASSERT_DOUBLE_EQ(res[0][1], 9.0);
+    ASSERT_DOUBLE_EQ(res[1][0], 6.0);
+    ASSERT_DOUBLE_EQ(v[0], 3.0);
+    ASSERT_DOUBLE_EQ(v[1], 7.0);
+}
+
+TEST(CMatrix, ConvertsElementType)
+{
+    const CMatrix<2,2> a = { 1.0f, 2.0f, 3.0f, 4.0f };
+    const CMatrix<2,2,double> b = a;
+    const auto product = a * b;
+
+    static_assert(std::is_same_v<decltype(product)::value_type, double>);
+    ASSERT_DOUBLE_EQ(b[1][0], 3.0);
+    ASSERT_DOUBLE_EQ(product[0][0], 7.0);
+}
+
+TEST(CMatrix, Padded)
+{
+    const CMatrix<4,4> a = OrthographicProjection(0.0f, 800.0f, 0.0f, 600.0f, 1.0f, -1.0f);
+    const PaddedCMatrix<4,4> padded = a;
+    static_assert(alignof(PaddedCMatrix<4,4>) == 64 && sizeof(PaddedCMatrix<4,4>) == 64);
+    static_assert(alignof(CMatrix<3,3,float,16>) == 16 && sizeof(CMatrix<3,3,float,16>) == 48);
+    static_assert(Expr::Dense<PaddedCMatrix<4,4>>);
+
+    // padded and plain matrices and vectors mix in expressions
+    const PaddedCVector<4> p = { 400.0f, 300.0f, 0.0f, 1.0f };
+    const CVector<4> expected = a * CVector<4>{ 400.0f, 300.0f, 0.0f, 1.0f };
+    const CVector<4> actual = padded * p;
+    const PaddedCMatrix<4,4> sum = padded + a;
+    for (size_t i = 0; i < 4; ++i) {
+        ASSERT_FLOAT_EQ(actual[i], expected[i]);
+        ASSERT_FLOAT_EQ(sum[3][i], 2.0f * a[3][i]);
+    }
+
+    const PaddedCMatrix<4,4> inverse = AffineInverse(padded);
+    const CMatrix<4,4> identity = inverse * a;
+    for (size_t i = 0; i < 4; ++i) {
+        ASSERT_NEAR(identity[i][i], 1.0f, 1e-5f);
+    }
+}
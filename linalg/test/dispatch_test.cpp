@@ -0,0 +1,211 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "linalg/dispatch.h"
+#include "linalg/dmatrix.h"
+#include "linalg/gemm.h"
+#include "linalg/simd.h"
+#include "linalg/sparse.h"
+#include "linalg/transform.h"
+
+using namespace QS::LinAlg;
+
+namespace {
+    constexpr Dispatch::Tier kTiers[] = { Dispatch::Tier::Scalar, Dispatch::Tier::Sse, Dispatch::Tier::Avx2,
+                                          Dispatch::Tier::Avx512 };
+
+    /**
+     * Runs check once on every tier this machine supports, then restores the current one
+     */
+    template<typename F>
+    void ForEachTier(F check)
+    {
+        const Dispatch::Tier current = Dispatch::GetTier();
+        for (const Dispatch::Tier tier: kTiers) {
+            if (tier > Dispatch::GetSupportedTier()) {
+                break;
+            }
+            Dispatch::SetTier(tier);
+            ASSERT_EQ(Dispatch::GetKernels().tier, tier);
+            check(tier);
+        }
+        Dispatch::SetTier(current);
+    }
+}
+
+TEST(Dispatch, Tiers)
+{
+    ASSERT_LE(Dispatch::GetTier(), Dispatch::GetSupportedTier());
+    for (const Dispatch::Tier tier: kTiers) {
+        ASSERT_EQ(Dispatch::ParseTier(Dispatch::GetTierName(tier)), tier);
+    }
+    ASSERT_FALSE(Dispatch::ParseTier("avx9000").has_value());
+    ASSERT_FALSE(Dispatch::ParseTier("").has_value());
+#ifndef QS_LINALG_DISPATCH
+    ASSERT_EQ(Dispatch::GetSupportedTier(), Dispatch::Tier::Scalar);
+#endif
+    if (Dispatch::GetSupportedTier() < Dispatch::Tier::Avx512) {
+        ASSERT_THROW(Dispatch::SetTier(Dispatch::Tier::Avx512), std::invalid_argument);
+    }
+}
+
+TEST(Dispatch, ReductionsAgreeAcrossTiers)
+{
+    // odd lengths exercise the remainders of every register width
+    for (const size_t n: { 0, 1, 7, 15, 17, 33, 65, 130, 1000 }) {
+        std::vector<float> a(n), b(n);
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = static_cast<float>(i % 11) * 0.5f - 2.0f;
+            b[i] = static_cast<float>(i % 7) * 0.25f;
+        }
+        const float dot = Simd::Dot<float>(a.data(), b.data(), n);
+        const float sum = Simd::Sum<float>(a.data(), n);
+        ForEachTier([&](Dispatch::Tier tier) {
+            ASSERT_NEAR(Simd::Dot(a.data(), b.data(), n), dot, 1e-3f) << Dispatch::GetTierName(tier) << " " << n;
+            ASSERT_NEAR(Simd::Sum(a.data(), n), sum, 1e-3f) << Dispatch::GetTierName(tier) << " " << n;
+
+            std::vector<float> y(n + 1, 1.0f);
+            Simd::Axpy(2.0f, a.data(), y.data(), n);
+            for (size_t i = 0; i < n; ++i) {
+                ASSERT_EQ(y[i], 1.0f + 2.0f * a[i]);
+            }
+            // the masked tails must not write past n
+            ASSERT_EQ(y[n], 1.0f);
+        });
+    }
+}
+
+TEST(Dispatch, SparseDotAgreesAcrossTiers)
+{
+    // small integers keep the sums exact; the lengths leave remainders of every gather width
+    std::vector<float> x(300);
+    for (size_t i = 0; i < x.size(); ++i) {
+        x[i] = static_cast<float>(i % 17) - 8.0f;
+    }
+    for (const size_t n: { 0, 1, 7, 15, 17, 33, 65, 130 }) {
+        std::vector<float> values(n);
+        std::vector<uint32_t> indices(n);
+        for (size_t k = 0; k < n; ++k) {
+            values[k] = static_cast<float>(k % 5) - 2.0f;
+            indices[k] = static_cast<uint32_t>((k * 37) % x.size());
+        }
+        const float expected = Detail::SparseDot<float>(values.data(), indices.data(), n, x.data());
+        ForEachTier([&](Dispatch::Tier tier) {
+            ASSERT_EQ(Detail::SparseDot(values.data(), indices.data(), n, x.data()), expected)
+                    << Dispatch::GetTierName(tier) << " " << n;
+        });
+    }
+}
+
+TEST(Dispatch, TransformsAgreeAcrossTiers)
+{
+    const CMatrix<4, 4> m = { { 0.0f, 1.0f, 0.0f, 0.0f },
+                              { -2.0f, 0.0f, 0.0f, 0.0f },
+                              { 0.0f, 0.0f, 1.0f, 0.5f },
+                              { 3.0f, 4.0f, 5.0f, 1.0f } };
+    // position, normal and a trailing attribute per vertex
+    constexpr size_t stride = 7;
+    constexpr size_t count = 19;
+    std::vector<float> vertices(stride * count);
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        vertices[i] = static_cast<float>(i % 13) - 6.0f;
+    }
+
+    ForEachTier([&](Dispatch::Tier tier) {
+        std::vector<float> positions = vertices;
+        std::vector<float> homogeneous = vertices;
+        TransformPositions(m, positions.data(), stride, count);
+        TransformHomogeneous(m, homogeneous.data(), stride, count);
+        for (size_t v = 0; v < count; ++v) {
+            const float *in = vertices.data() + v * stride;
+            const CVector<4> p = m * CVector<4>{ in[0], in[1], in[2], 1.0f };
+            const CVector<4> h = m * CVector<4>{ in[0], in[1], in[2], in[3] };
+            for (size_t r = 0; r < 3; ++r) {
+                ASSERT_FLOAT_EQ(positions[v * stride + r], p[r]) << Dispatch::GetTierName(tier) << " " << v;
+            }
+            for (size_t r = 0; r < 4; ++r) {
+                ASSERT_FLOAT_EQ(homogeneous[v * stride + r], h[r]) << Dispatch::GetTierName(tier) << " " << v;
+            }
+            // everything after the transformed components is untouched
+            ASSERT_EQ(positions[v * stride + 3], in[3]);
+            ASSERT_EQ(homogeneous[v * stride + 4], in[4]);
+        }
+    });
+}
+
+TEST(Dispatch, GemmAgreesAcrossTiers)
+{
+    // small integers keep every sum exact, so all tiers must agree to the bit. The sizes leave
+    // partial panels of every tile width and more than one block of the shared dimension.
+    const size_t sizes[][3] = { { 1, 1, 1 }, { 5, 9, 3 }, { 37, 70, 300 }, { 70, 33, 17 } };
+    for (const auto &size: sizes) {
+        const size_t m = size[0], n = size[1], k = size[2];
+        // a row major, b column major and c row major with a padded row
+        const size_t ldc = n + 3;
+        std::vector<float> a(m * k), b(k * n), c(m * ldc);
+        for (size_t i = 0; i < a.size(); ++i) {
+            a[i] = static_cast<float>(i % 13) - 6.0f;
+        }
+        for (size_t i = 0; i < b.size(); ++i) {
+            b[i] = static_cast<float>(i % 7) * 0.5f;
+        }
+        for (size_t i = 0; i < c.size(); ++i) {
+            c[i] = static_cast<float>(i % 5);
+        }
+        std::vector<float> expected = c;
+        // accessors other than Gemm::Strided take the generic path
+        Gemm::MultiplyAdd<float>(m, n, k, 2.0f, [&a, k](size_t i, size_t p) { return a[i * k + p]; },
+                                 [&b, k](size_t p, size_t j) { return b[j * k + p]; }, 0.5f,
+                                 [&expected, ldc](size_t i, size_t j) -> float & { return expected[i * ldc + j]; });
+
+        ForEachTier([&](Dispatch::Tier tier) {
+            std::vector<float> out = c;
+            Simd::Gemm(m, n, k, 2.0f, a.data(), k, 1, b.data(), 1, k, 0.5f, out.data(), ldc, 1);
+            ASSERT_EQ(out, expected) << Dispatch::GetTierName(tier) << " " << m << "x" << n << "x" << k;
+
+            // a beta of zero ignores what c held
+            std::fill(out.begin(), out.end(), std::numeric_limits<float>::quiet_NaN());
+            Simd::Gemm(m, n, k, 1.0f, a.data(), k, 1, b.data(), 1, k, 0.0f, out.data(), ldc, 1);
+            for (size_t i = 0; i < m; ++i) {
+                for (size_t j = 0; j < n; ++j) {
+                    ASSERT_EQ(out[i * ldc + j], (expected[i * ldc + j] - 0.5f * c[i * ldc + j]) / 2.0f);
+                }
+                // the padding after each row is left alone
+                ASSERT_TRUE(std::isnan(out[i * ldc + n]));
+            }
+        });
+    }
+}
+
+TEST(Dispatch, MatrixProductUsesGemm)
+{
+    DMatrix<float> a(45, 20);
+    DMatrix<float, Layout::ColumnMajor> b(20, 38);
+    for (size_t i = 0; i < a.GetSize(); ++i) {
+        a.GetData()[i] = static_cast<float>(i % 9) - 4.0f;
+    }
+    for (size_t i = 0; i < b.GetSize(); ++i) {
+        b.GetData()[i] = static_cast<float>(i % 5);
+    }
+    ForEachTier([&](Dispatch::Tier tier) {
+        const DMatrix<float> c = a * b;
+        for (size_t i = 0; i < c.GetRows(); ++i) {
+            for (size_t j = 0; j < c.GetCols(); ++j) {
+                float sum = 0.0f;
+                for (size_t p = 0; p < a.GetCols(); ++p) {
+                    sum += a(i, p) * b(p, j);
+                }
+                ASSERT_EQ(c(i, j), sum) << Dispatch::GetTierName(tier) << " " << i << " " << j;
+            }
+        }
+    });
+}
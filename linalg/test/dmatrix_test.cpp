@@ -0,0 +1,136 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <cstdint>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+#include "linalg/cmatrix.h"
+#include "linalg/dmatrix.h"
+#include "linalg/rmatrix.h"
+
+using namespace QS::LinAlg;
+
+TEST(DMatrix, Constructor)
+{
+    DMatrix<> m(3, 5);
+    ASSERT_EQ(m.GetRows(), 3);
+    ASSERT_EQ(m.GetCols(), 5);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(m.GetData()) % kCacheLineSize, 0);
+    ASSERT_FLOAT_EQ(m(2, 4), 0.0f);
+}
+
+TEST(DMatrix, Layouts)
+{
+    DMatrix<float, Layout::RowMajor> r = { { 1, 2, 3 },
+                                           { 4, 5, 6 } };
+    DMatrix<float, Layout::ColumnMajor> c = { { 1, 2, 3 },
+                                              { 4, 5, 6 } };
+
+    ASSERT_FLOAT_EQ(r(1, 0), 4.0f);
+    ASSERT_FLOAT_EQ(c(1, 0), 4.0f);
+    ASSERT_FLOAT_EQ(r.GetData()[1], 2.0f);
+    ASSERT_FLOAT_EQ(c.GetData()[1], 4.0f);
+}
+
+TEST(DMatrix, FromFixedSize)
+{
+    const RMatrix<2,3> rm = { { 1, 2, 3 },
+                              { 4, 5, 6 } };
+    const CMatrix<3,2> cm = { { 1, 4 },
+                              { 2, 5 },
+                              { 3, 6 } };
+
+    const DMatrix<> a(rm);
+    const DMatrix<> b(cm);
+
+    ASSERT_EQ(b.GetRows(), 2);
+    ASSERT_EQ(b.GetCols(), 3);
+    for (size_t i = 0; i < 2; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            ASSERT_FLOAT_EQ(a(i, j), b(i, j));
+        }
+    }
+}
+
+TEST(DMatrix, ElementWise)
+{
+    const DMatrix<float, Layout::RowMajor> a = { { 1, 2 },
+                                                 { 3, 4 } };
+    const DMatrix<float, Layout::ColumnMajor> b = { { 1, 1 },
+                                                    { 2, 2 } };
+
+    const DMatrix<> sum = a + b;
+    const DMatrix<> diff = a - b;
+    const DMatrix<> scaled = a * 3.0f;
+
+    ASSERT_FLOAT_EQ(sum(1, 0), 5.0f);
+    ASSERT_FLOAT_EQ(diff(0, 1), 1.0f);
+    ASSERT_FLOAT_EQ(scaled(1, 1), 12.0f);
+}
+
+TEST(DMatrix, Multiply)
+{
+    const DMatrix<float, Layout::RowMajor> a = { { 1, 2, 3 },
+                                                 { 4, 5, 6 } };
+    const DMatrix<float, Layout::ColumnMajor> b = { { 7, 8 },
+                                                    { 9, 10 },
+                                                    { 11, 12 } };
+
+    const DMatrix<> res = a * b;
+
+    ASSERT_EQ(res.GetRows(), 2);
+    ASSERT_EQ(res.GetCols(), 2);
+    ASSERT_FLOAT_EQ(res(0, 0), 58.0f);
+    ASSERT_FLOAT_EQ(res(0, 1), 64.0f);
+    ASSERT_FLOAT_EQ(res(1, 0), 139.0f);
+    ASSERT_FLOAT_EQ(res(1, 1), 154.0f);
+}
+
+TEST(DMatrix, MultiplyVector)
+{
+    const DMatrix<float, Layout::RowMajor> r = { { 1, 2, 3 },
+                                                 { 4, 5, 6 } };
+    const DMatrix<float, Layout::ColumnMajor> c = { { 1, 2, 3 },
+                                                    { 4, 5, 6 } };
+    const DVector<> v = { 1, 1, 2 };
+
+    const DVector<> res = r * v;
+    const DVector<> res2 = c * v;
+
+    ASSERT_FLOAT_EQ(res[0], 9.0f);
+    ASSERT_FLOAT_EQ(res[1], 21.0f);
+    ASSERT_FLOAT_EQ(res2[0], 9.0f);
+    ASSERT_FLOAT_EQ(res2[1], 21.0f);
+}
+
+TEST(DMatrix, Large)
+{
+    // sizes that would not fit comfortably in a std::array on the stack
+    const size_t n = 300;
+    DMatrix<> a(n, n);
+    DMatrix<float, Layout::ColumnMajor> identity(n, n);
+    for (size_t i = 0; i < n; ++i) {
+        identity(i, i) = 1.0f;
+        for (size_t j = 0; j < n; ++j) {
+            a(i, j) = static_cast<float>((i * 7 + j) % 11);
+        }
+    }
+
+    const DMatrix<> res = a * identity;
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            ASSERT_FLOAT_EQ(res(i, j), a(i, j));
+        }
+    }
+}
+
+TEST(DMatrix, MismatchedDimensions)
+{
+    const DMatrix<> a(2, 3);
+    const DMatrix<> b(2, 3);
+    ASSERT_THROW((void) (a * b), std::invalid_argument);
+    ASSERT_THROW((void) (a + DMatrix<>(3, 2)), std::invalid_argument);
+}
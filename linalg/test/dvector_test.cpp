@@ -0,0 +1,79 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <stdexcept>
+#include <type_traits>
+
+#include "gtest/gtest.h"
+#include "linalg/cvector.h"
+#include "linalg/dvector.h"
+
+using namespace QS::LinAlg;
+
+static_assert(!std::is_copy_constructible_v<DVector<>>);
+static_assert(std::is_nothrow_move_constructible_v<DVector<>>);
+
+TEST(DVector, Constructor)
+{
+    DVector<> vec(5);
+    ASSERT_EQ(vec.GetSize(), 5);
+    for (size_t i = 0; i < vec.GetSize(); ++i) {
+        ASSERT_FLOAT_EQ(vec[i], 0.0f);
+    }
+}
+
+TEST(DVector, ListInitializer)
+{
+    DVector<double> vec = { 1.0, 2.0, 3.0 };
+    ASSERT_EQ(vec.GetSize(), 3);
+    ASSERT_DOUBLE_EQ(vec[2], 3.0);
+}
+
+TEST(DVector, FromFixedSize)
+{
+    const CVector<3> fixed = { 1.0f, 2.0f, 3.0f };
+    const DVector<> vec(fixed * 2.0f);
+    ASSERT_EQ(vec.GetSize(), 3);
+    ASSERT_FLOAT_EQ(vec[1], 4.0f);
+}
+
+TEST(DVector, Clone)
+{
+    const DVector<> vec = { 1.0f, 2.0f };
+    DVector<> copy = vec.Clone();
+    copy[0] = 5.0f;
+    ASSERT_FLOAT_EQ(vec[0], 1.0f);
+    ASSERT_FLOAT_EQ(copy[0], 5.0f);
+}
+
+TEST(DVector, Arithmetic)
+{
+    DVector<> a(37);
+    DVector<> b(37);
+    for (size_t i = 0; i < 37; ++i) {
+        a[i] = static_cast<float>(i);
+        b[i] = 1.0f;
+    }
+
+    const DVector<> sum = a + b;
+    const DVector<> diff = a - b;
+    const DVector<> scaled = 2.0f * a;
+    const DVector<> chained = a + b + b;
+
+    for (size_t i = 0; i < 37; ++i) {
+        ASSERT_FLOAT_EQ(sum[i], static_cast<float>(i) + 1.0f);
+        ASSERT_FLOAT_EQ(diff[i], static_cast<float>(i) - 1.0f);
+        ASSERT_FLOAT_EQ(scaled[i], 2.0f * static_cast<float>(i));
+        ASSERT_FLOAT_EQ(chained[i], static_cast<float>(i) + 2.0f);
+    }
+    ASSERT_FLOAT_EQ(a * b, 666.0f);
+}
+
+TEST(DVector, MismatchedLengths)
+{
+    DVector<> a(3);
+    const DVector<> b(4);
+    ASSERT_THROW(a += b, std::invalid_argument);
+    ASSERT_THROW((void) (a * b), std::invalid_argument);
+}
@@ -0,0 +1,192 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <random>
+
+#include "gtest/gtest.h"
+#include "linalg/eigen.h"
+
+using namespace QS::LinAlg;
+
+namespace {
+    template<int cols, int rows, typename T>
+    CMatrix<cols, rows, T> RandomMatrix(std::mt19937 &rng) {
+        std::uniform_real_distribution<T> value(-1, 1);
+        CMatrix<cols, rows, T> out;
+        for (size_t c = 0; c < cols; ++c) {
+            for (size_t r = 0; r < rows; ++r) {
+                out[c][r] = value(rng);
+            }
+        }
+        return out;
+    }
+
+    template<int n, typename T>
+    CMatrix<n, n, T> RandomSymmetric(std::mt19937 &rng) {
+        CMatrix<n, n, T> out = RandomMatrix<n, n, T>(rng);
+        for (size_t c = 0; c < n; ++c) {
+            for (size_t r = 0; r < c; ++r) {
+                out[r][c] = out[c][r];
+            }
+        }
+        return out;
+    }
+
+    /**
+     * columns of m are orthonormal
+     */
+    template<int cols, int rows, typename T>
+    void ExpectOrthonormal(const CMatrix<cols, rows, T> &m, const T tolerance) {
+        for (size_t i = 0; i < cols; ++i) {
+            for (size_t j = 0; j < cols; ++j) {
+                ASSERT_NEAR(m[i] * m[j], i == j ? T(1) : T(), tolerance) << i << ", " << j;
+            }
+        }
+    }
+
+    template<int cols, int rows, typename T>
+    void ExpectSvd(const CMatrix<cols, rows, T> &a, const T tolerance) {
+        const SVD<CMatrix<cols, rows, T>> svd(a);
+        ASSERT_TRUE(svd.IsConverged());
+        const CVector<cols, T> &sigma = svd.GetSingularValues();
+        for (size_t k = 0; k < cols; ++k) {
+            ASSERT_GE(sigma[k], T());
+            if (k > 0) {
+                ASSERT_GE(sigma[k - 1], sigma[k] - tolerance);
+            }
+        }
+        ExpectOrthonormal(svd.GetV(), tolerance);
+        for (size_t r = 0; r < rows; ++r) {
+            for (size_t c = 0; c < cols; ++c) {
+                T sum = T();
+                for (size_t k = 0; k < cols; ++k) {
+                    sum += svd.GetU()[k][r] * sigma[k] * svd.GetV()[k][c];
+                }
+                ASSERT_NEAR(sum, a[c][r], tolerance) << r << ", " << c;
+            }
+        }
+    }
+
+    template<int n, typename T>
+    void ExpectEigen(const CMatrix<n, n, T> &a, const T tolerance) {
+        const SymmetricEigen<CMatrix<n, n, T>> eigen(a);
+        ASSERT_TRUE(eigen.IsConverged());
+        ExpectOrthonormal(eigen.GetVectors(), tolerance);
+        for (size_t k = 0; k < n; ++k) {
+            if (k > 0) {
+                ASSERT_LE(eigen.GetValues()[k - 1], eigen.GetValues()[k]);
+            }
+            const CVector<n, T> v = eigen.GetVectors()[k];
+            const CVector<n, T> av = a * v;
+            for (size_t r = 0; r < n; ++r) {
+                ASSERT_NEAR(av[r], eigen.GetValues()[k] * v[r], tolerance) << "eigenpair " << k;
+            }
+        }
+    }
+}
+
+TEST(Eigen, KnownSpectrum)
+{
+    const CMatrix<3, 3, double> a = { { 2.0, 1.0, 0.0 },
+                                      { 1.0, 2.0, 0.0 },
+                                      { 0.0, 0.0, 3.0 } };
+    const SymmetricEigen<CMatrix<3, 3, double>> eigen(a);
+
+    ASSERT_NEAR(eigen.GetValues()[0], 1.0, 1e-14);
+    ASSERT_NEAR(eigen.GetValues()[1], 3.0, 1e-14);
+    ASSERT_NEAR(eigen.GetValues()[2], 3.0, 1e-14);
+    ExpectEigen(a, 1e-14);
+    ExpectEigen(Identity<3, double>(), 1e-14);
+}
+
+TEST(Eigen, RandomSymmetric)
+{
+    std::mt19937 rng(3);
+    for (int i = 0; i < 100; ++i) {
+        ExpectEigen(RandomSymmetric<3, double>(rng), 1e-13);
+        ExpectEigen(RandomSymmetric<3, float>(rng), 2e-6f);
+        ExpectEigen(RandomSymmetric<6, double>(rng), 1e-13);
+        ExpectEigen(RandomSymmetric<5, float>(rng), 1e-5f);
+    }
+}
+
+TEST(Svd, Random3x3)
+{
+    std::mt19937 rng(5);
+    for (int i = 0; i < 100; ++i) {
+        ExpectSvd(RandomMatrix<3, 3, double>(rng), 1e-13);
+        ExpectSvd(RandomMatrix<3, 3, float>(rng), 1e-5f);
+    }
+}
+
+TEST(Svd, Degenerate3x3)
+{
+    // a reflection, a rank one and the zero matrix
+    ExpectSvd(CMatrix<3, 3, double>{ { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, -2.0 } }, 1e-14);
+    ExpectSvd(CMatrix<3, 3, double>{ { 1.0, 2.0, 3.0 }, { 2.0, 4.0, 6.0 }, { -1.0, -2.0, -3.0 } }, 1e-13);
+    const SVD<CMatrix<3, 3>> zero(CMatrix<3, 3>{});
+    ASSERT_EQ(zero.GetSingularValues()[0], 0.0f);
+    ExpectOrthonormal(zero.GetU(), 0.0f);
+}
+
+TEST(Svd, General)
+{
+    std::mt19937 rng(7);
+    for (int i = 0; i < 50; ++i) {
+        ExpectSvd(RandomMatrix<4, 6, double>(rng), 1e-13);
+        ExpectSvd(RandomMatrix<2, 2, float>(rng), 1e-5f);
+    }
+    const SVD<CMatrix<2, 2, double>> svd(CMatrix<2, 2, double>{ { 3.0, 0.0 }, { 0.0, -4.0 } });
+    ASSERT_NEAR(svd.GetSingularValues()[0], 4.0, 1e-15);
+    ASSERT_NEAR(svd.GetSingularValues()[1], 3.0, 1e-15);
+}
+
+TEST(Eigen, BatchMatchesSingle)
+{
+    std::mt19937 rng(11);
+    // not a multiple of the SIMD width, to cover the scalar tail
+    constexpr size_t count = 1031;
+    VectorArray<6> symmetric(count);
+    VectorArray<9> general(count);
+    for (size_t i = 0; i < count; ++i) {
+        const CMatrix<3, 3> s = RandomSymmetric<3, float>(rng);
+        symmetric[i] = RVector<6>{ s[0][0], s[1][0], s[2][0], s[1][1], s[2][1], s[2][2] };
+        const CMatrix<3, 3> m = RandomMatrix<3, 3, float>(rng);
+        for (size_t c = 0; c < 9; ++c) {
+            general[i][c] = m[c / 3][c % 3];
+        }
+    }
+
+    VectorArray<3> values, sigma;
+    VectorArray<9> vectors, u, v;
+    BatchSymmetricEigen(symmetric, values, vectors);
+    BatchSvd(general, u, sigma, v);
+
+    ASSERT_EQ(values.GetSize(), count);
+    ASSERT_EQ(sigma.GetSize(), count);
+    for (size_t i = 0; i < count; ++i) {
+        CMatrix<3, 3> s, m;
+        for (size_t c = 0; c < 9; ++c) {
+            m[c / 3][c % 3] = general[i][c];
+        }
+        const RVector<6> upper = symmetric[i];
+        s = { { upper[0], upper[1], upper[2] }, { upper[1], upper[3], upper[4] }, { upper[2], upper[4], upper[5] } };
+        const SymmetricEigen<CMatrix<3, 3>> eigen(s);
+        const SVD<CMatrix<3, 3>> svd(m);
+        for (size_t k = 0; k < 3; ++k) {
+            ASSERT_NEAR(values[i][k], eigen.GetValues()[k], 1e-5f) << i;
+            ASSERT_NEAR(sigma[i][k], svd.GetSingularValues()[k], 1e-5f) << i;
+        }
+        for (size_t c = 0; c < 9; ++c) {
+            ASSERT_NEAR(vectors[i][c], eigen.GetVectors()[c / 3][c % 3], 1e-4f) << i;
+            ASSERT_NEAR(u[i][c], svd.GetU()[c / 3][c % 3], 1e-4f) << i;
+            ASSERT_NEAR(v[i][c], svd.GetV()[c / 3][c % 3], 1e-4f) << i;
+        }
+    }
+
+    VectorArray<3, double> doubleValues;
+    VectorArray<9, double> doubleVectors;
+    BatchSymmetricEigen(VectorArray<6, double>{ { 2.0, 1.0, 0.0, 2.0, 0.0, 3.0 } }, doubleValues, doubleVectors);
+    ASSERT_NEAR(doubleValues[0][0], 1.0, 1e-14);
+}
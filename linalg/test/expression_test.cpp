@@ -0,0 +1,175 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <type_traits>
+
+#include "gtest/gtest.h"
+#include "linalg/cmatrix.h"
+#include "linalg/rmatrix.h"
+
+using namespace QS::LinAlg;
+
+TEST(Expression, OperatorsAreLazy)
+{
+    const RVector<3> a = { 1.0f, 2.0f, 3.0f };
+    const RVector<3> b = { 4.0f, 5.0f, 6.0f };
+
+    auto expr = a * 2.0f + b;
+
+    static_assert(!std::is_same_v<decltype(expr), RVector<3>>);
+    ASSERT_FLOAT_EQ(expr[0], 6.0f);
+    ASSERT_FLOAT_EQ(expr[2], 12.0f);
+}
+
+TEST(Expression, ChainEvaluatesIntoVector)
+{
+    const RVector<3> a = { 1.0f, 2.0f, 3.0f };
+    const RVector<3> b = { 4.0f, 5.0f, 6.0f };
+    const RVector<3> c = { 1.0f, 1.0f, 1.0f };
+
+    const RVector<3> res = a * 3.0f + b - c;
+
+    ASSERT_FLOAT_EQ(res[0], 6.0f);
+    ASSERT_FLOAT_EQ(res[1], 10.0f);
+    ASSERT_FLOAT_EQ(res[2], 14.0f);
+}
+
+TEST(Expression, TemporaryOperandOutlivesStatement)
+{
+    const RVector<3> position = { 1.0f, 2.0f, 3.0f };
+
+    // the temporary is moved into the expression so this does not dangle
+    auto moved = position + RVector<3>{ 10.0f, 10.0f, 0.0f };
+    const RVector<3> res = moved + RVector<3>{ 1.0f, 1.0f, 1.0f };
+
+    ASSERT_FLOAT_EQ(res[0], 12.0f);
+    ASSERT_FLOAT_EQ(res[1], 13.0f);
+    ASSERT_FLOAT_EQ(res[2], 4.0f);
+}
+
+TEST(Expression, AssignmentMayAliasOperand)
+{
+    RVector<4> a = { 1.0f, 2.0f, 3.0f, 4.0f };
+    const RVector<4> b = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+    a = b - a * 2.0f;
+
+    ASSERT_FLOAT_EQ(a[0], -1.0f);
+    ASSERT_FLOAT_EQ(a[3], -7.0f);
+}
+
+TEST(Expression, CompoundAssignment)
+{
+    CVector<3> a = { 1.0f, 2.0f, 3.0f };
+    const CVector<3> b = { 1.0f, 1.0f, 1.0f };
+
+    a += b * 2.0f;
+    a -= b + b;
+
+    ASSERT_FLOAT_EQ(a[0], 1.0f);
+    ASSERT_FLOAT_EQ(a[1], 2.0f);
+    ASSERT_FLOAT_EQ(a[2], 3.0f);
+}
+
+TEST(Expression, DotOfExpressions)
+{
+    const CVector<2> a = { 1.0f, 2.0f };
+    const CVector<2> b = { 3.0f, 4.0f };
+
+    ASSERT_FLOAT_EQ((a + b) * (a - b), -20.0f);
+}
+
+TEST(Expression, MatrixChain)
+{
+    const RMatrix<2,2> a = { { 1.0f, 2.0f },
+                             { 3.0f, 4.0f } };
+    const RMatrix<2,2> b = { { 1.0f, 1.0f },
+                             { 1.0f, 1.0f } };
+
+    const RMatrix<2,2> res = a * 2.0f - b + a;
+
+    ASSERT_FLOAT_EQ(res[0][0], 2.0f);
+    ASSERT_FLOAT_EQ(res[0][1], 5.0f);
+    ASSERT_FLOAT_EQ(res[1][0], 8.0f);
+    ASSERT_FLOAT_EQ(res[1][1], 11.0f);
+
+    auto lazy = a - b;
+    ASSERT_FLOAT_EQ(lazy[1][0], 2.0f);
+}
+
+TEST(Expression, ProductOfMatrixExpressions)
+{
+    const CMatrix<2,2> a = { { 1.0f, 0.0f },
+                             { 0.0f, 1.0f } };
+    const CMatrix<2,2> b = { { 1.0f, 2.0f },
+                             { 3.0f, 4.0f } };
+
+    const CMatrix<2,2> res = (a + a) * b;
+    const CVector<2> v = (a + b) * (CVector<2>{ 1.0f, 1.0f } * 2.0f);
+
+    ASSERT_FLOAT_EQ(res[0][0], 2.0f);
+    ASSERT_FLOAT_EQ(res[1][1], 8.0f);
+    ASSERT_FLOAT_EQ(v[0], 10.0f);
+    ASSERT_FLOAT_EQ(v[1], 14.0f);
+}
+
+TEST(Expression, ConstantEvaluation)
+{
+    constexpr RVector<3> a = { 1.0f, 2.0f, 3.0f };
+    constexpr RVector<3> b = a * 2.0f - a + RVector<3>{ 1.0f, 1.0f, 1.0f };
+
+    static_assert(b[0] == 2.0f && b[1] == 3.0f && b[2] == 4.0f);
+}
+
+TEST(Expression, MixedElementTypes)
+{
+    const RVector<3> a = { 1.0f, 2.0f, 3.0f };
+    const RVector<3, double> b = { 0.5, 0.25, 0.125 };
+
+    static_assert(std::is_same_v<Expr::ValueOf<decltype(a + b)>, double>);
+    const RVector<3, double> sum = a + b;
+    const RVector<3> narrowed = a - b;
+
+    ASSERT_DOUBLE_EQ(sum[2], 3.125);
+    ASSERT_FLOAT_EQ(narrowed[0], 0.5f);
+    ASSERT_DOUBLE_EQ(a * b, 1.375);
+}
+
+TEST(Expression, DotAccumulatesInRequestedType)
+{
+    // 1 + 1e-8 rounds back to 1 in float, so the float sum loses every small term
+    RVector<16> a;
+    RVector<16> b;
+    a[0] = 1.0f;
+    b[0] = 1.0f;
+    for (size_t i = 1; i < 16; ++i) {
+        a[i] = 1e-4f;
+        b[i] = 1e-4f;
+    }
+
+    ASSERT_DOUBLE_EQ(Dot<double>(a, b), 1.0 + 15 * static_cast<double>(1e-4f) * 1e-4f);
+    ASSERT_FLOAT_EQ(static_cast<float>(Dot<double>(a * 2.0f, b)), 2.0f);
+}
+
+TEST(Expression, MultiplyAccumulatesInRequestedType)
+{
+    CMatrix<3, 2> a;
+    CMatrix<2, 3> b;
+    a[0] = CVector<2>{ 1e8f, 1.0f };
+    a[1] = CVector<2>{ 1.0f, 1.0f };
+    a[2] = CVector<2>{ -1e8f, 1.0f };
+    b[0] = CVector<3>{ 1.0f, 1.0f, 1.0f };
+    b[1] = CVector<3>{ 1.0f, 1.0f, 1.0f };
+
+    const CMatrix<2, 2> wide = Multiply<double>(a, b);
+    const CVector<2> v = Multiply<double>(a, CVector<3>{ 1.0f, 1.0f, 1.0f });
+    const RMatrix<2, 2, double> r = Multiply<double>(RMatrix<2, 3>{ { 1e8f, 1.0f, -1e8f } }, RMatrix<3, 2>{ { 1.0f, 1.0f },
+                                                                                                          { 1.0f, 1.0f },
+                                                                                                          { 1.0f, 1.0f } });
+
+    static_assert(std::is_same_v<decltype(Multiply<double>(a, b))::value_type, float>);
+    ASSERT_FLOAT_EQ(wide[0][0], 1.0f);
+    ASSERT_FLOAT_EQ(v[0], 1.0f);
+    ASSERT_DOUBLE_EQ(r[0][1], 1.0);
+}
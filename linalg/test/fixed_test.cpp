@@ -0,0 +1,71 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include "gtest/gtest.h"
+#include "linalg/cmatrix.h"
+#include "linalg/fixed.h"
+#include "linalg/rvector.h"
+
+using namespace QS::LinAlg;
+
+using Q16 = Fixed<16>;
+
+static_assert(Q16(1.5f).GetRaw() == 3 << 15);
+static_assert(Q16(-2) * Q16(0.25) == Q16(-0.5));
+static_assert(static_cast<float>(Q16(3) / Q16(4)) == 0.75f);
+static_assert(std::is_same_v<Expr::AccumulatorOf<Q16>, Fixed<16, int64_t>>);
+
+TEST(Fixed, Arithmetic)
+{
+    const Q16 a = 2.5f;
+    const Q16 b = -1.25f;
+
+    ASSERT_FLOAT_EQ(static_cast<float>(a + b), 1.25f);
+    ASSERT_FLOAT_EQ(static_cast<float>(a - b), 3.75f);
+    ASSERT_FLOAT_EQ(static_cast<float>(a * b), -3.125f);
+    ASSERT_FLOAT_EQ(static_cast<float>(a / b), -2.0f);
+    ASSERT_FLOAT_EQ(static_cast<float>(-a), -2.5f);
+    ASSERT_TRUE(b < a);
+    ASSERT_TRUE(a > 0.0f);
+    ASSERT_EQ(static_cast<int>(a), 2);
+}
+
+TEST(Fixed, RoundsToNearestStep)
+{
+    using Q4 = Fixed<4, int16_t>;
+    ASSERT_EQ(Q4(0.03f).GetRaw(), 0);
+    ASSERT_EQ(Q4(0.04f).GetRaw(), 1);
+    ASSERT_EQ(Q4(-0.04f).GetRaw(), -1);
+}
+
+TEST(Fixed, DotAccumulatesInWideRep)
+{
+    // every product is 64, well inside Q7.8, but their sum is not
+    using Q8 = Fixed<8, int16_t>;
+    RVector<4, Q8> a = { 8, 8, 8, 8 };
+    RVector<4, Q8> b = { 8, 8, 8, 8 };
+
+    const Fixed<8, int32_t> sum = Dot<Fixed<8, int32_t>>(a, b);
+
+    ASSERT_FLOAT_EQ(static_cast<float>(sum), 256.0f);
+}
+
+TEST(Fixed, MatrixElements)
+{
+    const CMatrix<2, 2, Q16> a = { { 1, 3 },
+                                   { 2, 4 } };
+    const CMatrix<2, 2, Q16> b = { { 0.5f, 0 },
+                                   { 0, 0.5f } };
+
+    const CMatrix<2, 2, Q16> product = a * b;
+    const CMatrix<2, 2, Q16> sum = a + b * Q16(2);
+    const CVector<2, Q16> v = a * CVector<2, Q16>{ 1, -1 };
+
+    ASSERT_EQ(product[0][0], Q16(0.5f));
+    ASSERT_EQ(product[1][1], Q16(2));
+    ASSERT_EQ(sum[0][0], Q16(2));
+    ASSERT_EQ(sum[1][0], Q16(2));
+    ASSERT_EQ(v[0], Q16(-1));
+    ASSERT_EQ(v[1], Q16(-1));
+}
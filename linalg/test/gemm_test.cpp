@@ -0,0 +1,60 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "linalg/gemm.h"
+
+using namespace QS::LinAlg;
+
+static void CheckAgainstNaive(size_t m, size_t n, size_t k)
+{
+    std::vector<double> a(m * k);
+    std::vector<double> b(k * n);
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = static_cast<double>(i % 17) - 8.0;
+    }
+    for (size_t i = 0; i < b.size(); ++i) {
+        b[i] = static_cast<double>(i % 13) * 0.25;
+    }
+
+    // a is row major, b is column major, c is row major
+    std::vector<double> c(m * n, -1.0);
+    Gemm::Multiply<double>(m, n, k,
+                           [&a, k](size_t i, size_t p) { return a[i * k + p]; },
+                           [&b, k](size_t p, size_t j) { return b[j * k + p]; },
+                           [&c, n](size_t i, size_t j) -> double & { return c[i * n + j]; });
+
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            double expected = 0.0;
+            for (size_t p = 0; p < k; ++p) {
+                expected += a[i * k + p] * b[j * k + p];
+            }
+            ASSERT_DOUBLE_EQ(c[i * n + j], expected) << i << ", " << j;
+        }
+    }
+}
+
+TEST(Gemm, SingleTile)
+{
+    CheckAgainstNaive(4, 4, 4);
+}
+
+TEST(Gemm, EdgeTiles)
+{
+    CheckAgainstNaive(7, 5, 3);
+    CheckAgainstNaive(1, 1, 1);
+}
+
+TEST(Gemm, MultipleBlocks)
+{
+    CheckAgainstNaive(Gemm::kBlockRows + 6, 9, Gemm::kBlockDepth + 44);
+}
+
+TEST(Gemm, EmptyDepth)
+{
+    CheckAgainstNaive(3, 2, 0);
+}
@@ -0,0 +1,79 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <cmath>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+#include "linalg/inverse.h"
+#include "linalg/lu.h"
+
+using namespace QS::LinAlg;
+
+namespace {
+    /// rotation of 0.5 radians about z followed by a translation
+    CMatrix<4, 4> MakeRigid() {
+        const float c = std::cos(0.5f), s = std::sin(0.5f);
+        return { c, s, 0, 0,
+                 -s, c, 0, 0,
+                 0, 0, 1, 0,
+                 3, -2, 7, 1 };
+    }
+
+    void ExpectNear(const CMatrix<4, 4> &a, const CMatrix<4, 4> &b) {
+        for (size_t i = 0; i < 4; ++i) {
+            for (size_t j = 0; j < 4; ++j) {
+                ASSERT_NEAR(a[i][j], b[i][j], 1e-5f) << "column " << i << " row " << j;
+            }
+        }
+    }
+
+    constexpr CMatrix<4, 4> kScale = { 2, 0, 0, 0,
+                                       0, 4, 0, 0,
+                                       0, 0, 8, 0,
+                                       0, 0, 0, 1 };
+}
+
+static_assert(Inverse4x4(kScale)[1][1] == 0.25f);
+static_assert(AffineInverse(kScale)[2][2] == 0.125f);
+
+TEST(Inverse, General)
+{
+    const CMatrix<4, 4> m = { 4, 3, 2, 1,
+                              0, 1, 2, 3,
+                              1, 0, 5, 2,
+                              2, 1, 0, 6 };
+    ExpectNear(Inverse4x4(m), Inverse(m));
+    ExpectNear(m * Inverse4x4(m), Identity<4>());
+}
+
+TEST(Inverse, Projection)
+{
+    const CMatrix<4, 4> m = OrthographicProjection(-3, 5, 2, -2, 10, 1);
+    ExpectNear(Inverse4x4(m) * m, Identity<4>());
+}
+
+TEST(Inverse, Singular)
+{
+    const CMatrix<4, 4> m = { 1, 2, 3, 4,
+                              2, 4, 6, 8,
+                              0, 1, 0, 1,
+                              1, 0, 1, 0 };
+    ASSERT_THROW((void)Inverse4x4(m), std::invalid_argument);
+    ASSERT_THROW((void)AffineInverse(CMatrix<4, 4>()), std::invalid_argument);
+}
+
+TEST(Inverse, Affine)
+{
+    const CMatrix<4, 4> m = MakeRigid() * kScale;
+    ExpectNear(AffineInverse(m), Inverse(m));
+    ExpectNear(AffineInverse(m) * m, Identity<4>());
+}
+
+TEST(Inverse, Rigid)
+{
+    const CMatrix<4, 4> m = MakeRigid();
+    ExpectNear(RigidInverse(m), Inverse(m));
+    ExpectNear(m * RigidInverse(m), Identity<4>());
+}
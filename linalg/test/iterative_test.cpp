@@ -0,0 +1,195 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "linalg/iterative.h"
+
+using namespace QS::LinAlg;
+
+namespace {
+    /**
+     * 5 point finite difference Laplacian on a side x side grid, plus a first order convection term
+     * that makes it nonsymmetric when convection != 0
+     */
+    CsrMatrix<> Laplacian(const size_t side, const float convection = 0.0f) {
+        std::vector<Triplet<>> triplets;
+        for (size_t y = 0; y < side; ++y) {
+            for (size_t x = 0; x < side; ++x) {
+                const size_t i = y * side + x;
+                triplets.push_back({ i, i, 4.0f });
+                if (x > 0) {
+                    triplets.push_back({ i, i - 1, -1.0f - convection });
+                }
+                if (x + 1 < side) {
+                    triplets.push_back({ i, i + 1, -1.0f + convection });
+                }
+                if (y > 0) {
+                    triplets.push_back({ i, i - side, -1.0f });
+                }
+                if (y + 1 < side) {
+                    triplets.push_back({ i, i + side, -1.0f });
+                }
+            }
+        }
+        return CsrMatrix<>::FromTriplets(side * side, side * side, triplets);
+    }
+
+    DVector<> Ones(const size_t n) {
+        DVector<> out(n);
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = 1.0f;
+        }
+        return out;
+    }
+
+    /**
+     * ||b - A x|| / ||b|| computed from scratch
+     */
+    template<class M>
+    double TrueResidual(const M &a, const DVector<> &b, const DVector<> &x) {
+        const DVector<> ax = a * x;
+        double r = 0.0, bb = 0.0;
+        for (size_t i = 0; i < b.GetSize(); ++i) {
+            r += (b[i] - ax[i]) * (b[i] - ax[i]);
+            bb += b[i] * b[i];
+        }
+        return std::sqrt(r / bb);
+    }
+}
+
+TEST(Iterative, ConjugateGradientSparse)
+{
+    const CsrMatrix<> a = Laplacian(40);
+    const DVector<> b = Ones(a.GetRows());
+    DVector<> x(a.GetRows());
+    SolverOptions options;
+    options.tolerance = 1e-5;
+
+    const SolverResult result = ConjugateGradient(a, b, x, options);
+
+    ASSERT_TRUE(result.converged);
+    ASSERT_LE(result.residual, 1e-5);
+    ASSERT_LT(TrueResidual(a, b, x), 1e-4);
+    ASSERT_EQ(result.residuals.size(), result.iterations + 1);
+}
+
+TEST(Iterative, PreconditionersReduceIterations)
+{
+    // scale the rows and columns unevenly so that Jacobi has something to correct
+    const CsrMatrix<> laplacian = Laplacian(40);
+    std::vector<Triplet<>> triplets;
+    for (size_t i = 0; i < laplacian.GetRows(); ++i) {
+        for (size_t k = laplacian.GetOffsets()[i]; k < laplacian.GetOffsets()[i + 1]; ++k) {
+            const size_t j = laplacian.GetIndices()[k];
+            const float scale = (1.0f + static_cast<float>(i % 3)) * (1.0f + static_cast<float>(j % 3));
+            triplets.push_back({ i, j, laplacian.GetValues()[k] * scale });
+        }
+    }
+    const CsrMatrix<> a = CsrMatrix<>::FromTriplets(laplacian.GetRows(), laplacian.GetCols(), triplets);
+    const DVector<> b = Ones(a.GetRows());
+    SolverOptions options;
+    options.tolerance = 1e-4;
+
+    DVector<> plain(a.GetRows()), jacobi(a.GetRows()), cholesky(a.GetRows());
+    const SolverResult plainResult = ConjugateGradient(a, b, plain, options);
+    const SolverResult jacobiResult = ConjugateGradient(a, b, jacobi, JacobiPreconditioner<>(a), options);
+    const SolverResult choleskyResult = ConjugateGradient(a, b, cholesky, IncompleteCholesky<>(a), options);
+
+    ASSERT_TRUE(plainResult.converged);
+    ASSERT_TRUE(jacobiResult.converged);
+    ASSERT_TRUE(choleskyResult.converged);
+    ASSERT_LT(jacobiResult.iterations, plainResult.iterations);
+    ASSERT_LT(choleskyResult.iterations, jacobiResult.iterations);
+    ASSERT_LT(TrueResidual(a, b, cholesky), 1e-4);
+}
+
+TEST(Iterative, IncompleteCholeskyIsExactForTridiagonal)
+{
+    // IC(0) of a tridiagonal matrix has no fill to drop, so it is the exact Cholesky factor and one
+    // iteration solves the system up to rounding
+    std::vector<Triplet<>> triplets;
+    for (size_t i = 0; i < 50; ++i) {
+        triplets.push_back({ i, i, 2.0f });
+        if (i > 0) {
+            triplets.push_back({ i, i - 1, -1.0f });
+            triplets.push_back({ i - 1, i, -1.0f });
+        }
+    }
+    const CscMatrix<> a = CscMatrix<>::FromTriplets(50, 50, triplets);
+    const DVector<> b = Ones(50);
+    DVector<> x(50);
+    SolverOptions options;
+    options.tolerance = 1e-4;
+
+    const SolverResult result = ConjugateGradient(a, b, x, IncompleteCholesky<>(a), options);
+
+    ASSERT_TRUE(result.converged);
+    ASSERT_LE(result.iterations, 2u);
+    ASSERT_THROW((void)IncompleteCholesky<>(CsrMatrix<>::FromTriplets(2, 2, { { 0, 0, -1.0f }, { 1, 1, 1.0f } })),
+                 std::invalid_argument);
+}
+
+TEST(Iterative, BiCgStabNonsymmetric)
+{
+    const CsrMatrix<> a = Laplacian(40, 0.4f);
+    const DVector<> b = Ones(a.GetRows());
+    SolverOptions options;
+    options.tolerance = 1e-5;
+
+    DVector<> plain(a.GetRows()), jacobi(a.GetRows());
+    const SolverResult plainResult = BiCgStab(a, b, plain, options);
+    const SolverResult jacobiResult = BiCgStab(a, b, jacobi, JacobiPreconditioner<>(a), options);
+
+    ASSERT_TRUE(plainResult.converged);
+    ASSERT_TRUE(jacobiResult.converged);
+    ASSERT_LT(TrueResidual(a, b, plain), 1e-4);
+    ASSERT_LT(TrueResidual(a, b, jacobi), 1e-4);
+}
+
+TEST(Iterative, DenseMatrix)
+{
+    const DMatrix<> a = { { 4.0f, 1.0f, 0.0f },
+                          { 1.0f, 3.0f, -1.0f },
+                          { 0.0f, -1.0f, 2.0f } };
+    const DVector<> b = { 1.0f, 2.0f, 3.0f };
+    DVector<> cg(3), bicg(3);
+
+    ASSERT_TRUE(ConjugateGradient(a, b, cg, JacobiPreconditioner<>(a)).converged);
+    ASSERT_TRUE(BiCgStab(a, b, bicg).converged);
+    ASSERT_LT(TrueResidual(a, b, cg), 1e-5);
+    ASSERT_LT(TrueResidual(a, b, bicg), 1e-5);
+}
+
+TEST(Iterative, MonitorAndIterationLimit)
+{
+    const CsrMatrix<> a = Laplacian(30);
+    const DVector<> b = Ones(a.GetRows());
+    DVector<> x(a.GetRows());
+    std::vector<double> seen;
+    SolverOptions options;
+    options.maxIterations = 5;
+    options.monitor = [&seen](size_t iteration, double residual) {
+        ASSERT_EQ(iteration, seen.size() + 1);
+        seen.push_back(residual);
+    };
+
+    const SolverResult result = ConjugateGradient(a, b, x, options);
+
+    ASSERT_FALSE(result.converged);
+    ASSERT_EQ(result.iterations, 5u);
+    ASSERT_EQ(seen.size(), 5u);
+    ASSERT_EQ(seen.back(), result.residual);
+    ASSERT_EQ(result.residuals[0], 1.0);
+}
+
+TEST(Iterative, ChecksDimensions)
+{
+    const CsrMatrix<> a = Laplacian(4);
+    DVector<> x(16);
+    ASSERT_THROW((void)ConjugateGradient(a, DVector<>(15), x), std::invalid_argument);
+    ASSERT_THROW((void)BiCgStab(CsrMatrix<>(3, 4), DVector<>(3), x), std::invalid_argument);
+}
@@ -0,0 +1,145 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <cmath>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+#include "linalg/lu.h"
+
+using namespace QS::LinAlg;
+
+namespace {
+    constexpr RMatrix<3,3> kSystem = { { 2, 1, -1 },
+                                       { -3, -1, 2 },
+                                       { -2, 1, 2 } };
+}
+
+// the decomposition runs during constant evaluation
+static_assert(Detail::Abs(Determinant(kSystem) + 1.0f) < 1e-5f);
+static_assert(Detail::Abs(Solve(kSystem, RVector<3>{ 8, -11, -3 })[0] - 2.0f) < 1e-5f);
+
+TEST(LU, Factors)
+{
+    const LU lu(kSystem);
+    const RMatrix<3,3> product = lu.GetLower() * lu.GetUpper();
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            ASSERT_NEAR(product[i][j], kSystem[lu.GetPermutation()[i]][j], 1e-5f);
+            if (j > i) {
+                ASSERT_FLOAT_EQ(lu.GetLower()[i][j], 0.0f);
+            } else if (j < i) {
+                ASSERT_FLOAT_EQ(lu.GetUpper()[i][j], 0.0f);
+            }
+        }
+    }
+}
+
+TEST(LU, SolveRMatrix)
+{
+    const RVector<3> x = Solve(kSystem, RVector<3>{ 8, -11, -3 });
+    ASSERT_NEAR(x[0], 2.0f, 1e-5f);
+    ASSERT_NEAR(x[1], 3.0f, 1e-5f);
+    ASSERT_NEAR(x[2], -1.0f, 1e-5f);
+}
+
+TEST(LU, InverseCMatrix)
+{
+    const CMatrix<4,4> m = { 4, 3, 2, 1,
+                             0, 1, 2, 3,
+                             1, 0, 5, 2,
+                             2, 1, 0, 6 };
+    const CMatrix<4,4> inverse = Inverse(m);
+    const CMatrix<4,4> identity = m * inverse;
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            ASSERT_NEAR(identity[i][j], i == j ? 1.0f : 0.0f, 1e-5f);
+        }
+    }
+
+    const CVector<4> b = { 1, 2, 3, 4 };
+    const CVector<4> x = Solve(m, b);
+    const CVector<4> residual = m * x - b;
+    for (size_t i = 0; i < 4; ++i) {
+        ASSERT_NEAR(residual[i], 0.0f, 1e-5f);
+    }
+}
+
+TEST(LU, Determinant)
+{
+    ASSERT_FLOAT_EQ(Determinant(Identity<4>()), 1.0f);
+    const RMatrix<2,2> m = { { 0, 2 },
+                             { 3, 4 } };
+    ASSERT_FLOAT_EQ(Determinant(m), -6.0f);
+}
+
+TEST(LU, Singular)
+{
+    const RMatrix<3,3> m = { { 1, 2, 3 },
+                             { 2, 4, 6 },
+                             { 1, 0, 1 } };
+    const LU lu(m);
+    ASSERT_TRUE(lu.IsSingular());
+    ASSERT_FLOAT_EQ(lu.Determinant(), 0.0f);
+    ASSERT_THROW((void)lu.Inverse(), std::invalid_argument);
+    ASSERT_THROW((void)lu.Solve(RVector<3>{ 1, 1, 1 }), std::invalid_argument);
+}
+
+TEST(LU, BlockedDMatrix)
+{
+    // spans several panels so the trailing update is exercised
+    const size_t n = 150;
+    DMatrix<double> m(n, n);
+    DVector<double> b(n);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            m(i, j) = std::sin(static_cast<double>(i * n + j)) + (i == j ? 4.0 : 0.0);
+        }
+        b[i] = static_cast<double>(i % 5);
+    }
+
+    const DVector<double> x = Solve(m, b);
+    const DVector<double> residual = m * x - b;
+    for (size_t i = 0; i < n; ++i) {
+        ASSERT_NEAR(residual[i], 0.0, 1e-9);
+    }
+
+    const DMatrix<double> identity = m * Inverse(m);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            ASSERT_NEAR(identity(i, j), i == j ? 1.0 : 0.0, 1e-9);
+        }
+    }
+}
+
+TEST(LU, BlockedFloatColumnMajor)
+{
+    // float trailing updates run on the dispatched Simd::Gemm, here through column major strides
+    const size_t n = 150;
+    DMatrix<float, Layout::ColumnMajor> m(n, n);
+    DVector<float> b(n);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            m(i, j) = static_cast<float>(std::sin(static_cast<double>(i * n + j))) + (i == j ? 4.0f : 0.0f);
+        }
+        b[i] = static_cast<float>(i % 5);
+    }
+
+    const DVector<float> x = Solve(m, b);
+    const DVector<float> residual = m * x - b;
+    for (size_t i = 0; i < n; ++i) {
+        ASSERT_NEAR(residual[i], 0.0f, 1e-4f);
+    }
+}
+
+TEST(LU, DMatrixDeterminant)
+{
+    const DMatrix<double, Layout::ColumnMajor> m = { { 2, 1, -1 },
+                                                     { -3, -1, 2 },
+                                                     { -2, 1, 2 } };
+    ASSERT_NEAR(Determinant(m), -1.0, 1e-12);
+
+    const DMatrix<double> rectangle(2, 3);
+    ASSERT_THROW(LU<DMatrix<double>>{ rectangle }, std::invalid_argument);
+}
@@ -0,0 +1,114 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "linalg/map.h"
+
+using namespace QS::LinAlg;
+
+TEST(Map, VectorOverBuffer)
+{
+    float buffer[6] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f };
+
+    Map<RVector<3>> a(buffer);
+    const Map<const RVector<3>> b(buffer + 3);
+    static_assert(Expr::Dense<decltype(a)>);
+    static_assert(!std::is_assignable_v<decltype(b), RVector<3>>);
+
+    ASSERT_EQ(a * b, 32.0f);
+    a = a + b * 2.0f;
+    ASSERT_EQ(buffer[0], 9.0f);
+    ASSERT_EQ(buffer[1], 12.0f);
+    ASSERT_EQ(buffer[2], 15.0f);
+
+    const RVector<3> copy = b;
+    ASSERT_EQ(copy[2], 6.0f);
+}
+
+TEST(Map, Strides)
+{
+    float buffer[9] = { 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.0f };
+
+    const Map<CVector<3>, 3> fixed(buffer);
+    const Map<CVector<3>, kDynamicStride> dynamic(buffer, 3);
+    static_assert(!Expr::Dense<decltype(fixed)>);
+    ASSERT_EQ(sizeof(fixed), sizeof(float *));
+
+    ASSERT_EQ(fixed * dynamic, 14.0f);
+    dynamic[1] = 7.0f;
+    ASSERT_EQ(buffer[3], 7.0f);
+    ASSERT_EQ(fixed[1], 7.0f);
+}
+
+TEST(Map, Matrices)
+{
+    const CMatrix<4, 4> projection = OrthographicProjection(0.0f, 800.0f, 0.0f, 600.0f, 1.0f, -1.0f);
+    const CVector<4> p = { 400.0f, 300.0f, 0.0f, 1.0f };
+
+    // e.g. a uniform buffer holding the matrix
+    float uniform[16];
+    std::copy(projection.GetData(), projection.GetData() + 16, uniform);
+    const Map<const CMatrix<4, 4>> mapped(uniform);
+    static_assert(Expr::Dense<decltype(mapped)>);
+
+    const CVector<4> expected = projection * p;
+    const CVector<4> actual = mapped * p;
+    for (size_t i = 0; i < 4; ++i) {
+        ASSERT_EQ(actual[i], expected[i]);
+    }
+
+    // a 2 x 3 window of a row major 4 x 5 image with a pitch of 5
+    std::vector<float> image(20);
+    for (size_t i = 0; i < image.size(); ++i) {
+        image[i] = static_cast<float>(i);
+    }
+    Map<RMatrix<2, 3>, kDynamicStride> window(image.data() + 6, 5);
+    ASSERT_EQ(window[0][0], 6.0f);
+    ASSERT_EQ(window[1][2], 13.0f);
+    ASSERT_EQ(Column(window, 1)[1], 12.0f);
+
+    window += RMatrix<2, 3>{ { 1.0f, 1.0f, 1.0f }, { 1.0f, 1.0f, 1.0f } };
+    ASSERT_EQ(image[6], 7.0f);
+    ASSERT_EQ(image[13], 14.0f);
+    ASSERT_EQ(image[10], 10.0f);
+
+    const RMatrix<2, 2> product = window * RMatrix<3, 2>{ { 1.0f, 0.0f }, { 0.0f, 1.0f }, { 0.0f, 0.0f } };
+    ASSERT_EQ(product[1][1], 13.0f);
+}
+
+TEST(Map, VertexStream)
+{
+    // position, normal and texture coordinates per vertex
+    constexpr size_t stride = 8;
+    std::vector<float> vertices(3 * stride, 1.0f);
+    for (size_t i = 0; i < 3; ++i) {
+        vertices[i * stride] = static_cast<float>(i);
+    }
+
+    const MapArray<RVector<3>> positions(vertices.data(), stride, 3);
+    const RVector<3> offset = { 10.0f, 20.0f, 30.0f };
+    for (auto position: positions) {
+        position += offset;
+    }
+
+    ASSERT_EQ(positions.GetSize(), 3u);
+    for (size_t i = 0; i < 3; ++i) {
+        ASSERT_EQ(vertices[i * stride], static_cast<float>(i) + 10.0f);
+        ASSERT_EQ(vertices[i * stride + 2], 31.0f);
+        // the normal is left alone
+        ASSERT_EQ(vertices[i * stride + 3], 1.0f);
+        ASSERT_EQ(positions[i][1], 21.0f);
+    }
+
+    const MapArray<const RVector<3>> normals(vertices.data() + 3, stride, 3);
+    RVector<3> sum;
+    for (const auto normal: normals) {
+        sum += normal;
+    }
+    ASSERT_EQ(sum[0], 3.0f);
+}
@@ -0,0 +1,136 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "linalg/cvector.h"
+#include "linalg/packed.h"
+
+using namespace QS::LinAlg;
+
+static_assert(Half(1.0f).GetBits() == 0x3c00);
+static_assert(Half(-2.0f).GetBits() == 0xc000);
+static_assert(static_cast<float>(Half::FromBits(0x3555)) == 0.333251953125f);
+static_assert(UNorm8(1.0f).GetBits() == 255);
+static_assert(static_cast<float>(UNorm16::FromBits(65535)) == 1.0f);
+
+namespace {
+    /// floats that exercise every branch of the conversions
+    std::vector<float> Samples() {
+        std::vector<float> out = { 0.0f, -0.0f, 1.0f, -1.0f, 0.5f, 65504.0f, 65519.0f, 65520.0f, 1e9f,
+                                   std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+                                   0x1p-24f, 0x1p-25f, 0x1.8p-25f, 0x1p-14f, 0x1.ffcp-15f, 1e-30f,
+                                   1.0f + 0x1p-11f, 1.0f + 0x3p-11f, 2.0f, 1.5f / 255.0f, 127.5f / 255.0f };
+        for (int i = -300; i < 300; ++i) {
+            out.push_back(static_cast<float>(i) * 0.37f);
+            out.push_back(static_cast<float>(i) / 299.0f);
+        }
+        return out;
+    }
+}
+
+TEST(Packed, HalfRounding)
+{
+    ASSERT_EQ(Half(65504.0f).GetBits(), 0x7bff);
+    ASSERT_EQ(Half(65520.0f).GetBits(), 0x7c00);
+    ASSERT_EQ(Half(0x1p-24f).GetBits(), 0x0001);
+    ASSERT_EQ(Half(0x1p-25f).GetBits(), 0x0000);
+    ASSERT_EQ(Half(0x1.8p-25f).GetBits(), 0x0001);
+    // ties round to the even mantissa
+    ASSERT_EQ(Half(1.0f + 0x1p-11f).GetBits(), 0x3c00);
+    ASSERT_EQ(Half(1.0f + 0x3p-11f).GetBits(), 0x3c02);
+    ASSERT_TRUE(std::isnan(static_cast<float>(Half(std::numeric_limits<float>::quiet_NaN()))));
+}
+
+TEST(Packed, HalfRoundTripsEveryValue)
+{
+    for (uint32_t bits = 0; bits <= 0xffff; ++bits) {
+        const Half half = Half::FromBits(static_cast<uint16_t>(bits));
+        const float value = half;
+        if (std::isnan(value)) {
+            ASSERT_EQ(bits & 0x7c00, 0x7c00u);
+            continue;
+        }
+        ASSERT_EQ(Half(value).GetBits(), bits);
+    }
+}
+
+TEST(Packed, UNormRounding)
+{
+    ASSERT_EQ(UNorm8(0.5f).GetBits(), 128);
+    ASSERT_EQ(UNorm8(-1.0f).GetBits(), 0);
+    ASSERT_EQ(UNorm8(2.0f).GetBits(), 255);
+    ASSERT_EQ(UNorm8(std::numeric_limits<float>::quiet_NaN()).GetBits(), 0);
+    ASSERT_EQ(UNorm16(0.25f).GetBits(), 16384);
+    ASSERT_FLOAT_EQ(UNorm8::FromBits(51), 0.2f);
+}
+
+TEST(Packed, SpansMatchScalar)
+{
+    const std::vector<float> in = Samples();
+    std::vector<Half> halves(in.size());
+    std::vector<UNorm8> bytes(in.size());
+    std::vector<UNorm16> shorts(in.size());
+
+    Pack(in.data(), halves.data(), in.size());
+    Pack(in.data(), bytes.data(), in.size());
+    Pack(in.data(), shorts.data(), in.size());
+
+    for (size_t i = 0; i < in.size(); ++i) {
+        const Half half = in[i];
+        ASSERT_EQ(halves[i].GetBits(), half.GetBits()) << in[i];
+        ASSERT_EQ(bytes[i].GetBits(), UNorm8(in[i]).GetBits()) << in[i];
+        ASSERT_EQ(shorts[i].GetBits(), UNorm16(in[i]).GetBits()) << in[i];
+    }
+
+    std::vector<float> out(in.size());
+    Unpack(halves.data(), out.data(), in.size());
+    for (size_t i = 0; i < in.size(); ++i) {
+        ASSERT_EQ(std::bit_cast<uint32_t>(out[i]), std::bit_cast<uint32_t>(static_cast<float>(halves[i])));
+    }
+    Unpack(bytes.data(), out.data(), in.size());
+    for (size_t i = 0; i < in.size(); ++i) {
+        ASSERT_EQ(out[i], static_cast<float>(bytes[i]));
+    }
+    Unpack(shorts.data(), out.data(), in.size());
+    for (size_t i = 0; i < in.size(); ++i) {
+        ASSERT_EQ(out[i], static_cast<float>(shorts[i]));
+    }
+}
+
+TEST(Packed, HalfSpanOfEveryValue)
+{
+    std::vector<Half> in(1 << 16);
+    for (size_t i = 0; i < in.size(); ++i) {
+        in[i] = Half::FromBits(static_cast<uint16_t>(i));
+    }
+    std::vector<float> out(in.size());
+
+    Unpack(in.data(), out.data(), in.size());
+
+    for (size_t i = 0; i < in.size(); ++i) {
+        const float expected = in[i];
+        if (std::isnan(expected)) {
+            ASSERT_TRUE(std::isnan(out[i]));
+        } else {
+            ASSERT_EQ(std::bit_cast<uint32_t>(out[i]), std::bit_cast<uint32_t>(expected)) << i;
+        }
+    }
+}
+
+TEST(Packed, VectorElements)
+{
+    const CVector<4, Half> a = { 1.0f, 2.0f, 0.5f, -4.0f };
+    const CVector<4, Half> b = { 0.25f, 0.25f, 0.25f, 0.25f };
+
+    const CVector<4, Half> sum = a + b * Half(2.0f);
+
+    ASSERT_FLOAT_EQ(sum[0], 1.5f);
+    ASSERT_FLOAT_EQ(sum[3], -3.5f);
+    ASSERT_FLOAT_EQ(a * b, -0.125f);
+}
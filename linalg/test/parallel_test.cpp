@@ -0,0 +1,168 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "linalg/dmatrix.h"
+#include "linalg/parallel.h"
+
+using namespace QS::LinAlg;
+using namespace QS::LinAlg::Parallel;
+
+namespace {
+    /**
+     * Forces the parallel paths for the duration of a test
+     */
+    class ParallelTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            mMultiplyCutoff = GetMultiplyCutoff();
+            mElementCutoff = GetElementCutoff();
+            SetThreadCount(4);
+            SetMultiplyCutoff(0);
+            SetElementCutoff(0);
+        }
+
+        void TearDown() override {
+            SetMultiplyCutoff(mMultiplyCutoff);
+            SetElementCutoff(mElementCutoff);
+            SetThreadCount(0);
+        }
+
+        size_t mMultiplyCutoff = 0;
+
+        size_t mElementCutoff = 0;
+    };
+}
+
+TEST_F(ParallelTest, ApplyCoversRange)
+{
+    const size_t n = 3 * kGrainSize + 7;
+    std::vector<int> hits(n, 0);
+    Apply(n, [&hits](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            ++hits[i];
+        }
+    });
+    for (const int h: hits) {
+        ASSERT_EQ(h, 1);
+    }
+}
+
+TEST_F(ParallelTest, MultiplyMatchesSerial)
+{
+    const size_t m = 150, n = 290, k = 70;
+    std::vector<float> a(m * k), b(k * n), serial(m * n), parallel(m * n);
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = static_cast<float>(i % 13) - 6.0f;
+    }
+    for (size_t i = 0; i < b.size(); ++i) {
+        b[i] = static_cast<float>(i % 7) * 0.5f;
+    }
+    auto A = [&a, k](size_t i, size_t p) { return a[i * k + p]; };
+    auto B = [&b, n](size_t p, size_t j) { return b[p * n + j]; };
+
+    Gemm::Multiply<float>(m, n, k, A, B, [&serial, n](size_t i, size_t j) -> float & { return serial[i * n + j]; });
+    Multiply<float>(m, n, k, A, B, [&parallel, n](size_t i, size_t j) -> float & { return parallel[i * n + j]; });
+
+    for (size_t i = 0; i < serial.size(); ++i) {
+        ASSERT_FLOAT_EQ(parallel[i], serial[i]);
+    }
+}
+
+TEST_F(ParallelTest, MultiplyAddLower)
+{
+    // four tile rows, the last one partial
+    const size_t n = 3 * kTileRows + 11, k = 40;
+    std::vector<float> a(n * k), full(n * n), lower(n * n, -1.0f);
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = static_cast<float>(i % 13) - 6.0f;
+    }
+    auto A = [&a, k](size_t i, size_t p) { return a[i * k + p]; };
+    auto At = [&a, k](size_t p, size_t j) { return a[j * k + p]; };
+
+    Gemm::Multiply<float>(n, n, k, A, At, [&full, n](size_t i, size_t j) -> float & { return full[i * n + j]; });
+    MultiplyAddLower<float>(n, k, 2.0f, A, At, 1.0f,
+                            [&lower, n](size_t i, size_t j) -> float & { return lower[i * n + j]; });
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j <= i; ++j) {
+            ASSERT_FLOAT_EQ(lower[i * n + j], 2.0f * full[i * n + j] - 1.0f);
+        }
+        // tiles wholly above the diagonal are not touched
+        for (size_t j = (i / kTileRows + 1) * kTileRows; j < n; ++j) {
+            ASSERT_EQ(lower[i * n + j], -1.0f);
+        }
+    }
+}
+
+TEST_F(ParallelTest, DMatrixProduct)
+{
+    const size_t size = 130;
+    DMatrix<double> a(size, size);
+    DMatrix<double, Layout::ColumnMajor> b(size, size);
+    for (size_t i = 0; i < size; ++i) {
+        for (size_t j = 0; j < size; ++j) {
+            a(i, j) = static_cast<double>((i + 2 * j) % 5);
+            b(i, j) = i == j ? 2.0 : 0.0;
+        }
+    }
+    DMatrix<double> c = a * b;
+    for (size_t i = 0; i < size; ++i) {
+        for (size_t j = 0; j < size; ++j) {
+            ASSERT_DOUBLE_EQ(c(i, j), 2.0 * a(i, j));
+        }
+    }
+}
+
+TEST_F(ParallelTest, DMatrixElementWise)
+{
+    DMatrix<float> a(300, 300), b(300, 300);
+    for (size_t i = 0; i < a.GetSize(); ++i) {
+        a.GetData()[i] = static_cast<float>(i % 11);
+        b.GetData()[i] = 1.0f;
+    }
+    DMatrix<float> c = (a + b) * 2.0f;
+    for (size_t i = 0; i < c.GetSize(); ++i) {
+        ASSERT_FLOAT_EQ(c.GetData()[i], 2.0f * (static_cast<float>(i % 11) + 1.0f));
+    }
+}
+
+TEST_F(ParallelTest, DotAndAxpy)
+{
+    const size_t n = 3 * kGrainSize + 7;
+    std::vector<float> x(n), y(n, 1.0f);
+    for (size_t i = 0; i < n; ++i) {
+        x[i] = static_cast<float>(i % 5);
+    }
+    Axpy(2.0f, x.data(), y.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+        ASSERT_FLOAT_EQ(y[i], 2.0f * static_cast<float>(i % 5) + 1.0f);
+    }
+
+    // small integers sum exactly, so the chunked order does not matter
+    double expected = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        expected += static_cast<double>(x[i]) * y[i];
+    }
+    ASSERT_EQ(Dot(x.data(), y.data(), n), static_cast<float>(expected));
+}
+
+TEST_F(ParallelTest, DotIndependentOfThreads)
+{
+    const size_t n = 5 * kGrainSize + 3;
+    std::vector<float> x(n), y(n);
+    for (size_t i = 0; i < n; ++i) {
+        x[i] = 1.0f / static_cast<float>(i + 1);
+        y[i] = static_cast<float>(i % 7) * 0.1f + 0.3f;
+    }
+    // the partial sums round, so only the same chunking gives the same bits
+    const float parallel = Dot(x.data(), y.data(), n);
+    SetThreadCount(1);
+    ASSERT_EQ(Dot(x.data(), y.data(), n), parallel);
+    SetThreadCount(4);
+    SetElementCutoff(n + 1);
+    ASSERT_EQ(Dot(x.data(), y.data(), n), parallel);
+}
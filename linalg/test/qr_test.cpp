@@ -0,0 +1,155 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <cmath>
+#include <random>
+
+#include "gtest/gtest.h"
+#include "linalg/qr.h"
+
+using namespace QS::LinAlg;
+
+namespace {
+    template<Layout layout = Layout::RowMajor>
+    DMatrix<double, layout> RandomMatrix(const size_t rows, const size_t cols, const unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> value(-1.0, 1.0);
+        DMatrix<double, layout> out(rows, cols);
+        for (size_t i = 0; i < out.GetSize(); ++i) {
+            out.GetData()[i] = value(rng);
+        }
+        return out;
+    }
+
+    /**
+     * A^T (A x - b), which vanishes at the least squares solution
+     */
+    template<Layout layout>
+    DVector<double> NormalResidual(const DMatrix<double, layout> &a, const DVector<double> &x, const DVector<double> &b) {
+        const DVector<double> ax = a * x;
+        DVector<double> out(a.GetCols());
+        for (size_t j = 0; j < a.GetCols(); ++j) {
+            for (size_t i = 0; i < a.GetRows(); ++i) {
+                out[j] += a(i, j) * (ax[i] - b[i]);
+            }
+        }
+        return out;
+    }
+}
+
+TEST(QR, FitsLine)
+{
+    // y = 2 x + 1 sampled without noise
+    const RMatrix<5, 2> a = { { 0.0f, 1.0f },
+                              { 1.0f, 1.0f },
+                              { 2.0f, 1.0f },
+                              { 3.0f, 1.0f },
+                              { 4.0f, 1.0f } };
+    const CVector<5> y = { 1.0f, 3.0f, 5.0f, 7.0f, 9.0f };
+
+    const CVector<2> fit = LeastSquares(a, y);
+
+    ASSERT_NEAR(fit[0], 2.0f, 1e-5f);
+    ASSERT_NEAR(fit[1], 1.0f, 1e-5f);
+}
+
+TEST(QR, FixedMatchesNormalEquations)
+{
+    // the least squares line through points that do not lie on one: slope 0.66, intercept 1.06
+    const CMatrix<2, 4, double> a = { { 0.0, 1.0, 2.0, 3.0 },
+                                      { 1.0, 1.0, 1.0, 1.0 } };
+    const RVector<4, double> b = { 1.0, 2.0, 2.0, 3.2 };
+
+    const QR<CMatrix<2, 4, double>> qr(a);
+    const RVector<2, double> x = qr.Solve(b);
+
+    ASSERT_FALSE(qr.IsRankDeficient());
+    ASSERT_NEAR(x[0], 0.66, 1e-12);
+    ASSERT_NEAR(x[1], 1.06, 1e-12);
+    // |R(0, 0)| is the norm of the first column
+    ASSERT_NEAR(std::abs(qr.GetFactors()[0][0]), std::sqrt(14.0), 1e-12);
+}
+
+TEST(QR, SquareSystem)
+{
+    const RMatrix<3, 3, double> a = { { 2.0, -1.0, 0.0 },
+                                      { -1.0, 2.0, -1.0 },
+                                      { 0.0, -1.0, 2.0 } };
+    const CVector<3, double> b = { 1.0, 0.0, 1.0 };
+
+    const CVector<3, double> x = LeastSquares(a, b);
+
+    ASSERT_NEAR(x[0], 1.0, 1e-12);
+    ASSERT_NEAR(x[1], 1.0, 1e-12);
+    ASSERT_NEAR(x[2], 1.0, 1e-12);
+}
+
+TEST(QR, RankDeficient)
+{
+    const RMatrix<3, 2> a = { { 1.0f, 2.0f },
+                              { 2.0f, 4.0f },
+                              { 3.0f, 6.0f } };
+    const QR<RMatrix<3, 2>> qr(a);
+
+    ASSERT_THROW((void)qr.Solve(CVector<3>{ 1.0f, 2.0f, 3.0f }), std::invalid_argument);
+    ASSERT_THROW((void)QR<DMatrix<>>(DMatrix<>(2, 3)), std::invalid_argument);
+}
+
+TEST(QR, BlockedMatchesNormalEquations)
+{
+    // wide enough for several panels and a partial last one
+    const DMatrix<double> a = RandomMatrix(230, 100, 5);
+    const DMatrix<double> rhs = RandomMatrix(230, 1, 6);
+    DVector<double> b(230);
+    for (size_t i = 0; i < 230; ++i) {
+        b[i] = rhs(i, 0);
+    }
+
+    const DVector<double> x = LeastSquares(a, b);
+
+    const DVector<double> residual = NormalResidual(a, x, b);
+    for (size_t j = 0; j < residual.GetSize(); ++j) {
+        ASSERT_NEAR(residual[j], 0.0, 1e-10) << "column " << j;
+    }
+}
+
+TEST(QR, BlockedRecoversConsistentSolution)
+{
+    const DMatrix<double, Layout::ColumnMajor> a = RandomMatrix<Layout::ColumnMajor>(150, 70, 9);
+    DVector<double> expected(70);
+    for (size_t j = 0; j < 70; ++j) {
+        expected[j] = static_cast<double>(j) * 0.25 - 4.0;
+    }
+    const DVector<double> b = a * expected;
+
+    const QR<DMatrix<double, Layout::ColumnMajor>> qr(a);
+    const DVector<double> x = qr.Solve(b);
+
+    ASSERT_FALSE(qr.IsRankDeficient());
+    for (size_t j = 0; j < 70; ++j) {
+        ASSERT_NEAR(x[j], expected[j], 1e-10);
+    }
+}
+
+TEST(QR, BlockedFloatRecoversConsistentSolution)
+{
+    // float trailing updates run on the dispatched Simd::Gemm
+    const size_t rows = 160, cols = 90;
+    DMatrix<float> a(rows, cols);
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < cols; ++j) {
+            a(i, j) = static_cast<float>(std::sin(static_cast<double>(i * cols + j))) + (i == j ? 4.0f : 0.0f);
+        }
+    }
+    DVector<float> expected(cols);
+    for (size_t j = 0; j < cols; ++j) {
+        expected[j] = static_cast<float>(j % 7) - 3.0f;
+    }
+    const DVector<float> b = a * expected;
+
+    const DVector<float> x = QR<DMatrix<float>>(a).Solve(b);
+    for (size_t j = 0; j < cols; ++j) {
+        ASSERT_NEAR(x[j], expected[j], 1e-3f);
+    }
+}
@@ -0,0 +1,131 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "linalg/quaternion.h"
+
+using namespace QS::LinAlg;
+
+namespace {
+    constexpr float kHalfPi = std::numbers::pi_v<float> / 2;
+
+    void ExpectSameRotation(const Quaternion<> &a, const Quaternion<> &b, const float tolerance) {
+        // q and -q are the same rotation
+        const float sign = a.Dot(b) < 0.0f ? -1.0f : 1.0f;
+        for (size_t k = 0; k < 4; ++k) {
+            ASSERT_NEAR(a[k], sign * b[k], tolerance) << "component " << k;
+        }
+    }
+}
+
+static_assert(Quaternion<>().GetW() == 1.0f);
+static_assert((Quaternion<>(0, 0, 1, 0) * Quaternion<>(0, 0, 1, 0)).GetW() == -1.0f);
+
+TEST(Quaternion, RotateVector)
+{
+    const Quaternion<> q = Quaternion<>::FromAxisAngle(RVector<3>{ 0, 0, 1 }, kHalfPi);
+    const RVector<3> r = q.Rotate(RVector<3>{ 1, 0, 0 });
+    ASSERT_NEAR(r[0], 0.0f, 1e-6f);
+    ASSERT_NEAR(r[1], 1.0f, 1e-6f);
+    ASSERT_NEAR(r[2], 0.0f, 1e-6f);
+
+    const CVector<3> c = q.Conjugate().Rotate(CVector<3>{ 0, 1, 0 });
+    ASSERT_NEAR(c[0], 1.0f, 1e-6f);
+    ASSERT_NEAR(c[1], 0.0f, 1e-6f);
+}
+
+TEST(Quaternion, Multiply)
+{
+    const Quaternion<> x = Quaternion<>::FromAxisAngle(RVector<3>{ 1, 0, 0 }, 0.3f);
+    const Quaternion<> y = Quaternion<>::FromAxisAngle(RVector<3>{ 0, 1, 0 }, -1.1f);
+    const RVector<3> v = { 0.5f, -2.0f, 3.0f };
+
+    const RVector<3> composed = (x * y).Rotate(v);
+    const RVector<3> sequential = x.Rotate(y.Rotate(v));
+    for (size_t k = 0; k < 3; ++k) {
+        ASSERT_NEAR(composed[k], sequential[k], 1e-5f);
+    }
+
+    const Quaternion<> identity = x * x.Inverse();
+    ExpectSameRotation(identity, Quaternion<>(), 1e-6f);
+}
+
+TEST(Quaternion, Normalize)
+{
+    Quaternion<> q(1, 2, 3, 4);
+    q.Normalize();
+    ASSERT_NEAR(q.Norm(), 1.0f, 1e-6f);
+    ASSERT_NEAR(q.GetW(), 4.0f / std::sqrt(30.0f), 1e-6f);
+}
+
+TEST(Quaternion, MatrixRoundTrip)
+{
+    const RVector<3> axis = { 2.0f / 7, -3.0f / 7, 6.0f / 7 };
+    for (const float angle: { 0.1f, 1.0f, 2.5f, 3.1f }) {
+        const Quaternion<> q = Quaternion<>::FromAxisAngle(axis, angle);
+        const CMatrix<3, 3> m3 = q.ToMatrix<3>();
+        const CMatrix<4, 4> m4 = q.ToMatrix<4>();
+        ExpectSameRotation(Quaternion<>::FromMatrix(m3), q, 1e-5f);
+        ExpectSameRotation(Quaternion<>::FromMatrix(m4), q, 1e-5f);
+        ASSERT_FLOAT_EQ(m4[3][3], 1.0f);
+
+        // the matrix rotates like the quaternion
+        const CVector<3> v = { 1, 2, 3 };
+        const CVector<3> byMatrix = m3 * v;
+        const CVector<3> byQuaternion = q.Rotate(v);
+        for (size_t k = 0; k < 3; ++k) {
+            ASSERT_NEAR(byMatrix[k], byQuaternion[k], 1e-5f);
+        }
+    }
+}
+
+TEST(Quaternion, Slerp)
+{
+    const Quaternion<> a;
+    const Quaternion<> b = Quaternion<>::FromAxisAngle(RVector<3>{ 0, 1, 0 }, kHalfPi);
+    ExpectSameRotation(Slerp(a, b, 0.5f), Quaternion<>::FromAxisAngle(RVector<3>{ 0, 1, 0 }, kHalfPi / 2), 1e-6f);
+    ExpectSameRotation(Slerp(a, -b, 0.5f), Slerp(a, b, 0.5f), 1e-6f);
+    ExpectSameRotation(Nlerp(a, b, 1.0f), b, 1e-6f);
+}
+
+TEST(Quaternion, BatchedInterpolation)
+{
+    // 4 wide blocks plus a scalar tail
+    const size_t n = 23;
+    std::vector<Quaternion<>> from(n), to(n), slerp(n), nlerp(n);
+    std::vector<float> t(n);
+    for (size_t i = 0; i < n; ++i) {
+        const auto f = static_cast<float>(i);
+        const float length = std::sqrt(1 + f * f + 4);
+        from[i] = Quaternion<>::FromAxisAngle(RVector<3>{ 1 / length, f / length, 2 / length }, 0.2f * f);
+        to[i] = Quaternion<>::FromAxisAngle(RVector<3>{ 0, 1, 0 }, 3.0f - 0.25f * f);
+        t[i] = f / (n - 1);
+    }
+
+    Slerp(from.data(), to.data(), t.data(), slerp.data(), n);
+    Nlerp(from.data(), to.data(), t.data(), nlerp.data(), n);
+
+    for (size_t i = 0; i < n; ++i) {
+        ExpectSameRotation(slerp[i], Slerp(from[i], to[i], t[i]), 1e-5f);
+        ExpectSameRotation(nlerp[i], Nlerp(from[i], to[i], t[i]), 1e-6f);
+    }
+
+    // in place
+    Slerp(from.data(), to.data(), t.data(), from.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+        ExpectSameRotation(from[i], slerp[i], 0.0f);
+    }
+}
+
+TEST(Quaternion, Double)
+{
+    const Quaternion<double> q = Quaternion<double>::FromAxisAngle(RVector<3, double>{ 0, 0, 1 }, std::numbers::pi / 3);
+    const RVector<3, double> r = q.Rotate(RVector<3, double>{ 1, 0, 0 });
+    ASSERT_NEAR(r[0], 0.5, 1e-12);
+    ASSERT_NEAR(r[1], std::sqrt(3.0) / 2, 1e-12);
+}
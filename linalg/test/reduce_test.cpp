@@ -0,0 +1,96 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "linalg/cvector.h"
+#include "linalg/reduce.h"
+#include "linalg/rvector.h"
+
+using namespace QS::LinAlg;
+
+namespace {
+    constexpr Summation kModes[] = { Summation::Fast, Summation::Pairwise, Summation::Kahan };
+
+    constexpr RVector<5> kRamp = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+}
+
+static_assert(Sum(kRamp) == 15.0f);
+static_assert(Sum(kRamp, Summation::Kahan) == 15.0f);
+static_assert(Dot(kRamp, kRamp, Summation::Pairwise) == 55.0f);
+static_assert(Dot(kRamp, kRamp, Summation::Kahan) == kRamp * kRamp);
+
+TEST(Reduce, LongSums)
+{
+    // a million terms of 0.1 lose several digits when added one after the other in float
+    constexpr size_t n = 1 << 20;
+    DVector<float> a(n), b(n);
+    double sum = 0.0, dot = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        a[i] = 0.1f + static_cast<float>(i % 3) * 0.01f;
+        b[i] = 1.0f + static_cast<float>(i % 5) * 0.1f;
+        sum += a[i];
+        dot += static_cast<double>(a[i]) * b[i];
+    }
+
+    const auto error = [](const float actual, const double expected) {
+        return std::abs(actual - expected) / expected;
+    };
+    ASSERT_LT(error(Sum(a, Summation::Kahan), sum), 1e-7);
+    ASSERT_LT(error(Dot(a, b, Summation::Kahan), dot), 1e-6);
+    ASSERT_LT(error(Sum(a, Summation::Pairwise), sum), 1e-6);
+    ASSERT_LT(error(Dot(a, b, Summation::Pairwise), dot), 1e-6);
+    ASSERT_LE(error(Sum(a, Summation::Kahan), sum), error(Sum(a), sum));
+    ASSERT_NEAR(Norm(a, Summation::Kahan), std::sqrt(Dot(a, a, Summation::Kahan)), 0.0f);
+
+    // the other element types take the generic kernels
+    std::vector<double> wide(n, 0.1);
+    ASSERT_NEAR(Reduce::Sum(wide.data(), n, Summation::Kahan), 0.1 * n, 1e-9);
+    ASSERT_NEAR(Reduce::Sum(wide.data(), n, Summation::Pairwise), 0.1 * n, 1e-9);
+}
+
+TEST(Reduce, ModesAgree)
+{
+    // lengths around the block size and the register widths of every tier
+    for (const size_t n: { 0, 1, 5, 31, 127, 128, 129, 1000 }) {
+        std::vector<float> a(n), b(n);
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = static_cast<float>(i % 9) - 4.0f;
+            b[i] = static_cast<float>(i % 4) * 0.5f;
+        }
+        const float dot = Simd::Dot<float>(a.data(), b.data(), n);
+        const float sum = Simd::Sum<float>(a.data(), n);
+        for (const Summation mode: kModes) {
+            // integer valued terms add up exactly whatever the order
+            ASSERT_EQ(Reduce::Dot(a.data(), b.data(), n, mode), dot) << n;
+            ASSERT_EQ(Reduce::Sum(a.data(), n, mode), sum) << n;
+        }
+    }
+}
+
+TEST(Reduce, FixedVectors)
+{
+    CVector<40> a;
+    for (size_t i = 0; i < 40; ++i) {
+        a[i] = static_cast<float>(i);
+    }
+    for (const Summation mode: kModes) {
+        ASSERT_EQ(Sum(a, mode), 780.0f);
+        ASSERT_EQ(Dot(a, a, mode), 20540.0f);
+        // an unevaluated expression goes through the generic kernel
+        ASSERT_EQ(Sum(a * 2.0f, mode), 1560.0f);
+    }
+    ASSERT_FLOAT_EQ(Norm(RVector<2>{ 3.0f, 4.0f }, Summation::Kahan), 5.0f);
+
+    // the compensation recovers what a plain float sum drops
+    const RVector<4> cancel = { 1e8f, 1.0f, -1e8f, 1.0f };
+    ASSERT_EQ(Sum(cancel, Summation::Kahan), 2.0f);
+
+    DVector<float> shorter(3), longer(4);
+    ASSERT_THROW((void)Dot(shorter, longer, Summation::Kahan), std::invalid_argument);
+}
@@ -28,3 +28,55 @@ TEST(RMatrix, OperatorOverloadAdditionAssigment)
 
 
 
+TEST(RMatrix, OverloadMultiplication)
+{
+    const RMatrix<2,3> a = { { 1.0f, 2.0f, 3.0f },
+                             { 4.0f, 5.0f, 6.0f } };
+    const RMatrix<3,2> b = { { 7.0f, 8.0f },
+                             { 9.0f, 10.0f },
+                             { 11.0f, 12.0f } };
+
+    const RMatrix<2,2> res = a * b;
+
+    ASSERT_FLOAT_EQ(res[0][0], 58.0f);
+    ASSERT_FLOAT_EQ(res[0][1], 64.0f);
+    ASSERT_FLOAT_EQ(res[1][0], 139.0f);
+    ASSERT_FLOAT_EQ(res[1][1], 154.0f);
+}
+
+TEST(RMatrix, OverloadMultiplication4x4)
+{
+    RMatrix<4,4> a;
+    RMatrix<4,4> b;
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            a[i][j] = static_cast<float>(i * 4 + j);
+            b[i][j] = static_cast<float>(j - i) * 0.5f;
+        }
+    }
+
+    const RMatrix<4,4> res = a * b;
+
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            float expected = 0.0f;
+            for (int k = 0; k < 4; ++k) {
+                expected += a[i][k] * b[k][j];
+            }
+            ASSERT_FLOAT_EQ(res[i][j], expected);
+        }
+    }
+}
+
+TEST(RMatrix, DoubleElements)
+{
+    const RMatrix<2,2,double> a = { { 1.0, 2.0 },
+                                    { 3.0, 4.0 } };
+
+    const RMatrix<2,2,double> res = a * a - a;
+
+    ASSERT_DOUBLE_EQ(res[0][0], 6.0);
+    ASSERT_DOUBLE_EQ(res[0][1], 8.0);
+    ASSERT_DOUBLE_EQ(res[1][0], 12.0);
+    ASSERT_DOUBLE_EQ(res[1][1], 18.0);
+}
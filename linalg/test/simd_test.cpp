@@ -0,0 +1,182 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "linalg/cvector.h"
+#include "linalg/rvector.h"
+
+using namespace QS::LinAlg;
+
+template<int length>
+static std::array<float, length> MakeValues(float seed)
+{
+    std::array<float, length> out{};
+    for (int i = 0; i < length; ++i) {
+        out[i] = seed * static_cast<float>(i + 1) - 1.0f / static_cast<float>(i + 3);
+    }
+    return out;
+}
+
+template<int length>
+static void ExpectBitEqual(const std::array<float, length> &a, const std::array<float, length> &b)
+{
+    for (int i = 0; i < length; ++i) {
+        ASSERT_EQ(std::bit_cast<std::uint32_t>(a[i]), std::bit_cast<std::uint32_t>(b[i])) << "index " << i;
+    }
+}
+
+template<int length>
+static void CheckKernelMatchesScalar()
+{
+    const auto lhs = MakeValues<length>(0.37f);
+    const auto rhs = MakeValues<length>(-1.91f);
+
+    std::array<float, length> simd{};
+    std::array<float, length> scalar{};
+
+    Simd::Add<length>(lhs.data(), rhs.data(), simd.data());
+    Simd::Scalar::Add<length>(lhs.data(), rhs.data(), scalar.data());
+    ExpectBitEqual<length>(simd, scalar);
+
+    Simd::Sub<length>(lhs.data(), rhs.data(), simd.data());
+    Simd::Scalar::Sub<length>(lhs.data(), rhs.data(), scalar.data());
+    ExpectBitEqual<length>(simd, scalar);
+
+    Simd::Scale<length>(lhs.data(), 3.3f, simd.data());
+    Simd::Scalar::Scale<length>(lhs.data(), 3.3f, scalar.data());
+    ExpectBitEqual<length>(simd, scalar);
+
+    // summation order differs, so the dot product is only equal to within rounding
+    ASSERT_NEAR(Simd::Dot<length>(lhs.data(), rhs.data()), Simd::Scalar::Dot<length>(lhs.data(), rhs.data()), 1e-4f);
+}
+
+TEST(Simd, KernelMatchesScalar)
+{
+    CheckKernelMatchesScalar<2>();
+    CheckKernelMatchesScalar<3>();
+    CheckKernelMatchesScalar<4>();
+    CheckKernelMatchesScalar<8>();
+    CheckKernelMatchesScalar<16>();
+}
+
+TEST(Simd, FallbackLengths)
+{
+    CheckKernelMatchesScalar<5>();
+    CheckKernelMatchesScalar<9>();
+}
+
+TEST(Simd, KernelDoesNotWritePastLength)
+{
+    std::array<float, 4> out = { 0.0f, 0.0f, 0.0f, 42.0f };
+    const std::array<float, 3> lhs = { 1.0f, 2.0f, 3.0f };
+    const std::array<float, 3> rhs = { 4.0f, 5.0f, 6.0f };
+
+    Simd::Add<3>(lhs.data(), rhs.data(), out.data());
+
+    ASSERT_FLOAT_EQ(out[0], 5.0f);
+    ASSERT_FLOAT_EQ(out[1], 7.0f);
+    ASSERT_FLOAT_EQ(out[2], 9.0f);
+    ASSERT_FLOAT_EQ(out[3], 42.0f);
+}
+
+TEST(Simd, ConstantEvaluation)
+{
+    constexpr RVector<4> a = { 1.0f, 2.0f, 3.0f, 4.0f };
+    constexpr RVector<4> b = { 4.0f, 3.0f, 2.0f, 1.0f };
+    static_assert((a + b)[0] == 5.0f);
+    static_assert(a * b == 20.0f);
+
+    ASSERT_FLOAT_EQ(a * b, 20.0f);
+}
+
+TEST(Simd, RVectorOperators)
+{
+    const RVector<4> a = { 1.0f, 2.0f, 3.0f, 4.0f };
+    const RVector<4> b = { 0.5f, -1.0f, 2.0f, 0.0f };
+
+    const RVector<4> sum = a + b;
+    const RVector<4> diff = a - b;
+    const RVector<4> scaled = a * 2.0f;
+
+    ASSERT_FLOAT_EQ(sum[1], 1.0f);
+    ASSERT_FLOAT_EQ(diff[2], 1.0f);
+    ASSERT_FLOAT_EQ(scaled[3], 8.0f);
+    ASSERT_FLOAT_EQ(a * b, 4.5f);
+}
+
+TEST(Simd, CVectorOperators)
+{
+    CVector<8> a = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    const CVector<8> b = { 1, 1, 1, 1, 1, 1, 1, 1 };
+
+    ASSERT_FLOAT_EQ(a * b, 36.0f);
+
+    a -= b;
+
+    ASSERT_FLOAT_EQ(a[0], 0.0f);
+    ASSERT_FLOAT_EQ(a[7], 7.0f);
+}
+
+TEST(Simd, SpanKernels)
+{
+    for (size_t n: { 0, 1, 7, 8, 33 }) {
+        std::vector<float> a(n);
+        std::vector<float> b(n);
+        std::vector<float> out(n);
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = static_cast<float>(i) * 0.5f;
+            b[i] = 3.0f - static_cast<float>(i);
+        }
+
+        Simd::Add(a.data(), b.data(), out.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(out[i], a[i] + b[i]);
+        }
+
+        Simd::Sub(a.data(), b.data(), out.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(out[i], a[i] - b[i]);
+        }
+
+        Simd::Scale(a.data(), 1.5f, out.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(out[i], a[i] * 1.5f);
+        }
+
+        Simd::Mul(a.data(), b.data(), out.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(out[i], a[i] * b[i]);
+        }
+
+        Simd::Div(a.data(), b.data(), out.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_FLOAT_EQ(out[i], a[i] / b[i]);
+        }
+
+        Simd::Sqrt(a.data(), out.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_FLOAT_EQ(out[i], std::sqrt(a[i]));
+        }
+
+        out = a;
+        Simd::MulAdd(a.data(), b.data(), out.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_FLOAT_EQ(out[i], a[i] + a[i] * b[i]);
+        }
+
+        std::vector<float> y = b;
+        Simd::Axpy(2.0f, a.data(), y.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(y[i], b[i] + 2.0f * a[i]);
+        }
+
+        ASSERT_NEAR(Simd::Dot(a.data(), b.data(), n), Simd::Dot<float>(a.data(), b.data(), n), 1e-3f);
+    }
+}
@@ -0,0 +1,191 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "linalg/cmatrix.h"
+#include "linalg/sparse.h"
+
+using namespace QS::LinAlg;
+
+namespace {
+    /**
+     * rows x cols matrix with about density * rows * cols nonzeros, as triplets with duplicates
+     */
+    std::vector<Triplet<>> RandomTriplets(const size_t rows, const size_t cols, const double density,
+                                          const unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<size_t> row(0, rows - 1);
+        std::uniform_int_distribution<size_t> col(0, cols - 1);
+        std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+        std::vector<Triplet<>> out(static_cast<size_t>(density * static_cast<double>(rows * cols)));
+        for (Triplet<> &t: out) {
+            t = { row(rng), col(rng), value(rng) };
+        }
+        return out;
+    }
+
+    DVector<> RandomVector(const size_t n, const unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+        DVector<> out(n);
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = value(rng);
+        }
+        return out;
+    }
+
+    /**
+     * Forces the parallel paths for the duration of a test
+     */
+    class SparseParallelTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            mElementCutoff = Parallel::GetElementCutoff();
+            SetThreadCount(4);
+            Parallel::SetElementCutoff(0);
+        }
+
+        void TearDown() override {
+            Parallel::SetElementCutoff(mElementCutoff);
+            SetThreadCount(0);
+        }
+
+        size_t mElementCutoff = 0;
+    };
+
+    template<Layout layout>
+    void ExpectProductsMatchDense(const size_t rows, const size_t cols) {
+        const std::vector<Triplet<>> triplets = RandomTriplets(rows, cols, 0.05, 7);
+        const auto sparse = SparseMatrix<float, layout>::FromTriplets(rows, cols, triplets);
+        const DMatrix<> dense = sparse.template ToDense<Layout::RowMajor>();
+        const DVector<> x = RandomVector(cols, 11);
+        const DVector<> y = RandomVector(rows, 13);
+
+        const DVector<> ax = sparse * x;
+        const DVector<> expectedAx = dense * x;
+        for (size_t i = 0; i < rows; ++i) {
+            ASSERT_NEAR(ax[i], expectedAx[i], 1e-4f) << "row " << i;
+        }
+
+        const DVector<> aty = TransposeMultiply(sparse, y);
+        for (size_t j = 0; j < cols; ++j) {
+            float expected = 0.0f;
+            for (size_t i = 0; i < rows; ++i) {
+                expected += dense(i, j) * y[i];
+            }
+            ASSERT_NEAR(aty[j], expected, 1e-4f) << "col " << j;
+        }
+    }
+}
+
+TEST(Sparse, FromTripletsSumsDuplicates)
+{
+    const CsrMatrix<> m = CsrMatrix<>::FromTriplets(3, 4, { { 2, 1, 1.0f },
+                                                             { 0, 3, 2.0f },
+                                                             { 2, 1, 0.5f },
+                                                             { 0, 0, -1.0f } });
+
+    ASSERT_EQ(m.GetNonZeroCount(), 3u);
+    ASSERT_FLOAT_EQ(m(0, 0), -1.0f);
+    ASSERT_FLOAT_EQ(m(0, 3), 2.0f);
+    ASSERT_FLOAT_EQ(m(2, 1), 1.5f);
+    ASSERT_FLOAT_EQ(m(1, 1), 0.0f);
+    ASSERT_EQ(m.GetOffsets()[1], 2u);
+    ASSERT_EQ(m.GetIndices()[0], 0u);
+    ASSERT_EQ(m.GetIndices()[1], 3u);
+
+    ASSERT_THROW((void)CsrMatrix<>::FromTriplets(3, 4, { { 3, 0, 1.0f } }), std::invalid_argument);
+}
+
+TEST(Sparse, DenseRoundTrip)
+{
+    const CMatrix<3, 2> fixed = { { 1.0f, 0.0f },
+                                  { 0.0f, 0.0f },
+                                  { 4.0f, 5.0f } };
+    const CscMatrix<> csc(fixed);
+    const CsrMatrix<> csr(csc.ToDense());
+
+    ASSERT_EQ(csc.GetNonZeroCount(), 3u);
+    ASSERT_EQ(csr.GetNonZeroCount(), 3u);
+    const DMatrix<float, Layout::ColumnMajor> dense = csr.ToDense<Layout::ColumnMajor>();
+    for (size_t r = 0; r < 2; ++r) {
+        for (size_t c = 0; c < 3; ++c) {
+            ASSERT_FLOAT_EQ(dense(r, c), fixed[c][r]);
+            ASSERT_FLOAT_EQ(csr(r, c), fixed[c][r]);
+        }
+    }
+}
+
+TEST(Sparse, TransposeAndLayout)
+{
+    const CsrMatrix<> m = CsrMatrix<>::FromTriplets(50, 30, RandomTriplets(50, 30, 0.1, 3));
+    const CscMatrix<> transpose = m.Transpose();
+    const CscMatrix<> csc = m.ToLayout<Layout::ColumnMajor>();
+    const CsrMatrix<> back = csc.ToLayout<Layout::RowMajor>();
+
+    ASSERT_EQ(transpose.GetRows(), 30u);
+    ASSERT_EQ(transpose.GetCols(), 50u);
+    for (size_t r = 0; r < 50; ++r) {
+        for (size_t c = 0; c < 30; ++c) {
+            ASSERT_EQ(transpose(c, r), m(r, c));
+            ASSERT_EQ(csc(r, c), m(r, c));
+        }
+    }
+    for (size_t k = 0; k < m.GetNonZeroCount(); ++k) {
+        ASSERT_EQ(back.GetIndices()[k], m.GetIndices()[k]);
+        ASSERT_EQ(back.GetValues()[k], m.GetValues()[k]);
+    }
+
+    // an rvalue hands its arrays over
+    CsrMatrix<> moved = m.Clone();
+    const float *values = moved.GetValues();
+    const CscMatrix<> taken = std::move(moved).Transpose();
+    ASSERT_EQ(taken.GetValues(), values);
+    ASSERT_EQ(taken(3, 7), m(7, 3));
+}
+
+TEST(Sparse, InnerDimensionLimit)
+{
+    // only the offsets of the outer slices are allocated
+    ASSERT_NO_THROW(CsrMatrix<>(1, CsrMatrix<>::kMaxInner));
+    ASSERT_THROW(CsrMatrix<>(1, CsrMatrix<>::kMaxInner + 1), std::invalid_argument);
+    ASSERT_THROW(CscMatrix<>(CscMatrix<>::kMaxInner + 1, 1), std::invalid_argument);
+    ASSERT_THROW(CsrMatrix<>::FromTriplets(2, CsrMatrix<>::kMaxInner + 1, {}), std::invalid_argument);
+}
+
+TEST(Sparse, ProductsMatchDense)
+{
+    ExpectProductsMatchDense<Layout::RowMajor>(97, 61);
+    ExpectProductsMatchDense<Layout::ColumnMajor>(97, 61);
+}
+
+TEST(Sparse, ProductChecksDimensions)
+{
+    const CsrMatrix<> m(3, 4);
+    ASSERT_THROW((void)(m * DVector<>(3)), std::invalid_argument);
+    ASSERT_THROW((void)TransposeMultiply(m, DVector<>(4)), std::invalid_argument);
+}
+
+TEST_F(SparseParallelTest, ProductsMatchDense)
+{
+    ExpectProductsMatchDense<Layout::RowMajor>(700, 500);
+    ExpectProductsMatchDense<Layout::ColumnMajor>(700, 500);
+    // enough nonzeros for a task on every thread, scattering into scratch left over at other lengths
+    ExpectProductsMatchDense<Layout::ColumnMajor>(1500, 1200);
+    ExpectProductsMatchDense<Layout::RowMajor>(1500, 1200);
+}
+
+TEST(Sparse, DoubleElements)
+{
+    const CsrMatrix<double> m = CsrMatrix<double>::FromTriplets(2, 2, { { 0, 0, 2.0 }, { 1, 0, 1.0 }, { 1, 1, 3.0 } });
+    const DVector<double> y = m * DVector<double>{ 1.0, 2.0 };
+
+    ASSERT_DOUBLE_EQ(y[0], 2.0);
+    ASSERT_DOUBLE_EQ(y[1], 7.0);
+}
@@ -0,0 +1,55 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "linalg/thread_pool.h"
+
+using namespace QS::LinAlg;
+
+TEST(ThreadPool, ThreadCount)
+{
+    ThreadPool single(1);
+    ASSERT_EQ(single.GetThreadCount(), 1);
+
+    ThreadPool four(4);
+    ASSERT_EQ(four.GetThreadCount(), 4);
+}
+
+TEST(ThreadPool, ParallelForCoversEveryIndex)
+{
+    ThreadPool pool(4);
+    std::vector<std::atomic<int>> hits(1000);
+    pool.ParallelFor(hits.size(), [&hits](size_t i) { hits[i].fetch_add(1); });
+    for (const auto &h: hits) {
+        ASSERT_EQ(h.load(), 1);
+    }
+}
+
+TEST(ThreadPool, NestedParallelFor)
+{
+    ThreadPool pool(3);
+    std::atomic<int> total{0};
+    pool.ParallelFor(8, [&pool, &total](size_t) {
+        pool.ParallelFor(16, [&total](size_t) { total.fetch_add(1); });
+    });
+    ASSERT_EQ(total.load(), 8 * 16);
+}
+
+TEST(ThreadPool, RethrowsException)
+{
+    ThreadPool pool(4);
+    std::atomic<int> ran{0};
+    ASSERT_THROW(pool.ParallelFor(64, [&ran](size_t i) {
+        ran.fetch_add(1);
+        if (i == 13) {
+            throw std::runtime_error("task failed");
+        }
+    }), std::runtime_error);
+    // the remaining tasks still run to completion
+    ASSERT_EQ(ran.load(), 64);
+}
@@ -0,0 +1,110 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "linalg/cvector.h"
+#include "linalg/transform.h"
+
+using namespace QS::LinAlg;
+
+namespace {
+    /// scale by (2, 3, 4), rotate a quarter turn about z and translate by (5, 6, 7)
+    const CMatrix<4, 4> kTransform = { 0, 2, 0, 0,
+                                       -3, 0, 0, 0,
+                                       0, 0, 4, 0,
+                                       5, 6, 7, 1 };
+
+    std::vector<float> MakeStream(const size_t count, const size_t stride) {
+        std::vector<float> out(count * stride);
+        for (size_t i = 0; i < out.size(); ++i) {
+            out[i] = static_cast<float>(i % 17) * 0.25f - 2.0f;
+        }
+        return out;
+    }
+
+    void ExpectTransformed(const std::vector<float> &in, const size_t inStride, const std::vector<float> &out,
+                           const size_t outStride, const size_t count, const int components, const float w) {
+        for (size_t i = 0; i < count; ++i) {
+            const float *v = in.data() + i * inStride;
+            const CVector<4> expected = kTransform * CVector<4>{ v[0], v[1], v[2], components == 4 ? v[3] : w };
+            for (int r = 0; r < components; ++r) {
+                ASSERT_FLOAT_EQ(out[i * outStride + r], expected[r]) << "vertex " << i << " component " << r;
+            }
+        }
+    }
+}
+
+TEST(Transform, PositionsInPlace)
+{
+    // 7 floats per vertex like Geometry<7>: position followed by a color
+    const size_t stride = 7, count = 23;
+    const std::vector<float> original = MakeStream(count, stride);
+    std::vector<float> data = original;
+
+    TransformPositions(kTransform, data.data(), stride, count);
+
+    ExpectTransformed(original, stride, data, stride, count, 3, 1.0f);
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t c = 3; c < stride; ++c) {
+            ASSERT_FLOAT_EQ(data[i * stride + c], original[i * stride + c]);
+        }
+    }
+}
+
+TEST(Transform, PositionsPacked)
+{
+    const size_t count = 10;
+    const std::vector<float> in = MakeStream(count, 3);
+    std::vector<float> out(count * 3);
+
+    TransformPositions(kTransform, in.data(), 3, out.data(), 3, count);
+
+    ExpectTransformed(in, 3, out, 3, count, 3, 1.0f);
+}
+
+TEST(Transform, PositionsIntoOtherStride)
+{
+    const size_t count = 9;
+    const std::vector<float> in = MakeStream(count, 9);
+    std::vector<float> out(count * 3);
+
+    TransformPositions(kTransform, in.data(), 9, out.data(), 3, count);
+
+    ExpectTransformed(in, 9, out, 3, count, 3, 1.0f);
+}
+
+TEST(Transform, Directions)
+{
+    const size_t count = 13;
+    const std::vector<float> original = MakeStream(count, 4);
+    std::vector<float> data = original;
+
+    TransformDirections(kTransform, data.data(), 4, count);
+
+    ExpectTransformed(original, 4, data, 4, count, 3, 0.0f);
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_FLOAT_EQ(data[i * 4 + 3], original[i * 4 + 3]);
+    }
+}
+
+TEST(Transform, Homogeneous)
+{
+    const size_t count = 11;
+    const std::vector<float> in = MakeStream(count, 4);
+    std::vector<float> out(count * 5, -1.0f);
+
+    TransformHomogeneous(kTransform, in.data(), 4, out.data(), 5, count);
+
+    ExpectTransformed(in, 4, out, 5, count, 4, 0.0f);
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_FLOAT_EQ(out[i * 5 + 4], -1.0f);
+    }
+}
+
+TEST(Transform, Empty)
+{
+    TransformPositions(kTransform, nullptr, 3, 0);
+}
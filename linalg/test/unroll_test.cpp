@@ -0,0 +1,93 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <array>
+#include <cstddef>
+
+#include "gtest/gtest.h"
+#include "linalg/cmatrix.h"
+#include "linalg/rmatrix.h"
+#include "linalg/unroll.h"
+
+using namespace QS::LinAlg;
+
+namespace {
+    template<size_t n>
+    constexpr std::array<size_t, n> Indices() {
+        std::array<size_t, n> out = {};
+        size_t next = 0;
+        Detail::For<n>([&](const size_t i) { out[next++] = i; });
+        return out;
+    }
+
+    template<int n>
+    constexpr CMatrix<n, n> Ramp() {
+        CMatrix<n, n> out;
+        for (size_t c = 0; c < n; ++c) {
+            for (size_t r = 0; r < n; ++r) {
+                out[c][r] = static_cast<float>(r * n + c) - static_cast<float>(n);
+            }
+        }
+        return out;
+    }
+
+    constexpr CMatrix<4, 4> kOrtho = OrthographicProjection(0.0f, 800.0f, 0.0f, 600.0f, 1.0f, -1.0f);
+}
+
+// both sides of kUnrollLimit visit every index once and in order
+static_assert(Indices<3>() == std::array<size_t, 3>{ 0, 1, 2 });
+static_assert(Indices<Detail::kUnrollLimit + 1>()[Detail::kUnrollLimit] == Detail::kUnrollLimit);
+
+static_assert(Identity<4>()[0][0] == 1.0f && Identity<4>()[3][3] == 1.0f);
+static_assert(Identity<4>()[1][0] == 0.0f && Identity<4>()[2][3] == 0.0f);
+static_assert(Identity<3, double>()[2][2] == 1.0);
+
+static_assert(kOrtho[0][0] == 2.0f / 800.0f);
+static_assert(kOrtho[1][1] == -2.0f / 600.0f);
+static_assert(kOrtho[2][2] == -1.0f);
+static_assert(kOrtho[3][0] == -1.0f && kOrtho[3][1] == 1.0f && kOrtho[3][3] == 1.0f);
+
+// the centre of the screen lands on the origin of clip space
+static_assert((kOrtho * CVector<4>{ 400.0f, 300.0f, 0.0f, 1.0f })[0] == 0.0f);
+static_assert((kOrtho * CVector<4>{ 400.0f, 300.0f, 0.0f, 1.0f })[1] == 0.0f);
+static_assert((kOrtho * Identity<4>())[3][1] == kOrtho[3][1]);
+static_assert((Ramp<4>() * Ramp<4>())[1][2] == 86.0f);
+
+// above kUnrollVolume the blocked kernel runs, still at compile time
+static_assert(8 * 8 * 8 > Gemm::kUnrollVolume);
+static_assert((Ramp<8>() * Identity<8>())[5][6] == Ramp<8>()[5][6]);
+
+static_assert((RMatrix<2, 3>{ { 1.0f, 2.0f, 3.0f }, { 4.0f, 5.0f, 6.0f } } *
+               RMatrix<3, 2>{ { 1.0f, 0.0f }, { 0.0f, 1.0f }, { 1.0f, 1.0f } })[1][0] == 10.0f);
+
+TEST(Unroll, MatchesBlocked)
+{
+    // sums are taken in the same order, so the unrolled and blocked products agree to the bit
+    const CMatrix<5, 5> a = Ramp<5>() * 0.1f;
+    const CMatrix<5, 5> b = Ramp<5>() * 0.7f;
+    CMatrix<5, 5> unrolled, blocked;
+    const auto lhs = [&a](size_t i, size_t j) { return a[j][i]; };
+    const auto rhs = [&b](size_t i, size_t j) { return b[j][i]; };
+
+    Gemm::Multiply<float, 5, 5, 5>(lhs, rhs, [&unrolled](size_t i, size_t j) -> float & { return unrolled[j][i]; });
+    Gemm::Multiply<float>(5, 5, 5, lhs, rhs, [&blocked](size_t i, size_t j) -> float & { return blocked[j][i]; });
+    for (size_t c = 0; c < 5; ++c) {
+        for (size_t r = 0; r < 5; ++r) {
+            ASSERT_EQ(unrolled[c][r], blocked[c][r]) << c << ", " << r;
+        }
+    }
+}
+
+TEST(Unroll, RuntimeMatchesConstant)
+{
+    constexpr CMatrix<4, 4> product = kOrtho * Ramp<4>();
+    const CMatrix<4, 4> ortho = kOrtho;
+    const CMatrix<4, 4> ramp = Ramp<4>();
+    const CMatrix<4, 4> runtime = ortho * ramp;
+    for (size_t c = 0; c < 4; ++c) {
+        for (size_t r = 0; r < 4; ++r) {
+            ASSERT_FLOAT_EQ(runtime[c][r], product[c][r]);
+        }
+    }
+}
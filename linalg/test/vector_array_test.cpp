@@ -0,0 +1,138 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "linalg/vector_array.h"
+
+using namespace QS::LinAlg;
+
+TEST(VectorArray, Constructor)
+{
+    VectorArray<3> a(5);
+    ASSERT_EQ(a.GetSize(), 5);
+    ASSERT_GE(a.GetCapacity(), 5);
+    for (size_t c = 0; c < 3; ++c) {
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(a.GetLane(c)) % kCacheLineSize, 0);
+    }
+    ASSERT_FLOAT_EQ(a[4][2], 0.0f);
+}
+
+TEST(VectorArray, ProxyAccess)
+{
+    VectorArray<3> a = { { 1, 2, 3 }, { 4, 5, 6 } };
+    ASSERT_FLOAT_EQ(a.GetLane(0)[1], 4.0f);
+    ASSERT_FLOAT_EQ(a.GetLane(2)[0], 3.0f);
+
+    a[0] = RVector<3>{ 7, 8, 9 };
+    a[1][2] = 10.0f;
+    a[1] += RVector<3>{ 1, 1, 1 };
+    const RVector<3> v = a[1];
+    ASSERT_FLOAT_EQ(a[0][1], 8.0f);
+    ASSERT_FLOAT_EQ(v[0], 5.0f);
+    ASSERT_FLOAT_EQ(v[2], 11.0f);
+
+    a[0] = a[1];
+    ASSERT_FLOAT_EQ(a.Get(0)[2], 11.0f);
+}
+
+TEST(VectorArray, PushBackAndResize)
+{
+    VectorArray<2> a;
+    for (int i = 0; i < 100; ++i) {
+        a.PushBack(RVector<2>{ static_cast<float>(i), static_cast<float>(-i) });
+    }
+    ASSERT_EQ(a.GetSize(), 100);
+    ASSERT_FLOAT_EQ(a[57][0], 57.0f);
+    ASSERT_FLOAT_EQ(a[57][1], -57.0f);
+
+    a.Resize(10);
+    a.Resize(20);
+    ASSERT_FLOAT_EQ(a[9][0], 9.0f);
+    ASSERT_FLOAT_EQ(a[15][0], 0.0f);
+}
+
+TEST(VectorArray, Arithmetic)
+{
+    const size_t n = 37;
+    VectorArray<3> a(n), b(n);
+    for (size_t i = 0; i < n; ++i) {
+        const auto f = static_cast<float>(i);
+        a[i] = RVector<3>{ f, 2 * f, 3 * f };
+        b[i] = RVector<3>{ 1, 1, 1 };
+    }
+
+    VectorArray<3> sum = a + b;
+    VectorArray<3> difference = a - b;
+    VectorArray<3> scaled = a * 2.0f;
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t c = 0; c < 3; ++c) {
+            ASSERT_FLOAT_EQ(sum[i][c], a[i][c] + 1.0f);
+            ASSERT_FLOAT_EQ(difference[i][c], a[i][c] - 1.0f);
+            ASSERT_FLOAT_EQ(scaled[i][c], a[i][c] * 2.0f);
+        }
+    }
+
+    b += RVector<3>{ 0, 1, 2 };
+    a.MultiplyAdd(b, 0.5f);
+    ASSERT_FLOAT_EQ(a[3][0], 3.5f);
+    ASSERT_FLOAT_EQ(a[3][1], 7.0f);
+    ASSERT_FLOAT_EQ(a[3][2], 10.5f);
+
+    VectorArray<3> c(n + 1);
+    ASSERT_THROW(a += c, std::invalid_argument);
+}
+
+TEST(VectorArray, DotLengthNormalize)
+{
+    const size_t n = 19;
+    VectorArray<3> a(n);
+    for (size_t i = 0; i < n; ++i) {
+        const auto f = static_cast<float>(i + 1);
+        a[i] = RVector<3>{ f, 0, 2 * f };
+    }
+
+    const DVector<float> dots = Dot(a, a);
+    const DVector<float> lengths = Length(a);
+    for (size_t i = 0; i < n; ++i) {
+        const auto f = static_cast<float>(i + 1);
+        ASSERT_FLOAT_EQ(dots[i], 5 * f * f);
+        ASSERT_FLOAT_EQ(lengths[i], std::sqrt(5.0f) * f);
+    }
+
+    a.Normalize();
+    for (size_t i = 0; i < n; ++i) {
+        ASSERT_FLOAT_EQ(a[i][0], 1.0f / std::sqrt(5.0f));
+        ASSERT_FLOAT_EQ(a[i][2], 2.0f / std::sqrt(5.0f));
+    }
+}
+
+TEST(VectorArray, LoadStore)
+{
+    // position followed by a color, like Geometry<7>
+    std::vector<float> stream(7 * 6);
+    for (size_t i = 0; i < stream.size(); ++i) {
+        stream[i] = static_cast<float>(i);
+    }
+
+    VectorArray<3> positions = VectorArray<3>::Load(stream.data(), 7, 6);
+    ASSERT_FLOAT_EQ(positions[2][1], 15.0f);
+
+    positions *= 2.0f;
+    positions.Store(stream.data(), 7);
+    ASSERT_FLOAT_EQ(stream[7 * 2 + 1], 30.0f);
+    ASSERT_FLOAT_EQ(stream[7 * 2 + 3], 17.0f);
+}
+
+TEST(VectorArray, Double)
+{
+    VectorArray<2, double> a = { { 3, 4 }, { 6, 8 } };
+    const DVector<double> lengths = Length(a);
+    ASSERT_DOUBLE_EQ(lengths[0], 5.0);
+    ASSERT_DOUBLE_EQ(lengths[1], 10.0);
+}
@@ -0,0 +1,199 @@
+//
+// Created by Quinton Schwagle on 10/17/26.
+//
+
+#include <type_traits>
+
+#include "gtest/gtest.h"
+#include "linalg/view.h"
+
+using namespace QS::LinAlg;
+
+TEST(View, TransposeSharesStorage)
+{
+    const RMatrix<2, 3> r = { { 1.0f, 2.0f, 3.0f },
+                              { 4.0f, 5.0f, 6.0f } };
+
+    const auto t = Transpose(r);
+    static_assert(std::is_same_v<Expr::ShapeOf<decltype(t)>, Expr::ShapeOf<CMatrix<2, 3>>>);
+    ASSERT_EQ(t.GetData(), r.GetData());
+
+    const CMatrix<2, 3> c = t;
+    for (size_t i = 0; i < 2; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            // row i of r is column i of its transpose
+            ASSERT_EQ(c[i][j], r[i][j]);
+            ASSERT_EQ(Expr::At(t, j, i), r[i][j]);
+        }
+    }
+    const RMatrix<2, 3> back = Transpose(Transpose(r));
+    ASSERT_EQ(back[1][2], 6.0f);
+}
+
+TEST(View, TransposeInProducts)
+{
+    const RMatrix<4, 4> a = { { 1.0f, 2.0f, 0.0f, 1.0f },
+                              { 0.0f, 1.0f, 3.0f, 0.0f },
+                              { 2.0f, 0.0f, 1.0f, 4.0f },
+                              { 0.0f, 5.0f, 0.0f, 1.0f } };
+    const RMatrix<4, 4> b = { { 2.0f, 0.0f, 1.0f, 0.0f },
+                              { 1.0f, 1.0f, 0.0f, 2.0f },
+                              { 0.0f, 3.0f, 1.0f, 0.0f },
+                              { 4.0f, 0.0f, 0.0f, 1.0f } };
+
+    // A^T B^T = (B A)^T
+    const CMatrix<4, 4> product = Transpose(a) * Transpose(b);
+    const RMatrix<4, 4> expected = b * a;
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            ASSERT_EQ(product[i][j], expected[i][j]);
+        }
+    }
+
+    // a row major matrix against a column vector, without copying either
+    const CVector<4> x = { 1.0f, -1.0f, 2.0f, 0.5f };
+    const CVector<4> ax = AsColumnMajor(a) * x;
+    for (size_t i = 0; i < 4; ++i) {
+        float sum = 0.0f;
+        for (size_t j = 0; j < 4; ++j) {
+            sum += a[i][j] * x[j];
+        }
+        ASSERT_EQ(ax[i], sum);
+    }
+}
+
+TEST(View, ReorderedKeepsMatrix)
+{
+    const CMatrix<4, 4> projection = OrthographicProjection(0.0f, 800.0f, 0.0f, 600.0f, 1.0f, -1.0f);
+
+    const RMatrix<4, 4> r = AsRowMajor(projection);
+    const CMatrix<4, 4> c = AsColumnMajor(r);
+
+    for (size_t row = 0; row < 4; ++row) {
+        for (size_t col = 0; col < 4; ++col) {
+            ASSERT_EQ(r[row][col], projection[col][row]);
+            ASSERT_EQ(c[col][row], projection[col][row]);
+        }
+    }
+    // the translation sits in the last column
+    ASSERT_FLOAT_EQ(r[0][3], -1.0f);
+}
+
+TEST(View, RowsAndColumns)
+{
+    CMatrix<3, 3> m = Identity<3>();
+    RMatrix<2, 3> r = { { 1.0f, 2.0f, 3.0f },
+                        { 4.0f, 5.0f, 6.0f } };
+
+    Row(m, 1) = RVector<3>{ 7.0f, 8.0f, 9.0f };
+    Column(m, 2) += CVector<3>{ 1.0f, 1.0f, 1.0f };
+    ASSERT_EQ(m[0][1], 7.0f);
+    ASSERT_EQ(m[1][1], 8.0f);
+    ASSERT_EQ(m[2][1], 10.0f);
+    ASSERT_EQ(m[2][0], 1.0f);
+    ASSERT_EQ(m[2][2], 2.0f);
+
+    // contiguous slices reach the SIMD paths, strided ones read element by element
+    static_assert(Expr::Dense<decltype(Column(m, 0))>);
+    static_assert(!Expr::Dense<decltype(Row(m, 0))>);
+    static_assert(Expr::Dense<decltype(Row(r, 0))>);
+    ASSERT_EQ(Row(r, 0) * Row(r, 1), 32.0f);
+    ASSERT_EQ(Column(r, 1) * Column(r, 2), 2.0f * 3.0f + 5.0f * 6.0f);
+
+    const CVector<2> sum = Column(r, 0) + Column(r, 2) * 2.0f;
+    ASSERT_EQ(sum[0], 7.0f);
+    ASSERT_EQ(sum[1], 16.0f);
+
+    const RMatrix<2, 3> &constant = r;
+    static_assert(!std::is_assignable_v<decltype(Row(constant, 0)), RVector<3>>);
+    static_assert(std::is_assignable_v<decltype(Row(r, 0)), RVector<3>>);
+}
+
+TEST(View, Blocks)
+{
+    CMatrix<4, 4> transform = Identity<4>();
+    const CMatrix<3, 3> rotation = { { 0.0f, 1.0f, 0.0f },
+                                     { -1.0f, 0.0f, 0.0f },
+                                     { 0.0f, 0.0f, 1.0f } };
+
+    Block<3, 3>(transform, 0, 0) = rotation;
+    Block<3, 1>(transform, 0, 3) = CMatrix<1, 3>{ { 5.0f, 6.0f, 7.0f } };
+
+    const CVector<4> p = transform * CVector<4>{ 1.0f, 0.0f, 0.0f, 1.0f };
+    ASSERT_EQ(p[0], 5.0f);
+    ASSERT_EQ(p[1], 7.0f);
+    ASSERT_EQ(p[2], 7.0f);
+    ASSERT_EQ(p[3], 1.0f);
+
+    // products of strided blocks match products of copies
+    auto upper = Block<3, 3>(transform, 0, 0);
+    const CMatrix<3, 3> squared = upper * upper;
+    const CMatrix<3, 3> expected = rotation * rotation;
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            ASSERT_EQ(squared[i][j], expected[i][j]);
+        }
+    }
+
+    // a block of a block, and a segment of a slice
+    auto inner = Block<2, 2>(upper, 1, 1);
+    ASSERT_EQ(inner[0][0], transform[1][1]);
+    ASSERT_EQ(inner[1][0], transform[2][1]);
+    auto translation = Column(transform, 3);
+    auto xy = Segment<2>(translation, 0);
+    xy = CVector<2>{ 1.0f, 2.0f };
+    ASSERT_EQ(transform[3][0], 1.0f);
+    ASSERT_EQ(transform[3][1], 2.0f);
+    ASSERT_EQ(transform[3][2], 7.0f);
+}
+
+TEST(View, AssignmentThroughAlias)
+{
+    const RMatrix<3, 3> original = { { 1.0f, 2.0f, 3.0f },
+                                     { 4.0f, 5.0f, 6.0f },
+                                     { 7.0f, 8.0f, 9.0f } };
+
+    // reads m in the other order while writing it
+    RMatrix<3, 3> m = original;
+    m = AsRowMajor(Transpose(m));
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            ASSERT_EQ(m[i][j], original[j][i]);
+        }
+    }
+    m = original;
+    m += AsRowMajor(Transpose(m));
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            ASSERT_EQ(m[i][j], original[i][j] + original[j][i]);
+        }
+    }
+
+    // views over the destination at other positions
+    m = original;
+    const auto t = Transpose(m);
+    Row(m, 0) = Row(t, 0);
+    ASSERT_EQ(m[0][0], 1.0f);
+    ASSERT_EQ(m[0][1], 4.0f);
+    ASSERT_EQ(m[0][2], 7.0f);
+    m = original;
+    Block<2, 2>(m, 0, 0) = Block<2, 2>(m, 1, 1);
+    ASSERT_EQ(m[0][0], 5.0f);
+    ASSERT_EQ(m[0][1], 6.0f);
+    ASSERT_EQ(m[1][0], 8.0f);
+    ASSERT_EQ(m[1][1], 9.0f);
+    ASSERT_EQ(m[2][2], 9.0f);
+
+    // operands read in place need no temporary
+    ASSERT_FALSE(Expr::MayAlias(m + m * 2.0f, m.GetData(), m.GetData() + 9));
+    ASSERT_FALSE(Expr::MayAlias(Transpose(Transpose(m)), m.GetData(), m.GetData() + 9));
+    ASSERT_TRUE(Expr::MayAlias(m + AsRowMajor(Transpose(m)), m.GetData(), m.GetData() + 9));
+
+    constexpr RMatrix<2, 2> transposed = [] {
+        RMatrix<2, 2> c = { { 1.0f, 2.0f },
+                            { 3.0f, 4.0f } };
+        c = AsRowMajor(Transpose(c));
+        return c;
+    }();
+    static_assert(transposed[0][1] == 3.0f && transposed[1][0] == 2.0f);
+}